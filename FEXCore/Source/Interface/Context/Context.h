@@ -2,8 +2,10 @@
 #pragma once
 
 #include "Common/JitSymbols.h"
+#include "Interface/Core/BlockExecutionCounters.h"
 #include "Interface/Core/CPUBackend.h"
 #include "Interface/Core/CPUID.h"
+#include "Interface/Core/UnalignedAtomicHotspots.h"
 #include <Interface/IR/IntrusiveIRList.h>
 #include <FEXCore/Config/Config.h>
 #include <FEXCore/Core/Context.h>
@@ -208,6 +210,11 @@ public:
   void ClearCodeCache(FEXCore::Core::InternalThreadState* Thread, bool NewCodeBuffer = true) override;
   void InvalidateCodeBuffersCodeRange(uint64_t Start, uint64_t Length) override;
   void InvalidateThreadCachedCodeRange(FEXCore::Core::InternalThreadState* Thread, uint64_t Start, uint64_t Length) override;
+
+  // Drops the entrypoints in [Start, Start + Length) from the thread's code buffer and caches so that the next lookup recompiles them.
+  // Unlike guest code invalidation this doesn't touch other blocks on the same pages or other threads' caches, so it must only be
+  // used when the old code is still correct.
+  void InvalidateThreadBlock(FEXCore::Core::InternalThreadState* Thread, uint64_t Start, uint64_t Length);
   FEXCore::ForkableSharedMutex& GetCodeInvalidationMutex() override {
     return CodeInvalidationMutex;
   }
@@ -232,6 +239,8 @@ public:
 
   void MarkMonoBackpatcherBlock(uint64_t BlockEntry) override;
 
+  void WriteBlockExecutionCounts(FEXCore::Core::InternalThreadState* Thread) override;
+
 public:
   struct {
     uint64_t VirtualMemSize {1ULL << 36};
@@ -247,18 +256,21 @@ public:
     FEX_CONFIG_OPT(TSOEnabled, TSOENABLED);
     FEX_CONFIG_OPT(VectorTSOEnabled, VECTORTSOENABLED);
     FEX_CONFIG_OPT(MemcpySetTSOEnabled, MEMCPYSETTSOENABLED);
+    FEX_CONFIG_OPT(StackTSOElisionWindow, STACKTSOELISIONWINDOW);
     FEX_CONFIG_OPT(SMCChecks, SMCCHECKS);
     FEX_CONFIG_OPT(MaxInstPerBlock, MAXINST);
     FEX_CONFIG_OPT(RootFSPath, ROOTFS);
     FEX_CONFIG_OPT(GlobalJITNaming, GLOBALJITNAMING);
     FEX_CONFIG_OPT(LibraryJITNaming, LIBRARYJITNAMING);
     FEX_CONFIG_OPT(BlockJITNaming, BLOCKJITNAMING);
+    FEX_CONFIG_OPT(BlockExecutionCounts, BLOCKEXECUTIONCOUNTS);
     FEX_CONFIG_OPT(GDBSymbols, GDBSYMBOLS);
     FEX_CONFIG_OPT(x87ReducedPrecision, X87REDUCEDPRECISION);
     FEX_CONFIG_OPT(DisableTelemetry, DISABLETELEMETRY);
     FEX_CONFIG_OPT(DisableVixlIndirectCalls, DISABLE_VIXL_INDIRECT_RUNTIME_CALLS);
     FEX_CONFIG_OPT(SmallTSCScale, SMALLTSCSCALE);
     FEX_CONFIG_OPT(StrictInProcessSplitLocks, STRICTINPROCESSSPLITLOCKS);
+    FEX_CONFIG_OPT(UnalignedAtomicRecompileThreshold, UNALIGNEDATOMICRECOMPILETHRESHOLD);
     FEX_CONFIG_OPT(MonoHacks, MONOHACKS);
   } Config;
 
@@ -266,6 +278,11 @@ public:
 
   uint32_t StrictSplitLockMutex {};
 
+  UnalignedAtomicHotspots UnalignedAtomicHotspots;
+
+  // Only allocated when block execution counting is enabled, the JIT instruments block entries when this is set.
+  fextl::unique_ptr<BlockExecutionCounters> BlockCounters;
+
   FEXCore::HostFeatures HostFeatures;
   // CPUID depends on HostFeatures so needs to be initialized after that.
   FEXCore::CPUIDEmu CPUID;
@@ -287,6 +304,14 @@ public:
   // even if faulting is disabled.
   static void MonoBackpatcherWrite(FEXCore::Core::CpuStateFrame* Frame, uint8_t Size, uint64_t Address, uint64_t Value);
 
+  // Called from the unaligned access handler after an atomic has been emulated.
+  // Once a guest instruction crosses the recompile threshold its block is queued for invalidation so the JIT can guard it inline.
+  void RecordUnalignedAtomic(FEXCore::Core::InternalThreadState* Thread, uint64_t HostPC);
+
+  // Called from JIT code for atomics at hot RIPs when the address turns out to be unaligned.
+  // Returns the memory value prior to the operation.
+  static uint64_t UnalignedAtomicFallback(FEXCore::Core::CpuStateFrame* Frame, uint64_t Addr, uint64_t Value, uint64_t Expected, uint64_t OpAndSize);
+
   void RemoveCustomIREntrypoint(FEXCore::Core::InternalThreadState* Thread, uintptr_t Entrypoint);
 
   struct GenerateIRResult {
@@ -0,0 +1,62 @@
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#include <FEXCore/fextl/vector.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+
+namespace FEXCore::Context {
+// Side table of execution counters for instrumented JIT blocks.
+//
+// Each compiled block allocates one entry per guest entrypoint. The block's JITCodeTail points at its first entry and
+// every entrypoint increments its own counter on the way in. Entries are never freed or moved, so counts survive code
+// cache clears and invalidation, and a RIP that got recompiled shows up once per compilation.
+class BlockExecutionCounters final {
+public:
+  struct Entry {
+    uint64_t RIP;
+    uint64_t GuestSize;
+    uint64_t HostSize;
+    std::atomic<uint64_t> Count;
+  };
+
+  // Returns storage for `NumEntries` contiguous counters.
+  Entry* Allocate(size_t NumEntries) {
+    std::scoped_lock lk {Mutex};
+    if (Chunks.empty() || Chunks.back().Used + NumEntries > Chunks.back().Entries.size()) {
+      Chunks.emplace_back(std::max(NumEntries, ChunkSize));
+    }
+
+    auto& Chunk = Chunks.back();
+    auto Result = &Chunk.Entries[Chunk.Used];
+    Chunk.Used += NumEntries;
+    return Result;
+  }
+
+  template<typename Fn>
+  void ForEach(Fn&& Func) {
+    std::scoped_lock lk {Mutex};
+    for (auto& Chunk : Chunks) {
+      for (size_t i = 0; i < Chunk.Used; ++i) {
+        Func(Chunk.Entries[i]);
+      }
+    }
+  }
+
+private:
+  constexpr static size_t ChunkSize = 4096;
+
+  struct Chunk {
+    explicit Chunk(size_t Size)
+      : Entries(Size) {}
+    fextl::vector<Entry> Entries;
+    size_t Used {};
+  };
+
+  std::mutex Mutex;
+  fextl::vector<Chunk> Chunks;
+};
+} // namespace FEXCore::Context
@@ -63,6 +63,10 @@ namespace CPU {
     {0x6ED9'EBA1'6ED9'EBA1ULL, 0x6ED9'EBA1'6ED9'EBA1ULL}, // NAMED_VECTOR_SHA1RNDS_K1
     {0x8F1B'BCDC'8F1B'BCDCULL, 0x8F1B'BCDC'8F1B'BCDCULL}, // NAMED_VECTOR_SHA1RNDS_K2
     {0xCA62'C1D6'CA62'C1D6ULL, 0xCA62'C1D6'CA62'C1D6ULL}, // NAMED_VECTOR_SHA1RNDS_K3
+    {0x0302'0100'0302'0100ULL, 0x0302'0100'0302'0100ULL}, // NAMED_VECTOR_VPERMD_INDEX
+    {0x0302'0100'0302'0100ULL, 0x0302'0100'0302'0100ULL}, // NAMED_VECTOR_VPERMILPS_INDEX
+    {0x0706'0504'0302'0100ULL, 0x0706'0504'0302'0100ULL}, // NAMED_VECTOR_VPERMILPD_INDEX
+    {0x0706'0504'0302'0100ULL, 0x0F0E'0D0C'0B0A'0908ULL}, // NAMED_VECTOR_INCREMENTAL_U8_INDEX
   };
 
   constexpr static auto PSHUFLW_LUT {[]() consteval {
@@ -154,6 +158,87 @@ namespace CPU {
     return TotalLUT;
   }()};
 
+  constexpr static auto VPERMQ_LUT {[]() consteval {
+    struct LUTType {
+      uint64_t Val[4];
+    };
+    // Expectation for this LUT is to simulate 256-bit VPERMQ with SVE's TBL (single register) instruction.
+    // VPERMQ behaviour:
+    // 64-bit words in [255:192], [191:128], [127:64], [63:0] are selected from the whole 256-bit source using the 8-bit Index.
+    std::array<LUTType, 256> TotalLUT {};
+    constexpr uint64_t IdentityCopy = 0x07'06'05'04'03'02'01'00;
+    constexpr uint64_t ElementOffset = 0x08'08'08'08'08'08'08'08;
+    for (size_t i = 0; i < 256; ++i) {
+      auto& LUT = TotalLUT[i];
+      for (size_t j = 0; j < 4; ++j) {
+        const auto Word = (i >> (j * 2)) & 0b11;
+        LUT.Val[j] = IdentityCopy + Word * ElementOffset;
+      }
+    }
+    return TotalLUT;
+  }()};
+
+  constexpr static auto PSHUFD_256_LUT {[]() consteval {
+    struct LUTType {
+      uint64_t Val[4];
+    };
+    // Expectation for this LUT is to simulate 256-bit VPSHUFD and VPERMILPS with SVE's TBL (single register) instruction.
+    // Behaves like PSHUFD on each 128-bit lane independently, so indices for the upper lane are offset by 16-bytes.
+    std::array<LUTType, 256> TotalLUT {};
+    uint64_t WordSelection[4] = {
+      0x03'02'01'00,
+      0x07'06'05'04,
+      0x0b'0a'09'08,
+      0x0f'0e'0d'0c,
+    };
+    constexpr uint64_t UpperLaneOffset = 0x10'10'10'10'10'10'10'10;
+    for (size_t i = 0; i < 256; ++i) {
+      auto& LUT = TotalLUT[i];
+      const auto Word0 = (i >> 0) & 0b11;
+      const auto Word1 = (i >> 2) & 0b11;
+      const auto Word2 = (i >> 4) & 0b11;
+      const auto Word3 = (i >> 6) & 0b11;
+
+      LUT.Val[0] = (WordSelection[Word0] << 0) | (WordSelection[Word1] << 32);
+      LUT.Val[1] = (WordSelection[Word2] << 0) | (WordSelection[Word3] << 32);
+
+      LUT.Val[2] = LUT.Val[0] + UpperLaneOffset;
+      LUT.Val[3] = LUT.Val[1] + UpperLaneOffset;
+    }
+    return TotalLUT;
+  }()};
+
+  // 256-bit index vectors for SVE's TBL, kept out of the named constant pool since that is copied in to every CpuStateFrame.
+  // These are single entry indexed constants, users always load index 0.
+  // Upper lane indices are offset by 16-bytes so that they select from the upper lane.
+  constexpr static std::array<uint64_t, 4> TBL_LANE_OFFSET_256 {
+    0x0000'0000'0000'0000ULL,
+    0x0000'0000'0000'0000ULL,
+    0x1010'1010'1010'1010ULL,
+    0x1010'1010'1010'1010ULL,
+  };
+
+  constexpr static std::array<uint64_t, 4> VPERMD_INDEX_256 {
+    0x0302'0100'0302'0100ULL,
+    0x0302'0100'0302'0100ULL,
+    0x0302'0100'0302'0100ULL,
+    0x0302'0100'0302'0100ULL,
+  };
+
+  constexpr static std::array<uint64_t, 4> VPERMILPS_INDEX_256 {
+    0x0302'0100'0302'0100ULL,
+    0x0302'0100'0302'0100ULL,
+    0x1312'1110'1312'1110ULL,
+    0x1312'1110'1312'1110ULL,
+  };
+
+  constexpr static std::array<uint64_t, 4> VPERMILPD_INDEX_256 {
+    0x0706'0504'0302'0100ULL,
+    0x0706'0504'0302'0100ULL,
+    0x1716'1514'1312'1110ULL,
+    0x1716'1514'1312'1110ULL,
+  };
+
   constexpr static auto SHUFPS_LUT {[]() consteval {
     struct LUTType {
       uint64_t Val[2];
@@ -303,6 +388,18 @@ namespace CPU {
       reinterpret_cast<uint64_t>(DPPD_MASK.data());
     Ptrs.IndexedNamedVectorConstantPointers[FEXCore::IR::IndexNamedVectorConstant::INDEXED_NAMED_VECTOR_PBLENDW] =
       reinterpret_cast<uint64_t>(PBLENDW_LUT.data());
+    Ptrs.IndexedNamedVectorConstantPointers[FEXCore::IR::IndexNamedVectorConstant::INDEXED_NAMED_VECTOR_VPERMQ] =
+      reinterpret_cast<uint64_t>(VPERMQ_LUT.data());
+    Ptrs.IndexedNamedVectorConstantPointers[FEXCore::IR::IndexNamedVectorConstant::INDEXED_NAMED_VECTOR_PSHUFD_256] =
+      reinterpret_cast<uint64_t>(PSHUFD_256_LUT.data());
+    Ptrs.IndexedNamedVectorConstantPointers[FEXCore::IR::IndexNamedVectorConstant::INDEXED_NAMED_VECTOR_TBL_LANE_OFFSET_256] =
+      reinterpret_cast<uint64_t>(TBL_LANE_OFFSET_256.data());
+    Ptrs.IndexedNamedVectorConstantPointers[FEXCore::IR::IndexNamedVectorConstant::INDEXED_NAMED_VECTOR_VPERMD_INDEX_256] =
+      reinterpret_cast<uint64_t>(VPERMD_INDEX_256.data());
+    Ptrs.IndexedNamedVectorConstantPointers[FEXCore::IR::IndexNamedVectorConstant::INDEXED_NAMED_VECTOR_VPERMILPS_INDEX_256] =
+      reinterpret_cast<uint64_t>(VPERMILPS_INDEX_256.data());
+    Ptrs.IndexedNamedVectorConstantPointers[FEXCore::IR::IndexNamedVectorConstant::INDEXED_NAMED_VECTOR_VPERMILPD_INDEX_256] =
+      reinterpret_cast<uint64_t>(VPERMILPD_INDEX_256.data());
 
 #ifndef FEX_DISABLE_TELEMETRY
     // Fill in telemetry values
@@ -131,6 +131,10 @@ namespace CPU {
       // The length of the guest code for this block.
       size_t GuestSize;
 
+      // Pointer to this block's BlockExecutionCounters entries, one per entrypoint.
+      // Zero unless block execution counting is enabled.
+      uintptr_t ExecutionCounters;
+
       // Number of RIP entries for this JIT Code section.
       uint32_t NumberOfRIPEntries;
 
@@ -77,7 +77,10 @@ fextl::map<CodeMapFileId, CodeMap::ParsedContents> CodeMap::ParseCodeMap(std::if
       if (!Ret.contains(Entry.FileId)) {
         LogMan::Msg::EFmt("Code map referenced unknown file id {:016x}", Entry.FileId);
       } else {
-        Ret[Entry.FileId].Blocks.insert(Entry.BlockOffset);
+        auto& Contents = Ret[Entry.FileId];
+        if (Contents.Blocks.insert(Entry.BlockOffset).second) {
+          Contents.BlockOrder.push_back(Entry.BlockOffset);
+        }
       }
     }
 
@@ -217,6 +220,17 @@ void CodeMapWriter::AppendData(std::span<const std::byte> Data) {
 
 namespace FEXCore::Context {
 
+// Thunk call sites are compiled for the packed or register ABI depending on the host library that was loaded at the time.
+// FEXOfflineCompiler has no host libraries loaded and always uses the packed ABI, so check the thunk the relocation resolves to agrees.
+static bool ThunkABIMatches(ContextImpl& CTX, const CPU::Relocation& Reloc) {
+  const bool RegisterABI = Reloc.Header.Type == CPU::RelocationTypes::RELOC_NAMED_REGISTER_ABI_THUNK_MOVE;
+  if (!RegisterABI && Reloc.Header.Type != CPU::RelocationTypes::RELOC_NAMED_THUNK_MOVE) {
+    return true;
+  }
+
+  return RegisterABI == (CTX.ThunkHandler && CTX.ThunkHandler->IsRegisterABIThunk(Reloc.NamedThunkMove.Symbol));
+}
+
 CodeCache::CodeCache(ContextImpl& CTX_)
   : CTX(CTX_) {}
 CodeCache::~CodeCache() = default;
@@ -337,6 +351,11 @@ bool CodeCache::LoadData(Core::InternalThreadState* Thread, std::byte* MappedCac
     return true;
   }
 
+  if (CTX.BlockCounters) {
+    // Cached code isn't instrumented, compile everything so block execution counts are complete.
+    return true;
+  }
+
   namespace ranges = std::ranges;
 
   // Read file header
@@ -413,6 +432,11 @@ bool CodeCache::LoadData(Core::InternalThreadState* Thread, std::byte* MappedCac
   ::memcpy(Relocations.data(), MappedCacheFile, Relocations.size() * sizeof(Relocations[0]));
   MappedCacheFile += Relocations.size() * sizeof(Relocations[0]);
 
+  if (!ranges::all_of(Relocations, [&](const auto& Reloc) { return ThunkABIMatches(CTX, Reloc); })) {
+    LogMan::Msg::IFmt("Cached thunk calls don't match the ABI of the loaded thunks; skipping");
+    return false;
+  }
+
   // Pad to next page in file, which contains CodeBuffer data
   MappedCacheFile = reinterpret_cast<std::byte*>(AlignUp(reinterpret_cast<uintptr_t>(MappedCacheFile), Utils::FEX_PAGE_SIZE));
 
@@ -556,7 +580,9 @@ void CodeCache::Validate(const ExecutableFileSectionInfo& Section, fextl::set<ui
   // Patch FEX-internal function addresses with values from the main Context to ensure the code blocks are comparable
   auto NewRelocations = ValidationThread->CPUBackend->TakeRelocations(Section.FileStartVA);
   NewRelocations.erase(std::remove_if(NewRelocations.begin(), NewRelocations.end(), [](const CPU::Relocation& Reloc) {
-    return Reloc.Header.Type != CPU::RelocationTypes::RELOC_NAMED_SYMBOL_LITERAL && Reloc.Header.Type != CPU::RelocationTypes::RELOC_NAMED_THUNK_MOVE;
+    return Reloc.Header.Type != CPU::RelocationTypes::RELOC_NAMED_SYMBOL_LITERAL &&
+           Reloc.Header.Type != CPU::RelocationTypes::RELOC_NAMED_THUNK_MOVE &&
+           Reloc.Header.Type != CPU::RelocationTypes::RELOC_NAMED_REGISTER_ABI_THUNK_MOVE;
   }));
   (void)ApplyCodeRelocations(Section.FileStartVA, CodeBufferRangeRef, NewRelocations, false);
 
@@ -633,7 +659,11 @@ bool CodeCache::ApplyCodeRelocations(uint64_t GuestEntry, std::span<std::byte> C
       Emitter.dc64(Pointer);
       break;
     }
-    case FEXCore::CPU::RelocationTypes::RELOC_NAMED_THUNK_MOVE: {
+    case FEXCore::CPU::RelocationTypes::RELOC_NAMED_THUNK_MOVE:
+    case FEXCore::CPU::RelocationTypes::RELOC_NAMED_REGISTER_ABI_THUNK_MOVE: {
+      if (!ForStorage && !ThunkABIMatches(CTX, Reloc)) {
+        return false;
+      }
       uint64_t Pointer = ForStorage ? 0 : reinterpret_cast<uint64_t>(CTX.ThunkHandler->LookupThunk(Reloc.NamedThunkMove.Symbol));
       if (Pointer == ~0ULL) {
         return false;
@@ -43,6 +43,7 @@ $end_info$
 #include <FEXCore/HLE/SyscallHandler.h>
 #include <FEXCore/HLE/SourcecodeResolver.h>
 #include <FEXCore/Utils/Allocator.h>
+#include <FEXCore/Utils/ArchHelpers/Arm64.h>
 #include <FEXCore/Utils/Event.h>
 #include <FEXCore/Utils/File.h>
 #include <FEXCore/Utils/LogManager.h>
@@ -358,6 +359,10 @@ bool ContextImpl::InitCore() {
     Config.NeedsPendingInterruptFaultCheck = true;
   }
 
+  if (!Config.BlockExecutionCounts().empty()) {
+    BlockCounters = fextl::make_unique<BlockExecutionCounters>();
+  }
+
   return true;
 }
 
@@ -819,6 +824,18 @@ uintptr_t ContextImpl::CompileBlock(FEXCore::Core::CpuStateFrame* Frame, uint64_
 
   static_cast<ContextImpl*>(Thread->CTX)->SyscallHandler->PreCompile();
 
+  if (auto PendingBlock = Thread->PendingUnalignedAtomicBlock.exchange(0, std::memory_order_relaxed)) {
+    // Must happen before taking CodeInvalidationMutex, invalidation takes it uniquely.
+    InvalidateThreadBlock(Thread, PendingBlock, std::max<uint64_t>(Thread->PendingUnalignedAtomicBlockSize, 1));
+  }
+
+  auto& Budget = Thread->FrontendDecoder->GetJITBudget();
+  if (auto PromotedBlock = Budget.PopPromotableBlock()) {
+    // Recompile a block that was reduced while over the JIT time budget at its full size.
+    // Reduced blocks have a single entrypoint and their code is still correct, so nothing else needs to be invalidated.
+    InvalidateThreadBlock(Thread, *PromotedBlock, 1);
+  }
+
   // Invalidate might take a unique lock on this, to guarantee that during invalidation no code gets compiled
   auto lk = GuardSignalDeferringSection<std::shared_lock>(CodeInvalidationMutex, Thread);
 
@@ -831,7 +848,11 @@ uintptr_t ContextImpl::CompileBlock(FEXCore::Core::CpuStateFrame* Frame, uint64_
   // Accumulate a JIT count now, as even if another thread raced us, it should count as a compile.
   FEXCORE_PROFILE_INSTANT_INCREMENT(Thread, AccumulatedJITCount, 1);
 
+  const auto CompileBegin = Budget.IsEnabled() ? Frontend::JITBudget::Now() : 0;
   auto [CompiledCode, DebugData, StartAddr, Length, NeedsAddGuestCodeRanges] = CompileCode(Thread, GuestRIP, MaxInst);
+  if (Budget.IsEnabled()) {
+    Budget.Accumulate(CompileBegin, Frontend::JITBudget::Now());
+  }
   auto CodePtr = CompiledCode.EntryPoints[GuestRIP];
   if (CodePtr == nullptr) {
     return 0;
@@ -967,6 +988,11 @@ void ContextImpl::InvalidateThreadCachedCodeRange(FEXCore::Core::InternalThreadS
   }
 }
 
+void ContextImpl::InvalidateThreadBlock(FEXCore::Core::InternalThreadState* Thread, uint64_t Start, uint64_t Length) {
+  auto lk = GuardSignalDeferringSection(CodeInvalidationMutex, Thread);
+  Thread->LookupCache->InvalidateBlockRange(Start, Length);
+}
+
 void ContextImpl::ThreadRemoveCodeEntryFromJit(FEXCore::Core::CpuStateFrame* Frame, uint64_t GuestRIP) {
   static_cast<ContextImpl*>(Frame->Thread->CTX)->SyscallHandler->InvalidateGuestCodeRange(Frame->Thread, GuestRIP, 1);
 }
@@ -1077,6 +1103,84 @@ void ContextImpl::MonoBackpatcherWrite(FEXCore::Core::CpuStateFrame* Frame, uint
   CTX->SyscallHandler->InvalidateGuestCodeRange(Thread, Address, Size);
 }
 
+void ContextImpl::RecordUnalignedAtomic(FEXCore::Core::InternalThreadState* Thread, uint64_t HostPC) {
+  const uint32_t Threshold = Config.UnalignedAtomicRecompileThreshold;
+  if (Threshold == 0) {
+    return;
+  }
+
+  const auto RIP = RestoreRIPFromHostPC(Thread, HostPC);
+  if (UnalignedAtomicHotspots.Record(RIP) >= Threshold) {
+    // This runs in the SIGBUS handler which can't take the code invalidation locks, leave the block for CompileBlock.
+    // Each thread queues its own copy of the block, the recompiled block will guard the atomic inline.
+    auto [_, InlineTail] = GetFrameBlockInfo(Thread->CurrentFrame);
+    if (InlineTail) {
+      Thread->PendingUnalignedAtomicBlockSize = InlineTail->GuestSize;
+      Thread->PendingUnalignedAtomicBlock.store(InlineTail->RIP, std::memory_order_relaxed);
+    }
+  }
+}
+
+uint64_t ContextImpl::UnalignedAtomicFallback(FEXCore::Core::CpuStateFrame* Frame, uint64_t Addr, uint64_t Value, uint64_t Expected,
+                                              uint64_t OpAndSize) {
+  auto CTX = static_cast<ContextImpl*>(Frame->Thread->CTX);
+  uint32_t* StrictSplitLockMutex {CTX->Config.StrictInProcessSplitLocks ? &CTX->StrictSplitLockMutex : nullptr};
+
+  const auto Op = static_cast<FEXCore::ArchHelpers::Arm64::UnalignedAtomicOp>(OpAndSize >> 8);
+  const uint32_t Size = OpAndSize & 0xFF;
+  return FEXCore::ArchHelpers::Arm64::HandleUnalignedAtomicOp(Op, Size, Addr, Value, Expected, StrictSplitLockMutex);
+}
+
+void ContextImpl::WriteBlockExecutionCounts(FEXCore::Core::InternalThreadState* Thread) {
+  if (!BlockCounters) {
+    return;
+  }
+
+  struct CountedBlock {
+    uint64_t Count;
+    uint64_t RIP;
+    uint64_t HostSize;
+  };
+
+  // Recompiled blocks have one entry per compilation, merge them back together per guest RIP.
+  fextl::unordered_map<uint64_t, CountedBlock> Merged;
+  BlockCounters->ForEach([&Merged](const BlockExecutionCounters::Entry& Entry) {
+    auto& Block = Merged.try_emplace(Entry.RIP, CountedBlock {0, Entry.RIP, 0}).first->second;
+    Block.Count += Entry.Count.load(std::memory_order_relaxed);
+    Block.HostSize = Entry.HostSize;
+  });
+
+  fextl::vector<CountedBlock> Sorted;
+  Sorted.reserve(Merged.size());
+  for (const auto& [RIP, Block] : Merged) {
+    Sorted.push_back(Block);
+  }
+  std::ranges::sort(Sorted, [](const CountedBlock& a, const CountedBlock& b) { return a.Count != b.Count ? a.Count > b.Count : a.RIP < b.RIP; });
+
+  const auto& Filename = AppFilename();
+  const auto AppName = Filename.substr(Filename.find_last_of('/') + 1);
+  const auto Path = fextl::fmt::format("{}/{}-{}.counts", Config.BlockExecutionCounts(), AppName, ::getpid());
+  FEXCore::File::File FD(Path.c_str(), FEXCore::File::FileModes::WRITE | FEXCore::File::FileModes::CREATE | FEXCore::File::FileModes::TRUNCATE);
+  if (!FD.IsValid()) {
+    LogMan::Msg::EFmt("Couldn't open '{}' for writing block execution counts", Path);
+    return;
+  }
+
+  // <FileId> <Offset> <Count> <HostSize> <RIP> <Filename>
+  // Blocks that don't belong to a file mapping (JIT code, anonymous memory) use a FileId of zero and their RIP as the offset.
+  for (const auto& Block : Sorted) {
+    auto Section = SyscallHandler->LookupExecutableFileSection(Thread, Block.RIP);
+    if (Section) {
+      fextl::fmt::print(FD, "{:016x} {:x} {} {} {:x} {}\n", Section->FileInfo.FileId, Block.RIP - Section->FileStartVA, Block.Count,
+                        Block.HostSize, Block.RIP, Section->FileInfo.Filename);
+    } else {
+      fextl::fmt::print(FD, "{:016x} {:x} {} {} {:x} [anon]\n", 0, Block.RIP, Block.Count, Block.HostSize, Block.RIP);
+    }
+  }
+
+  LogMan::Msg::IFmt("Wrote {} block execution counts to '{}'", Sorted.size(), Path);
+}
+
 void ContextImpl::ConfigureAOTGen(FEXCore::Core::InternalThreadState* Thread, fextl::set<uint64_t>* ExternalBranches, uint64_t SectionMaxAddress) {
   Thread->FrontendDecoder->SetExternalBranches(ExternalBranches);
 }
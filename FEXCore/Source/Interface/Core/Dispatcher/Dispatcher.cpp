@@ -501,7 +501,11 @@ void Dispatcher::EmitDispatcher() {
     str(ARMEmitter::XReg::x1, STATE_PTR(CpuStateFrame, State.rip));
 
     // load static regs
-    FillStaticRegs();
+    // Only GPRs need to be filled here. Vector registers are caller-saved in both the x86-64 and i386 ABIs and callback
+    // arguments are passed through a pointer, so the callback can't observe their values. The Thunk op that called in to
+    // the host spilled the guest's vector registers and fills them again once the callback returns to it.
+    // FPRs stay enabled with an empty mask so the special registers are still set up.
+    FillStaticRegs(true, ~0U, 0);
     stp<ARMEmitter::IndexType::PRE>(ARMEmitter::XReg::zr, ARMEmitter::XReg::zr, REG_CALLRET_SP, -0x10);
 
     // Now go back to the regular dispatcher loop
@@ -565,8 +569,6 @@ void Dispatcher::EmitDispatcher() {
       FABI_F80_I16_F80_F80_PTR,
       FABI_F80x2_I16_F80_PTR,
       FABI_F64x2_F64_PTR,
-      FABI_I32_I64_I64_V128_V128_I16,
-      FABI_I32_V128_V128_I16,
     }};
 
     for (auto ABI : ABIS) {
@@ -1202,60 +1204,6 @@ uint64_t Dispatcher::GenerateABICall(FallbackABI ABI) {
 
     FillF64x2Result();
   } break;
-  case FABI_I32_I64_I64_V128_V128_I16: {
-    // Linux Reg/Win32 Reg:
-    // stack: FallbackHandler
-    // x30: return
-    // vtmp1 (v0/v16): vector source 1
-    // vtmp2 (v1/v17): vector source 2
-    // tmp1 (x0/x10): source 1
-    // tmp2 (x1/x11): source 2
-    // tmp3 (x2/x12): source 3
-
-    const size_t OriginalSPOffset = SpillForABICall(CTX->HostFeatures.SupportsPreserveAllABI, TMP4, true);
-
-    // Load the Fallback handler pointer from the stack.
-    ldr(FallbackPointerReg, ARMEmitter::XReg::rsp, OriginalSPOffset);
-
-    if (!TMP_ABIARGS) {
-      mov(ABI1, TMP1);
-      mov(ABI2, TMP2);
-      mov(ABI3, TMP3);
-      mov(VABI1.Q(), VTMP1.Q());
-      mov(VABI2.Q(), VTMP2.Q());
-    }
-
-    if (!CTX->Config.DisableVixlIndirectCalls) [[unlikely]] {
-      GenerateIndirectRuntimeCall<uint32_t, uint64_t, uint64_t, FEXCore::VectorRegType, FEXCore::VectorRegType, uint16_t>(FallbackPointerReg);
-    } else {
-      blr(FallbackPointerReg);
-    }
-
-    FillI32Result();
-  } break;
-  case FABI_I32_V128_V128_I16: {
-    // Linux Reg/Win32 Reg:
-    // tmp4 (x4/x13): FallbackHandler
-    // x30: return
-    // vtmp1 (v0/v16): vector source 1
-    // vtmp2 (v1/v17): vector source 2
-    // tmp1 (x0/x10): source 1
-    SpillForABICall(CTX->HostFeatures.SupportsPreserveAllABI, TMP3, true);
-
-    if (!TMP_ABIARGS) {
-      mov(VABI1.Q(), VTMP1.Q());
-      mov(VABI2.Q(), VTMP2.Q());
-      mov(ABI1, TMP1);
-    }
-
-    if (!CTX->Config.DisableVixlIndirectCalls) [[unlikely]] {
-      GenerateIndirectRuntimeCall<uint32_t, FEXCore::VectorRegType, FEXCore::VectorRegType, uint16_t>(FallbackPointerReg);
-    } else {
-      blr(FallbackPointerReg);
-    }
-
-    FillI32Result();
-  } break;
   case FABI_UNKNOWN:
   default:
 #if defined(ASSERTIONS_ENABLED) && ASSERTIONS_ENABLED
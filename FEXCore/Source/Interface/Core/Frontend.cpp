@@ -72,6 +72,9 @@ Decoder::Decoder(FEXCore::Core::InternalThreadState* Thread)
   , OSABI {CTX->SyscallHandler ? CTX->SyscallHandler->GetOSABI() : FEXCore::HLE::SyscallOSABI::OS_UNKNOWN}
   , PoolObject {CTX->FrontendAllocator, sizeof(FEXCore::X86Tables::DecodedInst) * DefaultDecodedBufferSize} {
 
+  FEX_CONFIG_OPT(JITTimeBudget, JITTIMEBUDGET);
+  Budget.Initialize(JITTimeBudget);
+
   FEX_CONFIG_OPT(ReducedPrecision, X87REDUCEDPRECISION);
   if (ReducedPrecision) {
     X87Table = &FEXCore::X86Tables::X87F64Ops;
@@ -1113,7 +1116,7 @@ Decoder::DecodedBlockStatus Decoder::DecodeInstruction(uint64_t PC) {
 }
 
 void Decoder::BranchTargetInMultiblockRange() {
-  if (!CTX->Config.Multiblock) {
+  if (!MultiblockEnabled) {
     return;
   }
 
@@ -1393,8 +1396,18 @@ void Decoder::DecodeInstructionsAtEntry(FEXCore::Core::InternalThreadState* Thre
 
   BlockInfo.CodePages = {CurrentCodePage};
 
+  MultiblockEnabled = CTX->Config.Multiblock;
+
   if (MaxInst == 0) {
     MaxInst = CTX->Config.MaxInstPerBlock;
+
+    // Bound the compile time while this thread is over its JIT time budget, the block gets promoted once that passes.
+    // Cached code is compiled ahead of time, so there's no stall to bound.
+    if (!CTX->GetCodeCache().IsGeneratingCache && Budget.UnderPressure()) {
+      MaxInst = std::min<uint64_t>(MaxInst, JITBudget::REDUCED_MAX_INST);
+      MultiblockEnabled = false;
+      Budget.RecordReducedBlock(PC);
+    }
   }
 
   bool EntryBlock {true};
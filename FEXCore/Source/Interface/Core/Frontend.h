@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: MIT
 #pragma once
 
+#include "Interface/Core/JITBudget.h"
 #include "Interface/Core/X86Tables/X86Tables.h"
 #include "Interface/IR/IR.h"
 
@@ -75,6 +76,10 @@ public:
     ExecutableRangeBase = ExecutableRangeEnd = 0;
   }
 
+  JITBudget& GetJITBudget() {
+    return Budget;
+  }
+
 private:
   // To pass any information from instruction prefixes
   // down into the actual instruction handling machinery.
@@ -90,6 +95,10 @@ private:
 
   FEX_CONFIG_OPT(EnableCodeCacheValidation, ENABLECODECACHEVALIDATION);
 
+  JITBudget Budget;
+  // Multiblock for the current decode, disabled while over the JIT time budget.
+  bool MultiblockEnabled {};
+
   bool DecodeInstructionImpl(uint64_t PC);
   DecodedBlockStatus DecodeInstruction(uint64_t PC);
 
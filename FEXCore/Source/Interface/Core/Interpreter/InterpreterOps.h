@@ -29,8 +29,6 @@ enum FallbackABI {
   FABI_F80_I16_F80_F80_PTR,
   FABI_F80x2_I16_F80_PTR,
   FABI_F64x2_F64_PTR,
-  FABI_I32_I64_I64_V128_V128_I16,
-  FABI_I32_V128_V128_I16,
   FABI_UNKNOWN,
 };
 struct FallbackInfo {
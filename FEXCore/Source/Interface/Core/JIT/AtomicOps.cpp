@@ -9,7 +9,81 @@ $end_info$
 #include "Interface/Core/Dispatcher/Dispatcher.h"
 #include "Interface/Core/JIT/JITClass.h"
 
+#include <FEXCore/Utils/EnumUtils.h>
+
 namespace FEXCore::CPU {
+using FEXCore::ArchHelpers::Arm64::UnalignedAtomicOp;
+
+template<typename AtomicOpCaller>
+void Arm64JITCore::EmitUnalignedAtomicGuard(IR::OpSize Size, UnalignedAtomicOp Op, ARMEmitter::Register Addr, ARMEmitter::Register Value,
+                                            ARMEmitter::Register Expected, ARMEmitter::Register Dst, AtomicOpCaller&& EmitAtomic) {
+  const uint32_t Threshold = CTX->Config.UnalignedAtomicRecompileThreshold;
+  // 8-bit atomics can never be unaligned.
+  if (Size == IR::OpSize::i8Bit || Threshold == 0 || !CTX->UnalignedAtomicHotspots.IsHot(CurrentGuestRIP, Threshold)) {
+    EmitAtomic();
+    return;
+  }
+
+  ARMEmitter::ForwardLabel Unaligned;
+  ARMEmitter::ForwardLabel Done;
+
+  // This guest instruction has repeatedly faulted on unaligned addresses, check alignment up front.
+  // Doesn't touch NZCV so the atomic ops stay flag-preserving.
+  and_(ARMEmitter::Size::i64Bit, TMP1, Addr, IR::OpSizeToSize(Size) - 1);
+  (void)cbnz(ARMEmitter::Size::i64Bit, TMP1, &Unaligned);
+  EmitAtomic();
+  (void)b(&Done);
+
+  (void)Bind(&Unaligned);
+  mov(ARMEmitter::Size::i64Bit, TMP2, Addr);
+  mov(ARMEmitter::Size::i64Bit, TMP3, Value);
+  mov(ARMEmitter::Size::i64Bit, TMP4, Expected);
+
+  PushDynamicRegs(TMP1);
+  SpillStaticRegs(TMP1);
+
+  // x0 = Frame
+  // x1 = Addr
+  // x2 = Value
+  // x3 = Expected
+  // x4 = Op and size
+  mov(ARMEmitter::Size::i64Bit, ARMEmitter::Reg::r0, STATE.R());
+  if (!TMP_ABIARGS) {
+    mov(ARMEmitter::Size::i64Bit, ARMEmitter::Reg::r1, TMP2);
+    mov(ARMEmitter::Size::i64Bit, ARMEmitter::Reg::r2, TMP3);
+    mov(ARMEmitter::Size::i64Bit, ARMEmitter::Reg::r3, TMP4);
+  }
+  LoadConstant(ARMEmitter::Size::i64Bit, ARMEmitter::Reg::r4, (FEXCore::ToUnderlying(Op) << 8) | IR::OpSizeToSize(Size));
+
+#ifdef ARCHITECTURE_arm64ec
+  ldr(TMP2, ARMEmitter::XReg::x18, TEB_CPU_AREA_OFFSET);
+  LoadConstant(ARMEmitter::Size::i32Bit, TMP1, 1);
+  strb(TMP1.W(), TMP2, CPU_AREA_IN_SYSCALL_CALLBACK_OFFSET);
+#endif
+
+  ldr(ARMEmitter::XReg::x5, STATE, offsetof(FEXCore::Core::CpuStateFrame, Pointers.UnalignedAtomicFallback));
+  if (!CTX->Config.DisableVixlIndirectCalls) [[unlikely]] {
+    GenerateIndirectRuntimeCall<uint64_t, void*, uint64_t, uint64_t, uint64_t, uint64_t>(ARMEmitter::Reg::r5);
+  } else {
+    blr(ARMEmitter::Reg::r5);
+  }
+
+  if (!TMP_ABIARGS) {
+    mov(ARMEmitter::Size::i64Bit, TMP1, ARMEmitter::Reg::r0);
+  }
+
+#ifdef ARCHITECTURE_arm64ec
+  ldr(TMP2, ARMEmitter::XReg::x18, TEB_CPU_AREA_OFFSET);
+  strb(ARMEmitter::WReg::zr, TMP2, CPU_AREA_IN_SYSCALL_CALLBACK_OFFSET);
+#endif
+
+  FillStaticRegs();
+  PopDynamicRegs();
+
+  mov(ARMEmitter::Size::i64Bit, Dst, TMP1);
+  (void)Bind(&Done);
+}
+
 DEF_OP(CASPair) {
   auto Op = IROp->C<IR::IROp_CASPair>();
   LOGMAN_THROW_A_FMT(IROp->ElementSize == IR::OpSize::i32Bit || IROp->ElementSize == IR::OpSize::i64Bit, "Wrong element size");
@@ -102,40 +176,42 @@ DEF_OP(CAS) {
   auto MemSrc = GetReg(Op->Addr);
   auto Dst = GetReg(Node);
 
-  if (CTX->HostFeatures.SupportsAtomics) {
-    if (Expected == Dst && Dst != MemSrc && Dst != Desired) {
-      casal(SubEmitSize, Dst, Desired, MemSrc);
+  EmitUnalignedAtomicGuard(IROp->Size, UnalignedAtomicOp::CAS, MemSrc, Desired, Expected, Dst, [&] {
+    if (CTX->HostFeatures.SupportsAtomics) {
+      if (Expected == Dst && Dst != MemSrc && Dst != Desired) {
+        casal(SubEmitSize, Dst, Desired, MemSrc);
+      } else {
+        mov(EmitSize, TMP2, Expected);
+        casal(SubEmitSize, TMP2, Desired, MemSrc);
+        mov(EmitSize, Dst, TMP2.R());
+      }
     } else {
-      mov(EmitSize, TMP2, Expected);
-      casal(SubEmitSize, TMP2, Desired, MemSrc);
+      ARMEmitter::BackwardLabel LoopTop;
+      ARMEmitter::ForwardLabel LoopNotExpected;
+      ARMEmitter::ForwardLabel LoopExpected;
+      (void)Bind(&LoopTop);
+      ldaxr(SubEmitSize, TMP2, MemSrc);
+      if (IROp->Size == IR::OpSize::i8Bit) {
+        cmp(EmitSize, TMP2, Expected, ARMEmitter::ExtendedType::UXTB, 0);
+      } else if (IROp->Size == IR::OpSize::i16Bit) {
+        cmp(EmitSize, TMP2, Expected, ARMEmitter::ExtendedType::UXTH, 0);
+      } else {
+        cmp(EmitSize, TMP2, Expected);
+      }
+      (void)b(ARMEmitter::Condition::CC_NE, &LoopNotExpected);
+      stlxr(SubEmitSize, TMP3, Desired, MemSrc);
+      (void)cbnz(EmitSize, TMP3, &LoopTop);
+      mov(EmitSize, Dst, Expected);
+      (void)b(&LoopExpected);
+
+      (void)Bind(&LoopNotExpected);
       mov(EmitSize, Dst, TMP2.R());
+      // exclusive monitor needs to be cleared here
+      // Might have hit the case where ldaxr was hit but stlxr wasn't
+      clrex();
+      (void)Bind(&LoopExpected);
     }
-  } else {
-    ARMEmitter::BackwardLabel LoopTop;
-    ARMEmitter::ForwardLabel LoopNotExpected;
-    ARMEmitter::ForwardLabel LoopExpected;
-    (void)Bind(&LoopTop);
-    ldaxr(SubEmitSize, TMP2, MemSrc);
-    if (IROp->Size == IR::OpSize::i8Bit) {
-      cmp(EmitSize, TMP2, Expected, ARMEmitter::ExtendedType::UXTB, 0);
-    } else if (IROp->Size == IR::OpSize::i16Bit) {
-      cmp(EmitSize, TMP2, Expected, ARMEmitter::ExtendedType::UXTH, 0);
-    } else {
-      cmp(EmitSize, TMP2, Expected);
-    }
-    (void)b(ARMEmitter::Condition::CC_NE, &LoopNotExpected);
-    stlxr(SubEmitSize, TMP3, Desired, MemSrc);
-    (void)cbnz(EmitSize, TMP3, &LoopTop);
-    mov(EmitSize, Dst, Expected);
-    (void)b(&LoopExpected);
-
-    (void)Bind(&LoopNotExpected);
-    mov(EmitSize, Dst, TMP2.R());
-    // exclusive monitor needs to be cleared here
-    // Might have hit the case where ldaxr was hit but stlxr wasn't
-    clrex();
-    (void)Bind(&LoopExpected);
-  }
+  });
 }
 
 DEF_OP(AtomicSwap) {
@@ -155,16 +231,18 @@ DEF_OP(AtomicSwap) {
                            OpSize == IR::OpSize::i16Bit ? ARMEmitter::SubRegSize::i16Bit :
                                                           ARMEmitter::SubRegSize::i8Bit;
 
-  if (CTX->HostFeatures.SupportsAtomics) {
-    ldswpal(SubEmitSize, Src, GetReg(Node), MemSrc);
-  } else {
-    ARMEmitter::BackwardLabel LoopTop;
-    (void)Bind(&LoopTop);
-    ldaxr(SubEmitSize, TMP2, MemSrc);
-    stlxr(SubEmitSize, TMP4, Src, MemSrc);
-    (void)cbnz(EmitSize, TMP4, &LoopTop);
-    ubfm(EmitSize, GetReg(Node), TMP2, 0, IR::OpSizeAsBits(OpSize) - 1);
-  }
+  EmitUnalignedAtomicGuard(IROp->Size, UnalignedAtomicOp::Swap, MemSrc, Src, ARMEmitter::Reg::zr, GetReg(Node), [&] {
+    if (CTX->HostFeatures.SupportsAtomics) {
+      ldswpal(SubEmitSize, Src, GetReg(Node), MemSrc);
+    } else {
+      ARMEmitter::BackwardLabel LoopTop;
+      (void)Bind(&LoopTop);
+      ldaxr(SubEmitSize, TMP2, MemSrc);
+      stlxr(SubEmitSize, TMP4, Src, MemSrc);
+      (void)cbnz(EmitSize, TMP4, &LoopTop);
+      ubfm(EmitSize, GetReg(Node), TMP2, 0, IR::OpSizeAsBits(OpSize) - 1);
+    }
+  });
 }
 
 DEF_OP(AtomicFetchAdd) {
@@ -175,17 +253,19 @@ DEF_OP(AtomicFetchAdd) {
   auto MemSrc = GetReg(Op->Addr);
   auto Src = GetReg(Op->Value);
 
-  if (CTX->HostFeatures.SupportsAtomics) {
-    ldaddal(SubEmitSize, Src, GetReg(Node), MemSrc);
-  } else {
-    ARMEmitter::BackwardLabel LoopTop;
-    (void)Bind(&LoopTop);
-    ldaxr(SubEmitSize, TMP2, MemSrc);
-    add(EmitSize, TMP3, TMP2, Src);
-    stlxr(SubEmitSize, TMP4, TMP3, MemSrc);
-    (void)cbnz(EmitSize, TMP4, &LoopTop);
-    mov(EmitSize, GetReg(Node), TMP2.R());
-  }
+  EmitUnalignedAtomicGuard(IROp->Size, UnalignedAtomicOp::Add, MemSrc, Src, ARMEmitter::Reg::zr, GetReg(Node), [&] {
+    if (CTX->HostFeatures.SupportsAtomics) {
+      ldaddal(SubEmitSize, Src, GetReg(Node), MemSrc);
+    } else {
+      ARMEmitter::BackwardLabel LoopTop;
+      (void)Bind(&LoopTop);
+      ldaxr(SubEmitSize, TMP2, MemSrc);
+      add(EmitSize, TMP3, TMP2, Src);
+      stlxr(SubEmitSize, TMP4, TMP3, MemSrc);
+      (void)cbnz(EmitSize, TMP4, &LoopTop);
+      mov(EmitSize, GetReg(Node), TMP2.R());
+    }
+  });
 }
 
 DEF_OP(AtomicFetchSub) {
@@ -196,18 +276,20 @@ DEF_OP(AtomicFetchSub) {
   auto MemSrc = GetReg(Op->Addr);
   auto Src = GetReg(Op->Value);
 
-  if (CTX->HostFeatures.SupportsAtomics) {
-    neg(EmitSize, TMP2, Src);
-    ldaddal(SubEmitSize, TMP2, GetReg(Node), MemSrc);
-  } else {
-    ARMEmitter::BackwardLabel LoopTop;
-    (void)Bind(&LoopTop);
-    ldaxr(SubEmitSize, TMP2, MemSrc);
-    sub(EmitSize, TMP3, TMP2, Src);
-    stlxr(SubEmitSize, TMP4, TMP3, MemSrc);
-    (void)cbnz(EmitSize, TMP4, &LoopTop);
-    mov(EmitSize, GetReg(Node), TMP2.R());
-  }
+  EmitUnalignedAtomicGuard(IROp->Size, UnalignedAtomicOp::Sub, MemSrc, Src, ARMEmitter::Reg::zr, GetReg(Node), [&] {
+    if (CTX->HostFeatures.SupportsAtomics) {
+      neg(EmitSize, TMP2, Src);
+      ldaddal(SubEmitSize, TMP2, GetReg(Node), MemSrc);
+    } else {
+      ARMEmitter::BackwardLabel LoopTop;
+      (void)Bind(&LoopTop);
+      ldaxr(SubEmitSize, TMP2, MemSrc);
+      sub(EmitSize, TMP3, TMP2, Src);
+      stlxr(SubEmitSize, TMP4, TMP3, MemSrc);
+      (void)cbnz(EmitSize, TMP4, &LoopTop);
+      mov(EmitSize, GetReg(Node), TMP2.R());
+    }
+  });
 }
 
 DEF_OP(AtomicFetchAnd) {
@@ -218,18 +300,20 @@ DEF_OP(AtomicFetchAnd) {
   auto MemSrc = GetReg(Op->Addr);
   auto Src = GetReg(Op->Value);
 
-  if (CTX->HostFeatures.SupportsAtomics) {
-    mvn(EmitSize, TMP2, Src);
-    ldclral(SubEmitSize, TMP2, GetReg(Node), MemSrc);
-  } else {
-    ARMEmitter::BackwardLabel LoopTop;
-    (void)Bind(&LoopTop);
-    ldaxr(SubEmitSize, TMP2, MemSrc);
-    and_(EmitSize, TMP3, TMP2, Src);
-    stlxr(SubEmitSize, TMP4, TMP3, MemSrc);
-    (void)cbnz(EmitSize, TMP4, &LoopTop);
-    mov(EmitSize, GetReg(Node), TMP2.R());
-  }
+  EmitUnalignedAtomicGuard(IROp->Size, UnalignedAtomicOp::And, MemSrc, Src, ARMEmitter::Reg::zr, GetReg(Node), [&] {
+    if (CTX->HostFeatures.SupportsAtomics) {
+      mvn(EmitSize, TMP2, Src);
+      ldclral(SubEmitSize, TMP2, GetReg(Node), MemSrc);
+    } else {
+      ARMEmitter::BackwardLabel LoopTop;
+      (void)Bind(&LoopTop);
+      ldaxr(SubEmitSize, TMP2, MemSrc);
+      and_(EmitSize, TMP3, TMP2, Src);
+      stlxr(SubEmitSize, TMP4, TMP3, MemSrc);
+      (void)cbnz(EmitSize, TMP4, &LoopTop);
+      mov(EmitSize, GetReg(Node), TMP2.R());
+    }
+  });
 }
 
 DEF_OP(AtomicFetchCLR) {
@@ -240,17 +324,19 @@ DEF_OP(AtomicFetchCLR) {
   auto MemSrc = GetReg(Op->Addr);
   auto Src = GetReg(Op->Value);
 
-  if (CTX->HostFeatures.SupportsAtomics) {
-    ldclral(SubEmitSize, Src, GetReg(Node), MemSrc);
-  } else {
-    ARMEmitter::BackwardLabel LoopTop;
-    (void)Bind(&LoopTop);
-    ldaxr(SubEmitSize, TMP2, MemSrc);
-    bic(EmitSize, TMP3, TMP2, Src);
-    stlxr(SubEmitSize, TMP4, TMP3, MemSrc);
-    (void)cbnz(EmitSize, TMP4, &LoopTop);
-    mov(EmitSize, GetReg(Node), TMP2.R());
-  }
+  EmitUnalignedAtomicGuard(IROp->Size, UnalignedAtomicOp::CLR, MemSrc, Src, ARMEmitter::Reg::zr, GetReg(Node), [&] {
+    if (CTX->HostFeatures.SupportsAtomics) {
+      ldclral(SubEmitSize, Src, GetReg(Node), MemSrc);
+    } else {
+      ARMEmitter::BackwardLabel LoopTop;
+      (void)Bind(&LoopTop);
+      ldaxr(SubEmitSize, TMP2, MemSrc);
+      bic(EmitSize, TMP3, TMP2, Src);
+      stlxr(SubEmitSize, TMP4, TMP3, MemSrc);
+      (void)cbnz(EmitSize, TMP4, &LoopTop);
+      mov(EmitSize, GetReg(Node), TMP2.R());
+    }
+  });
 }
 
 DEF_OP(AtomicFetchOr) {
@@ -261,17 +347,19 @@ DEF_OP(AtomicFetchOr) {
   auto MemSrc = GetReg(Op->Addr);
   auto Src = GetReg(Op->Value);
 
-  if (CTX->HostFeatures.SupportsAtomics) {
-    ldsetal(SubEmitSize, Src, GetReg(Node), MemSrc);
-  } else {
-    ARMEmitter::BackwardLabel LoopTop;
-    (void)Bind(&LoopTop);
-    ldaxr(SubEmitSize, TMP2, MemSrc);
-    orr(EmitSize, TMP3, TMP2, Src);
-    stlxr(SubEmitSize, TMP4, TMP3, MemSrc);
-    (void)cbnz(EmitSize, TMP4, &LoopTop);
-    mov(EmitSize, GetReg(Node), TMP2.R());
-  }
+  EmitUnalignedAtomicGuard(IROp->Size, UnalignedAtomicOp::Or, MemSrc, Src, ARMEmitter::Reg::zr, GetReg(Node), [&] {
+    if (CTX->HostFeatures.SupportsAtomics) {
+      ldsetal(SubEmitSize, Src, GetReg(Node), MemSrc);
+    } else {
+      ARMEmitter::BackwardLabel LoopTop;
+      (void)Bind(&LoopTop);
+      ldaxr(SubEmitSize, TMP2, MemSrc);
+      orr(EmitSize, TMP3, TMP2, Src);
+      stlxr(SubEmitSize, TMP4, TMP3, MemSrc);
+      (void)cbnz(EmitSize, TMP4, &LoopTop);
+      mov(EmitSize, GetReg(Node), TMP2.R());
+    }
+  });
 }
 
 DEF_OP(AtomicFetchXor) {
@@ -282,17 +370,19 @@ DEF_OP(AtomicFetchXor) {
   auto MemSrc = GetReg(Op->Addr);
   auto Src = GetReg(Op->Value);
 
-  if (CTX->HostFeatures.SupportsAtomics) {
-    ldeoral(SubEmitSize, Src, GetReg(Node), MemSrc);
-  } else {
-    ARMEmitter::BackwardLabel LoopTop;
-    (void)Bind(&LoopTop);
-    ldaxr(SubEmitSize, TMP2, MemSrc);
-    eor(EmitSize, TMP3, TMP2, Src);
-    stlxr(SubEmitSize, TMP4, TMP3, MemSrc);
-    (void)cbnz(EmitSize, TMP4, &LoopTop);
-    mov(EmitSize, GetReg(Node), TMP2.R());
-  }
+  EmitUnalignedAtomicGuard(IROp->Size, UnalignedAtomicOp::Xor, MemSrc, Src, ARMEmitter::Reg::zr, GetReg(Node), [&] {
+    if (CTX->HostFeatures.SupportsAtomics) {
+      ldeoral(SubEmitSize, Src, GetReg(Node), MemSrc);
+    } else {
+      ARMEmitter::BackwardLabel LoopTop;
+      (void)Bind(&LoopTop);
+      ldaxr(SubEmitSize, TMP2, MemSrc);
+      eor(EmitSize, TMP3, TMP2, Src);
+      stlxr(SubEmitSize, TMP4, TMP3, MemSrc);
+      (void)cbnz(EmitSize, TMP4, &LoopTop);
+      mov(EmitSize, GetReg(Node), TMP2.R());
+    }
+  });
 }
 
 DEF_OP(AtomicFetchNeg) {
@@ -302,26 +392,28 @@ DEF_OP(AtomicFetchNeg) {
 
   auto MemSrc = GetReg(Op->Addr);
 
-  if (CTX->HostFeatures.SupportsAtomics) {
-    // Use a CAS loop to avoid needing to emulate unaligned LLSC atomics
-    ldr(SubEmitSize, TMP2, MemSrc);
-    ARMEmitter::BackwardLabel LoopTop;
-    (void)Bind(&LoopTop);
-    mov(EmitSize, TMP4, TMP2);
-    neg(EmitSize, TMP3, TMP2);
-    casal(SubEmitSize, TMP2, TMP3, MemSrc);
-    sub(EmitSize, TMP3, TMP2, TMP4);
-    (void)cbnz(EmitSize, TMP3, &LoopTop);
-    mov(EmitSize, GetReg(Node), TMP2.R());
-  } else {
-    ARMEmitter::BackwardLabel LoopTop;
-    (void)Bind(&LoopTop);
-    ldaxr(SubEmitSize, TMP2, MemSrc);
-    neg(EmitSize, TMP3, TMP2);
-    stlxr(SubEmitSize, TMP4, TMP3, MemSrc);
-    (void)cbnz(EmitSize, TMP4, &LoopTop);
-    mov(EmitSize, GetReg(Node), TMP2.R());
-  }
+  EmitUnalignedAtomicGuard(IROp->Size, UnalignedAtomicOp::Neg, MemSrc, ARMEmitter::Reg::zr, ARMEmitter::Reg::zr, GetReg(Node), [&] {
+    if (CTX->HostFeatures.SupportsAtomics) {
+      // Use a CAS loop to avoid needing to emulate unaligned LLSC atomics
+      ldr(SubEmitSize, TMP2, MemSrc);
+      ARMEmitter::BackwardLabel LoopTop;
+      (void)Bind(&LoopTop);
+      mov(EmitSize, TMP4, TMP2);
+      neg(EmitSize, TMP3, TMP2);
+      casal(SubEmitSize, TMP2, TMP3, MemSrc);
+      sub(EmitSize, TMP3, TMP2, TMP4);
+      (void)cbnz(EmitSize, TMP3, &LoopTop);
+      mov(EmitSize, GetReg(Node), TMP2.R());
+    } else {
+      ARMEmitter::BackwardLabel LoopTop;
+      (void)Bind(&LoopTop);
+      ldaxr(SubEmitSize, TMP2, MemSrc);
+      neg(EmitSize, TMP3, TMP2);
+      stlxr(SubEmitSize, TMP4, TMP3, MemSrc);
+      (void)cbnz(EmitSize, TMP4, &LoopTop);
+      mov(EmitSize, GetReg(Node), TMP2.R());
+    }
+  });
 }
 
 DEF_OP(TelemetrySetValue) {
@@ -21,7 +21,8 @@ namespace FEXCore::CPU {
 
 DEF_OP(CallbackReturn) {
   // spill back to CTX
-  SpillStaticRegs(TMP1);
+  // Vector registers are caller-saved, skip them. The Thunk op waiting for this callback refills them from CTX.
+  SpillStaticRegs(TMP1, false);
 
   // First we must reset the stack
   ResetStack();
@@ -316,6 +317,62 @@ DEF_OP(Syscall) {
   }
 }
 
+DEF_OP(InlineSyscall) {
+#ifdef ARCHITECTURE_arm64ec
+  LOGMAN_MSG_A_FMT("InlineSyscall is unsupported on ARM64EC");
+#else
+  auto Op = IROp->C<IR::IROp_InlineSyscall>();
+  // Arguments are passed as follows:
+  // X8: Host syscall number
+  // X0-X5: Arguments, passed through unmodified
+  //
+  // Only the static registers that intersect the host syscall ABI need to be spilled, everything else is preserved by the kernel.
+  uint32_t SpillMask = (1U << 4) | (1U << 5) | (1U << 8);
+
+  // Ordering is incredibly important here, the same as ProcessorID.
+  // Spill the overlapping registers first THEN claim we are in a syscall without invalidating state at all.
+  SpillStaticRegs(TMP1, false, SpillMask);
+
+  // The upper 48 bits hold the address of the `svc`, so the signal handler can tell whether the syscall has completed.
+  ARMEmitter::ForwardLabel l_Svc;
+  (void)adr(TMP1, &l_Svc);
+  lsl(ARMEmitter::Size::i64Bit, TMP1, TMP1, 16);
+  movk(ARMEmitter::Size::i64Bit, TMP1, SpillMask & 0xFFFF);
+  str(TMP1, STATE, offsetof(FEXCore::Core::CpuStateFrame, InSyscallInfo));
+
+  // The first four arguments can never live in x0-x3 since those are temporaries.
+  for (uint32_t i = 0; i < 4; ++i) {
+    if (!Op->Header.Args[i].IsInvalid()) {
+      mov(ARMEmitter::Size::i64Bit, ARMEmitter::Register(i), GetReg(Op->Header.Args[i]));
+    }
+  }
+
+  // The last two may be sourced from x4/x5 themselves, so go through the stack to avoid clobbering one with the other.
+  const bool HasArg4 = !Op->Header.Args[4].IsInvalid();
+  const bool HasArg5 = !Op->Header.Args[5].IsInvalid();
+  if (HasArg4 && HasArg5) {
+    stp<ARMEmitter::IndexType::PRE>(GetReg(Op->Header.Args[4]).X(), GetReg(Op->Header.Args[5]).X(), ARMEmitter::Reg::rsp, -16);
+    ldp<ARMEmitter::IndexType::POST>(ARMEmitter::XReg::x4, ARMEmitter::XReg::x5, ARMEmitter::Reg::rsp, 16);
+  } else if (HasArg4) {
+    mov(ARMEmitter::Size::i64Bit, ARMEmitter::Reg::r4, GetReg(Op->Header.Args[4]));
+  }
+
+  LoadConstant(ARMEmitter::Size::i64Bit, ARMEmitter::Reg::r8, Op->HostSyscallNumber);
+  (void)Bind(&l_Svc);
+  svc(0);
+  // A signal can arrive RIGHT HERE, past this point the signal handler takes x0 as the guest result.
+
+  // Peel back the state, x0 must stay intact until we are no longer in a syscall.
+  FillStaticRegs(false, SpillMask, ~0U, ARMEmitter::Reg::r1, ARMEmitter::Reg::r2);
+
+  // Now the registers we've spilled are back in their original host registers
+  // We can safely claim we are no longer in a syscall
+  str(ARMEmitter::XReg::zr, STATE, offsetof(FEXCore::Core::CpuStateFrame, InSyscallInfo));
+
+  mov(ARMEmitter::Size::i64Bit, GetReg(Node), ARMEmitter::Reg::r0);
+#endif
+}
+
 DEF_OP(Thunk) {
   auto Op = IROp->C<IR::IROp_Thunk>();
   // Arguments are passed as follows:
@@ -328,7 +385,7 @@ DEF_OP(Thunk) {
 
   mov(ARMEmitter::Size::i64Bit, ARMEmitter::Reg::r0, GetReg(Op->ArgPtr));
 
-  InsertNamedThunkRelocation(ARMEmitter::Reg::r2, Op->ThunkNameHash);
+  InsertNamedThunkRelocation(ARMEmitter::Reg::r2, Op->ThunkNameHash, false);
   if (!CTX->Config.DisableVixlIndirectCalls) [[unlikely]] {
     GenerateIndirectRuntimeCall<void, void*, void*>(ARMEmitter::Reg::r2);
   } else {
@@ -340,6 +397,46 @@ DEF_OP(Thunk) {
   FillStaticRegs(true, ~0U, ~0U, std::nullopt, std::nullopt, false); // load from ctx after ra64 refill
 }
 
+DEF_OP(ThunkRegisterABI) {
+  auto Op = IROp->C<IR::IROp_ThunkRegisterABI>();
+  // Arguments are passed as follows:
+  // X0-X5: Guest argument registers, passed through unmodified
+  // X6: Host function
+  //
+  // The full guest state is still spilled so that signals observe a consistent context.
+  // The host function preserves x19-x29 per AAPCS64, so only the caller-saved static registers need to be filled afterwards.
+
+  SpillStaticRegs(TMP1, true, ~0U, ~0U, false);
+
+  PushDynamicRegs(TMP1);
+
+  // The first four arguments can never live in x0-x3 since those are temporaries.
+  for (uint32_t i = 0; i < 4; ++i) {
+    mov(ARMEmitter::Size::i64Bit, ARMEmitter::Register(i), GetReg(Op->Header.Args[i]));
+  }
+
+  // The last two may be sourced from x4/x5 themselves, so go through the stack to avoid clobbering one with the other.
+  stp<ARMEmitter::IndexType::PRE>(GetReg(Op->Arg4).X(), GetReg(Op->Arg5).X(), ARMEmitter::Reg::rsp, -16);
+  ldp<ARMEmitter::IndexType::POST>(ARMEmitter::XReg::x4, ARMEmitter::XReg::x5, ARMEmitter::Reg::rsp, 16);
+
+  InsertNamedThunkRelocation(ARMEmitter::Reg::r6, Op->ThunkNameHash, true);
+  if (!CTX->Config.DisableVixlIndirectCalls) [[unlikely]] {
+    GenerateIndirectRuntimeCall<uint64_t, uint64_t, uint64_t, uint64_t, uint64_t, uint64_t, uint64_t>(ARMEmitter::Reg::r6);
+  } else {
+    blr(ARMEmitter::Reg::r6);
+  }
+
+  if (!TMP_ABIARGS) {
+    mov(ARMEmitter::Size::i64Bit, TMP1, ARMEmitter::Reg::r0);
+  }
+
+  PopDynamicRegs();
+
+  FillStaticRegs(true, CALLER_GPR_MASK, ~0U, std::nullopt, std::nullopt, false);
+
+  mov(ARMEmitter::Size::i64Bit, GetReg(Node), TMP1);
+}
+
 DEF_OP(ValidateCode) {
   auto Op = IROp->C<IR::IROp_ValidateCode>();
   auto OldCode = Op->CodeOriginal.data();
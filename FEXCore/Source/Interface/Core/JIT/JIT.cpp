@@ -424,65 +424,6 @@ void Arm64JITCore::Op_Unhandled(const IR::IROp_Header* IROp, IR::Ref Node) {
       FillF80Result();
     } break;
 
-    case FABI_I32_I64_I64_V128_V128_I16: {
-      // Linux Reg/Win32 Reg:
-      // stack: FallbackHandler
-      // x30: return
-      // vtmp1 (v0/v16): vector source 1
-      // vtmp2 (v1/v17): vector source 2
-      // tmp1 (x0/x10): source 1
-      // tmp2 (x1/x11): source 2
-      // tmp3 (x2/x12): source 3
-      const auto Op = IROp->C<IR::IROp_VPCMPESTRX>();
-      ldr(TMP4, STATE_PTR(CpuStateFrame, Pointers.FallbackHandlerPointers[Info.HandlerIndex].ABIHandler));
-      ldr(TMP1, STATE_PTR(CpuStateFrame, Pointers.FallbackHandlerPointers[Info.HandlerIndex].Func));
-
-      stp<ARMEmitter::IndexType::PRE>(TMP1, ARMEmitter::XReg::lr, ARMEmitter::Reg::rsp, -16);
-
-      const auto SrcRAX = GetReg(Op->RAX);
-      const auto SrcRDX = GetReg(Op->RDX);
-      const auto Control = Op->Control;
-
-      mov(TMP1, SrcRAX.X());
-      mov(TMP2, SrcRDX.X());
-      movz(ARMEmitter::Size::i32Bit, TMP3, Control);
-
-      const auto Src1 = GetVReg(Op->LHS);
-      const auto Src2 = GetVReg(Op->RHS);
-
-      mov(VTMP1.Q(), Src1.Q());
-      mov(VTMP2.Q(), Src2.Q());
-
-      blr(TMP4);
-
-      ldp<ARMEmitter::IndexType::POST>(ARMEmitter::XReg::zr, ARMEmitter::XReg::lr, ARMEmitter::Reg::rsp, 16);
-      FillI32Result();
-    } break;
-    case FABI_I32_V128_V128_I16: {
-      // Linux Reg/Win32 Reg:
-      // tmp4 (x4/x13): FallbackHandler
-      // x30: return
-      // vtmp1 (v0/v16): vector source 1
-      // vtmp2 (v1/v17): vector source 2
-      // tmp1 (x0/x10): source 1
-      const auto Op = IROp->C<IR::IROp_VPCMPISTRX>();
-      str<ARMEmitter::IndexType::PRE>(ARMEmitter::XReg::lr, ARMEmitter::Reg::rsp, -16);
-
-      const auto Src1 = GetVReg(Op->LHS);
-      const auto Src2 = GetVReg(Op->RHS);
-      const auto Control = Op->Control;
-
-      mov(VTMP1.Q(), Src1.Q());
-      mov(VTMP2.Q(), Src2.Q());
-      movz(ARMEmitter::Size::i32Bit, TMP1, Control);
-
-      ldr(TMP2, STATE_PTR(CpuStateFrame, Pointers.FallbackHandlerPointers[Info.HandlerIndex].ABIHandler));
-      ldr(TMP4, STATE_PTR(CpuStateFrame, Pointers.FallbackHandlerPointers[Info.HandlerIndex].Func));
-      blr(TMP2);
-
-      ldr<ARMEmitter::IndexType::POST>(ARMEmitter::XReg::lr, ARMEmitter::Reg::rsp, 16);
-      FillI32Result();
-    } break;
     case FABI_UNKNOWN:
     default:
 #if defined(ASSERTIONS_ENABLED) && ASSERTIONS_ENABLED
@@ -638,6 +579,7 @@ Arm64JITCore::Arm64JITCore(FEXCore::Context::ContextImpl* ctx, FEXCore::Core::In
     Ptrs.PrintVectorValue = reinterpret_cast<uint64_t>(PrintVectorValue);
     Ptrs.ThreadRemoveCodeEntryFromJIT = reinterpret_cast<uintptr_t>(&Context::ContextImpl::ThreadRemoveCodeEntryFromJit);
     Ptrs.MonoBackpatcherWrite = reinterpret_cast<uint64_t>(&Context::ContextImpl::MonoBackpatcherWrite);
+    Ptrs.UnalignedAtomicFallback = reinterpret_cast<uint64_t>(&Context::ContextImpl::UnalignedAtomicFallback);
     Ptrs.CPUIDObj = reinterpret_cast<uint64_t>(&CTX->CPUID);
 
     {
@@ -809,6 +751,34 @@ void Arm64JITCore::EmitEntryPoint(ARMEmitter::BackwardLabel& HeaderLabel, bool C
   EmitSuspendInterruptCheck();
 }
 
+void Arm64JITCore::EmitExecutionCounterIncrement(ARMEmitter::ForwardLabel& TailLabel, uint64_t BlockStartRIP) {
+  const auto Index = CountedEntryPoints.size();
+  CountedEntryPoints.push_back(BlockStartRIP);
+
+  // The counters aren't known until the block is finalized, so load them through the tail.
+  adr_OrRestart(TMP1, &TailLabel);
+  ldr(TMP1, TMP1, offsetof(JITCodeTail, ExecutionCounters));
+
+  const auto CounterOffset = Index * sizeof(FEXCore::Context::BlockExecutionCounters::Entry) +
+                             offsetof(FEXCore::Context::BlockExecutionCounters::Entry, Count);
+  if (ARMEmitter::IsImmAddSub(CounterOffset)) {
+    add(ARMEmitter::Size::i64Bit, TMP1, TMP1, CounterOffset);
+  } else {
+    LoadConstant(ARMEmitter::Size::i64Bit, TMP2, CounterOffset);
+    add(ARMEmitter::Size::i64Bit, TMP1, TMP1, TMP2);
+  }
+
+  if (CTX->HostFeatures.SupportsAtomics) {
+    movz(ARMEmitter::Size::i64Bit, TMP2, 1);
+    stadd(ARMEmitter::SubRegSize::i64Bit, TMP2, TMP1);
+  } else {
+    // Without LSE racing increments can be lost, which is fine for profiling.
+    ldr(TMP2, TMP1);
+    add(ARMEmitter::Size::i64Bit, TMP2, TMP2, 1);
+    str(TMP2, TMP1);
+  }
+}
+
 CPUBackend::CompiledCode Arm64JITCore::CompileCode(uint64_t Entry, uint64_t Size, bool SingleInst, const FEXCore::IR::IRListView* IR,
                                                    FEXCore::Core::DebugData* DebugData, bool CheckTF) {
   FEXCORE_PROFILE_SCOPED("Arm64::CompileCode");
@@ -816,6 +786,7 @@ CPUBackend::CompiledCode Arm64JITCore::CompileCode(uint64_t Entry, uint64_t Size
   const auto PrevNumAllocations = Relocations.size();
 
   this->Entry = Entry;
+  this->CurrentGuestRIP = Entry;
   this->DebugData = DebugData;
   this->IR = IR;
   RequiresFarARM64Jumps = false;
@@ -840,6 +811,7 @@ CPUBackend::CompiledCode Arm64JITCore::CompileCode(uint64_t Entry, uint64_t Size
   JumpTargets.clear();
   CallReturnTargets.clear();
   PendingJumpThunks.clear();
+  CountedEntryPoints.clear();
   JumpTargets.resize(IR->GetHeader()->BlockCount, {});
 
   CodeData.EntryPoints.clear();
@@ -869,6 +841,10 @@ CPUBackend::CompiledCode Arm64JITCore::CompileCode(uint64_t Entry, uint64_t Size
 
   auto CodeBegin = GetCursorAddress<uint8_t*>();
 
+  // Code caches are generated uninstrumented, since the counter storage only exists in this process.
+  const bool CountExecutions = CTX->BlockCounters && !CTX->GetCodeCache().IsGeneratingCache;
+  ARMEmitter::ForwardLabel JITCodeTailLabel {};
+
   // AAPCS64
   // r30      = LR
   // r29      = FP
@@ -930,8 +906,12 @@ CPUBackend::CompiledCode Arm64JITCore::CompileCode(uint64_t Entry, uint64_t Size
 
         BindOrRestart(&IsReturnTarget->second);
         CodeData.EntryPoints.emplace(BlockStartRIP, GetCursorAddress<uint8_t*>());
+        CurrentGuestRIP = BlockStartRIP;
         DebugData->GuestOpcodes.push_back({BlockIROp->GuestEntryOffset, GetCursorAddress<uint8_t*>() - CodeData.BlockBegin});
 
+        if (CountExecutions) {
+          EmitExecutionCounterIncrement(JITCodeTailLabel, BlockStartRIP);
+        }
         EmitEntryPoint(JITCodeHeaderLabel, CheckTF);
       }
 
@@ -1002,10 +982,14 @@ CPUBackend::CompiledCode Arm64JITCore::CompileCode(uint64_t Entry, uint64_t Size
   Align(alignof(JITCodeTail));
   const auto JITBlockTailLocation = GetCursorAddress<uint8_t*>();
   CodeHeader->OffsetToBlockTail = JITBlockTailLocation - CodeData.BlockBegin;
+  if (CountExecutions) {
+    BindOrRestart(&JITCodeTailLabel);
+  }
 
   JITCodeTail JITBlockTail {
     .RIP = Entry,
     .GuestSize = Size,
+    .ExecutionCounters = 0,
     .SpinLockFutex = 0,
     .SingleInst = SingleInst,
   };
@@ -1055,6 +1039,15 @@ CPUBackend::CompiledCode Arm64JITCore::CompileCode(uint64_t Entry, uint64_t Size
 
   // Finalize and write block tail data
   JITBlockTail.Size = CodeData.Size;
+  if (!CountedEntryPoints.empty()) {
+    auto Counters = CTX->BlockCounters->Allocate(CountedEntryPoints.size());
+    for (size_t i = 0; i < CountedEntryPoints.size(); ++i) {
+      Counters[i].RIP = CountedEntryPoints[i];
+      Counters[i].GuestSize = Size;
+      Counters[i].HostSize = CodeData.Size;
+    }
+    JITBlockTail.ExecutionCounters = reinterpret_cast<uintptr_t>(Counters);
+  }
   {
     auto PrevCur = GetCursorOffset();
     memcpy(JITBlockTailLocation, &JITBlockTail, sizeof(JITBlockTail));
@@ -18,6 +18,7 @@ $end_info$
 #include <FEXCore/Config/Config.h>
 #include <FEXCore/Core/CoreState.h>
 #include <FEXCore/IR/IR.h>
+#include <FEXCore/Utils/ArchHelpers/Arm64.h>
 #include <FEXCore/Utils/LogManager.h>
 #include <FEXCore/fextl/map.h>
 #include <FEXCore/fextl/memory.h>
@@ -87,6 +88,8 @@ private:
   FEXCore::Context::ContextImpl* CTX {};
   const FEXCore::IR::IRListView* IR {};
   uint64_t Entry {};
+  // Guest RIP of the instruction currently being emitted, tracked through GuestOpcode markers.
+  uint64_t CurrentGuestRIP {};
   CPUBackend::CompiledCode CodeData {};
 
   fextl::vector<ARMEmitter::BiDirectionalLabel> JumpTargets;
@@ -105,6 +108,10 @@ private:
   };
   fextl::vector<PendingJumpThunk> PendingJumpThunks;
 
+  // Guest RIPs of the entrypoints instrumented with an execution counter, in emission order.
+  // Indexes match the BlockExecutionCounters entries the block's JITCodeTail points to.
+  fextl::vector<uint64_t> CountedEntryPoints;
+
   Utils::PoolBufferWithTimedRetirement<uint8_t*, 5000, 500> TempAllocator;
 
   static uint64_t ExitFunctionLink(FEXCore::Core::CpuStateFrame* Frame, FEXCore::Context::ExitFunctionLinkData* Record);
@@ -551,7 +558,7 @@ private:
    * @param Reg - The GPR to move the thunk handler in to
    * @param Sum - The hash of the thunk
    */
-  void InsertNamedThunkRelocation(ARMEmitter::Register Reg, const IR::SHA256Sum& Sum);
+  void InsertNamedThunkRelocation(ARMEmitter::Register Reg, const IR::SHA256Sum& Sum, bool RegisterABI);
 
   /**
    * @brief Inserts a guest GPR move relocation
@@ -620,12 +627,21 @@ private:
                            std::optional<ARMEmitter::VRegister> VectorIndexHigh, ARMEmitter::VRegister MaskReg, IR::OpSize VectorIndexSize,
                            size_t DataElementOffsetStart, size_t IndexElementOffsetStart, uint8_t OffsetScale, IR::OpSize AddrSize);
 
+  // Wraps an atomic with an inline alignment check if the current guest RIP is an unaligned atomic hotspot.
+  // Unaligned addresses call the emulation helper directly instead of taking the SIGBUS.
+  template<typename AtomicOpCaller>
+  void EmitUnalignedAtomicGuard(IR::OpSize Size, FEXCore::ArchHelpers::Arm64::UnalignedAtomicOp Op, ARMEmitter::Register Addr,
+                                ARMEmitter::Register Value, ARMEmitter::Register Expected, ARMEmitter::Register Dst, AtomicOpCaller&& EmitAtomic);
+
   void EmitTFCheck();
 
   void EmitSuspendInterruptCheck();
 
   void EmitEntryPoint(ARMEmitter::BackwardLabel& HeaderLabel, bool CheckTF);
 
+  // Increments the execution counter for the entrypoint at BlockStartRIP, loaded through the JITCodeTail at TailLabel.
+  void EmitExecutionCounterIncrement(ARMEmitter::ForwardLabel& TailLabel, uint64_t BlockStartRIP);
+
 #define DEF_OP(x) void Op_##x(IR::IROp_Header const* IROp, IR::Ref Node)
 
   ///< Unhandled handler
@@ -42,6 +42,7 @@ DEF_OP(WFET) {
 DEF_OP(GuestOpcode) {
   auto Op = IROp->C<IR::IROp_GuestOpcode>();
   // metadata
+  CurrentGuestRIP = Entry + Op->GuestEntryOffset;
   DebugData->GuestOpcodes.push_back({Op->GuestEntryOffset, GetCursorAddress<uint8_t*>() - CodeData.BlockBegin});
 }
 
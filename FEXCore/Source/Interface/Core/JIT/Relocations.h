@@ -25,6 +25,10 @@ enum class RelocationTypes : uint32_t {
   // 4 instruction constant generation
   // Aligned to struct RelocGuestRIP
   RELOC_GUEST_RIP_MOVE,
+
+  // Same as RELOC_NAMED_THUNK_MOVE, for a thunk called with the register ABI
+  // Aligned to struct RelocNamedThunkMove
+  RELOC_NAMED_REGISTER_ABI_THUNK_MOVE,
 };
 
 struct FEX_PACKED RelocationHeader final {
@@ -1022,8 +1022,16 @@ DEF_OP(LoadNamedVectorIndexedConstant) {
   case IR::OpSize::i64Bit: ldr(Dst.D(), TMP1, Op->Index); break;
   case IR::OpSize::i128Bit: ldr(Dst.Q(), TMP1, Op->Index); break;
   case IR::OpSize::i256Bit: {
-    add(ARMEmitter::Size::i64Bit, TMP1, TMP1, Op->Index);
-    ld1b<ARMEmitter::SubRegSize::i8Bit>(Dst.Z(), PRED_TMP_32B.Zeroing(), TMP1, 0);
+    // 256-bit tables can have more entries than an add immediate can index.
+    if (ARMEmitter::IsImmAddSub(Op->Index)) {
+      if (Op->Index) {
+        add(ARMEmitter::Size::i64Bit, TMP1, TMP1, Op->Index);
+      }
+      ld1b<ARMEmitter::SubRegSize::i8Bit>(Dst.Z(), PRED_TMP_32B.Zeroing(), TMP1, 0);
+    } else {
+      LoadConstant(ARMEmitter::Size::i64Bit, TMP2, Op->Index);
+      ld1b<ARMEmitter::SubRegSize::i8Bit>(Dst.Z(), PRED_TMP_32B.Zeroing(), TMP1.R(), TMP2.R());
+    }
     break;
   }
   default: LOGMAN_MSG_A_FMT("Unhandled {} size: {}", __func__, OpSize); break;
@@ -0,0 +1,99 @@
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#include <FEXCore/fextl/vector.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+
+namespace FEXCore::Frontend {
+// Bounds the worst-case stall caused by the JIT on a single thread.
+//
+// Every compile adds its duration to the current time window. Once a thread spent more than its budget of a window
+// compiling, blocks are decoded with a small instruction limit and without multiblock until a window passes under budget.
+// The entrypoints of those reduced blocks are remembered and handed back one at a time once the pressure is gone, so the
+// caller can drop them from its caches and let them get recompiled at full size.
+class JITBudget final {
+public:
+  // Instruction limit of blocks compiled while over budget.
+  constexpr static uint64_t REDUCED_MAX_INST = 32;
+
+  // Percent of each window that can be spent compiling, 0 disables the budget.
+  void Initialize(uint32_t BudgetPercent) {
+    Budget = WINDOW * std::min<uint32_t>(BudgetPercent, 100) / 100;
+    Enabled = BudgetPercent != 0;
+  }
+
+  [[nodiscard]]
+  bool IsEnabled() const {
+    return Enabled;
+  }
+
+  static uint64_t Now() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+  }
+
+  // Returns true if the next block should be compiled reduced.
+  [[nodiscard]]
+  bool UnderPressure() {
+    if (!Enabled) {
+      return false;
+    }
+
+    Advance(Now());
+    // The previous window counts too, otherwise the first compile of every window would be unbounded.
+    return std::max(CurrentTime, PreviousTime) > Budget;
+  }
+
+  void Accumulate(uint64_t Begin, uint64_t End) {
+    if (!Enabled) {
+      return;
+    }
+
+    Advance(End);
+    CurrentTime += End - Begin;
+  }
+
+  void RecordReducedBlock(uint64_t Entry) {
+    // Bounded, anything past this just stays reduced until it gets invalidated for other reasons.
+    if (ReducedBlocks.size() < MAX_REDUCED_BLOCKS) {
+      ReducedBlocks.emplace_back(Entry);
+    }
+  }
+
+  // Returns a reduced block to promote, only when the thread has been comfortably under budget for a full window.
+  std::optional<uint64_t> PopPromotableBlock() {
+    if (ReducedBlocks.empty() || UnderPressure() || PreviousTime > Budget / 2) {
+      return std::nullopt;
+    }
+
+    const auto Entry = ReducedBlocks.back();
+    ReducedBlocks.pop_back();
+    return Entry;
+  }
+
+private:
+  constexpr static uint64_t WINDOW = std::chrono::nanoseconds(std::chrono::milliseconds(16)).count();
+  constexpr static size_t MAX_REDUCED_BLOCKS = 4096;
+
+  void Advance(uint64_t Time) {
+    if (Time - WindowStart < WINDOW) {
+      return;
+    }
+
+    // An idle gap of more than a window means the previous window was empty.
+    PreviousTime = Time - WindowStart < WINDOW * 2 ? CurrentTime : 0;
+    CurrentTime = 0;
+    WindowStart = Time;
+  }
+
+  uint64_t Budget {};
+  uint64_t WindowStart {};
+  uint64_t CurrentTime {};
+  uint64_t PreviousTime {};
+  bool Enabled {};
+  fextl::vector<uint64_t> ReducedBlocks;
+};
+} // namespace FEXCore::Frontend
@@ -329,6 +329,26 @@ public:
     }
   }
 
+  // Removes the entrypoints in [Start, Start + Length) from the shared guest to host map and this thread's L1/L2.
+  // Other entrypoints on the same pages stay mapped.
+  void InvalidateBlockRange(uint64_t Start, uint64_t Length) {
+    auto lk = Shared->AcquireWriteLock();
+
+    Shared->Erase(Start, lk);
+    InvalidateCache(Start, lk);
+
+    auto lower = Shared->CodePages.lower_bound(Start >> 12);
+    auto upper = Shared->CodePages.upper_bound((Start + Length - 1) >> 12);
+    for (auto it = lower; it != upper; it++) {
+      for (const auto& Entry : it->second) {
+        if (Entry > Start && Entry < Start + Length) {
+          Shared->Erase(Entry, lk);
+          InvalidateCache(Entry, lk);
+        }
+      }
+    }
+  }
+
   // Invalidates all L1/L2 entries for all guest block that intersect the given range
   bool InvalidateCacheRange(uint64_t Start, uint64_t Length) {
     auto lk = Shared->AcquireWriteLock();
@@ -17,6 +17,7 @@ $end_info$
 #include <FEXCore/Config/Config.h>
 #include <FEXCore/Core/Context.h>
 #include <FEXCore/Core/CoreState.h>
+#include <FEXCore/Core/Thunks.h>
 #include <FEXCore/Core/X86Enums.h>
 #include <FEXCore/HLE/SyscallHandler.h>
 #include <FEXCore/IR/IR.h>
@@ -94,6 +95,30 @@ void OpDispatchBuilder::SyscallOp(OpcodeArgs, bool IsSyscallInst) {
   }
 
   FlushRegisterCache();
+
+  // If the syscall number is known and the frontend says the host can take the arguments as-is then skip the syscall handler.
+  // The signal handler steps over a completed inline syscall assuming a plain two byte `syscall` instruction.
+  uint64_t SyscallNumber {};
+  if (OSABI == FEXCore::HLE::SyscallOSABI::OS_LINUX64 && IsSyscallInst && Op->InstSize == 2 &&
+      IsValueConstant(WrapNode(Arguments[0]), &SyscallNumber)) {
+    const auto ABI = CTX->SyscallHandler->GetSyscallABI(SyscallNumber);
+    if (ABI.HostSyscallNumber != -1) {
+      for (size_t i = ABI.NumArgs; i < SyscallArgs - 1; ++i) {
+        Arguments[i + 1] = InvalidNode;
+      }
+
+      auto SyscallOp =
+        _InlineSyscall(Arguments[1], Arguments[2], Arguments[3], Arguments[4], Arguments[5], Arguments[6], ABI.HostSyscallNumber);
+      StoreGPRRegister(X86State::REG_RAX, SyscallOp);
+
+      if (Op->TableInfo->Flags & X86Tables::InstFlags::FLAGS_BLOCK_END) {
+        // Inline syscalls can't change RIP, so the block can link directly to the next instruction.
+        ExitRelocatedPC(Op);
+      }
+      return;
+    }
+  }
+
   auto SyscallOp = _Syscall(Arguments[0], Arguments[1], Arguments[2], Arguments[3], Arguments[4], Arguments[5], Arguments[6]);
 
   // Generic ABI doesn't store result in RAX.
@@ -111,13 +136,19 @@ void OpDispatchBuilder::SyscallOp(OpcodeArgs, bool IsSyscallInst) {
 void OpDispatchBuilder::ThunkOp(OpcodeArgs) {
   const auto GPRSize = GetGPROpSize();
   uint8_t* sha256 = (uint8_t*)(Op->PC + 2);
+  const auto& Sum = *reinterpret_cast<SHA256Sum*>(sha256);
 
-  if (Is64BitMode) {
+  if (Is64BitMode && CTX->ThunkHandler && CTX->ThunkHandler->IsRegisterABIThunk(Sum)) {
+    // Register ABI thunks take the x86-64 SysV argument registers directly and return in RAX
+    auto Result = ThunkRegisterABI(LoadGPRRegister(X86State::REG_RDI), LoadGPRRegister(X86State::REG_RSI), LoadGPRRegister(X86State::REG_RDX),
+                                   LoadGPRRegister(X86State::REG_RCX), LoadGPRRegister(X86State::REG_R8), LoadGPRRegister(X86State::REG_R9), Sum);
+    StoreGPRRegister(X86State::REG_RAX, Result);
+  } else if (Is64BitMode) {
     // x86-64 ABI puts the function argument in RDI
-    Thunk(LoadGPRRegister(X86State::REG_RDI), *reinterpret_cast<SHA256Sum*>(sha256));
+    Thunk(LoadGPRRegister(X86State::REG_RDI), Sum);
   } else {
     // x86 fastcall ABI puts the function argument in ECX
-    Thunk(LoadGPRRegister(X86State::REG_RCX), *reinterpret_cast<SHA256Sum*>(sha256));
+    Thunk(LoadGPRRegister(X86State::REG_RCX), Sum);
   }
 
   auto NewRIP = Pop(GPRSize);
@@ -4235,7 +4266,7 @@ AddressMode OpDispatchBuilder::DecodeAddress(const X86Tables::DecodedOp& Op, con
     A.AddrSize = GPRSize;
   } else if (Operand.IsGPRDirect()) {
     A.Base = LoadGPRRegister(Operand.Data.GPR.GPR, GPRSize);
-    A.NonTSO |= IsNonTSOReg(AccessType, Operand.Data.GPR.GPR);
+    A.NonTSO |= IsNonTSOReg(AccessType, Operand.Data.GPR.GPR) || IsNonTSOStackAccess(AccessType, Operand.Data.GPR.GPR, 0);
   } else if (Operand.IsGPRIndirect() || Operand.IsGPRIndirectRelocation()) {
     A.Base = LoadGPRRegister(Operand.Data.GPRIndirect.GPR, GPRSize);
     if (Operand.IsGPRIndirectRelocation()) {
@@ -4244,6 +4275,9 @@ AddressMode OpDispatchBuilder::DecodeAddress(const X86Tables::DecodedOp& Op, con
       A.Offset = static_cast<int32_t>(Operand.Data.GPRIndirect.Displacement);
     }
     A.NonTSO |= IsNonTSOReg(AccessType, Operand.Data.GPRIndirect.GPR);
+    if (!Operand.IsGPRIndirectRelocation()) {
+      A.NonTSO |= IsNonTSOStackAccess(AccessType, Operand.Data.GPRIndirect.GPR, A.Offset);
+    }
   } else if (Operand.IsRIPRelative() || Operand.IsRIPRelativeRelocation()) {
     if (Is64BitMode) {
       A.Base = GetRelocatedPC(Op, static_cast<int32_t>(Operand.Data.RIPLiteral.Value));
@@ -4288,6 +4322,10 @@ AddressMode OpDispatchBuilder::DecodeAddress(const X86Tables::DecodedOp& Op, con
     }
 
     A.NonTSO |= IsNonTSOReg(AccessType, Operand.Data.SIB.Base) || IsNonTSOReg(AccessType, Operand.Data.SIB.Index);
+    if (!Operand.IsSIBRelocation() && !A.Index && !IsVSIB) {
+      // Only a plain base + displacement can be bounded to the stack frame window.
+      A.NonTSO |= IsNonTSOStackAccess(AccessType, Operand.Data.SIB.Base, A.Offset);
+    }
   } else if (Operand.IsLiteralRelocation()) {
     A.Base = _EntrypointOffset(GPRSize, Operand.Data.LiteralRelocation.EntrypointOffset);
   } else {
@@ -214,6 +214,10 @@ public:
     FlushRegisterCache();
     return _Thunk(ArgPtr, ThunkNameHash);
   }
+  Ref ThunkRegisterABI(Ref Arg0, Ref Arg1, Ref Arg2, Ref Arg3, Ref Arg4, Ref Arg5, SHA256Sum ThunkNameHash) {
+    FlushRegisterCache();
+    return _ThunkRegisterABI(Arg0, Arg1, Arg2, Arg3, Arg4, Arg5, ThunkNameHash);
+  }
 
   bool FinishOp(uint64_t NextRIP, bool LastOp) {
     // If we are switching to a new block and this current block has yet to set a RIP
@@ -954,6 +958,9 @@ public:
 
   ///< Helper for PSHUD and VPERMILPS(imm) since they are the same instruction
   Ref Single128Bit4ByteVectorShuffle(Ref Src, uint8_t Shuffle);
+  ///< SVE256 helpers for VPSHUFD/VPERMILPS(imm), which shuffle each lane the same way, and VPERMQ/VPERMILPD(imm)
+  Ref Lane256Bit4ByteVectorShuffle(Ref Src, uint8_t Shuffle);
+  Ref Single256Bit8ByteVectorShuffle(Ref Src, uint8_t Shuffle);
   // AVX 128-bit operations
   Ref AVX128_LoadXMMRegister(uint32_t XMM, bool High);
   void AVX128_StoreXMMRegister(uint32_t XMM, const Ref Src, bool High);
@@ -1441,6 +1448,9 @@ private:
   Ref PALIGNROpImpl(OpcodeArgs, const X86Tables::DecodedOperand& Src1, const X86Tables::DecodedOperand& Src2,
                     const X86Tables::DecodedOperand& Imm, bool IsAVX);
 
+  Ref PCMPXSTRXImplicitLength(Ref Src, IR::OpSize ElementSize);
+  Ref PCMPXSTRXExplicitLength(Ref Length, bool Is64Bit, uint32_t NumElements);
+  Ref PCMPXSTRXAggregateOpImpl(uint16_t Control, Ref Src1, Ref Src2, Ref Length1, Ref Length2, Ref Valid1, Ref Valid2);
   void PCMPXSTRXOpImpl(OpcodeArgs, bool IsExplicit, bool IsMask);
 
   Ref PHADDSOpImpl(OpSize Size, Ref Src1, Ref Src2);
@@ -1588,6 +1598,22 @@ private:
     return Access == MemoryAccessType::DEFAULT && Reg == X86State::REG_RSP;
   }
 
+  // Stack frame accesses relative to RSP or RBP that fall inside of the configured displacement window.
+  // These are spills and locals that another thread can't observe without the address first escaping.
+  [[nodiscard]]
+  bool IsNonTSOStackAccess(MemoryAccessType Access, uint8_t Reg, int64_t Displacement) const {
+    const int64_t Window = CTX->Config.StackTSOElisionWindow();
+    if (Access != MemoryAccessType::DEFAULT || Window == 0) {
+      return false;
+    }
+
+    if (Reg != X86State::REG_RSP && Reg != X86State::REG_RBP) {
+      return false;
+    }
+
+    return Displacement >= -Window && Displacement < Window;
+  }
+
   AddressMode DecodeAddress(const X86Tables::DecodedOp& Op, const X86Tables::DecodedOperand& Operand, MemoryAccessType AccessType, bool IsLoad);
 
   Ref LoadSource(RegClass Class, const X86Tables::DecodedOp& Op, const X86Tables::DecodedOperand& Operand, uint32_t Flags,
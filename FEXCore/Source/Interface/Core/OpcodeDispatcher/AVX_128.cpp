@@ -1334,7 +1334,10 @@ void OpDispatchBuilder::AVX128_VPERMQ(OpcodeArgs) {
 
   RefPair Result {};
 
-  // Crack the operation in to two halves and implement per half
+  // Crack the operation in to two halves and implement per half.
+  // Each half picks two of the four 64-bit elements, which is at most one NEON permute. Only the two selectors that keep
+  // an element in place while pulling in the other from the opposite half need an insert. A whole register TBL like the
+  // SVE256 path uses would need a table load and consecutive registers, so it doesn't pay off here.
   uint8_t SelectorLow = Selector & 0b1111;
   uint8_t SelectorHigh = (Selector >> 4) & 0b1111;
   auto SelectLane = [this](uint8_t Selector, RefPair Src) -> Ref {
@@ -1419,6 +1422,7 @@ void OpDispatchBuilder::AVX128_VPERMILImm(OpcodeArgs, IR::OpSize ElementSize) {
 
   RefPair Result = AVX128_Zext(LoadZeroVector(OpSize::i128Bit));
 
+  // Never lane crossing, so each half is shuffled independently with the same single permute as the 128-bit form.
   if (ElementSize == OpSize::i64Bit) {
     auto DoSwizzle64 = [this](Ref Src, uint8_t Selector) -> Ref {
       switch (Selector) {
@@ -1834,8 +1838,7 @@ void OpDispatchBuilder::AVX128_VPERMD(OpcodeArgs) {
   RefPair Result {};
 
   Ref IndexMask = _VectorImm(OpSize::i128Bit, OpSize::i32Bit, 0b111);
-  Ref AddConst = Constant(0x03020100);
-  Ref Repeating3210 = _VDupFromGPR(OpSize::i128Bit, OpSize::i32Bit, AddConst);
+  Ref Repeating3210 = LoadAndCacheNamedVectorConstant(OpSize::i128Bit, NAMED_VECTOR_VPERMD_INDEX);
 
   Result.Low = DoPerm(Src, Indices.Low, IndexMask, Repeating3210);
   Result.High = DoPerm(Src, Indices.High, IndexMask, Repeating3210);
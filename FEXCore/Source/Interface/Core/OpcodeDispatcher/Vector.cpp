@@ -932,20 +932,16 @@ Ref OpDispatchBuilder::GeneratePSHUFBMask(IR::OpSize SrcSize) {
 Ref OpDispatchBuilder::PSHUFBOpImpl(IR::OpSize SrcSize, Ref Src1, Ref Src2, Ref MaskVector) {
   const auto Is256Bit = SrcSize == OpSize::i256Bit;
 
-  // We perform the 256-bit version as two 128-bit operations due to
-  // the lane splitting behavior, so cap the maximum size at 16.
-  const auto SanitizedSrcSize = std::min(SrcSize, OpSize::i128Bit);
-
   Ref MaskedIndices = _VAnd(SrcSize, SrcSize, Src2, MaskVector);
 
-  Ref Low = _VTBL1(SanitizedSrcSize, Src1, MaskedIndices);
-  if (!Is256Bit) {
-    return Low;
+  if (Is256Bit) {
+    // A 256-bit TBL indexes across both lanes, so rebase the upper lane's indices on to the upper lane.
+    // Indices with bit 7 set stay out of range after the offset and still zero their element.
+    Ref LaneOffset = LoadAndCacheIndexedNamedVectorConstant(SrcSize, FEXCore::IR::IndexNamedVectorConstant::INDEXED_NAMED_VECTOR_TBL_LANE_OFFSET_256, 0);
+    MaskedIndices = _VAdd(SrcSize, OpSize::i8Bit, MaskedIndices, LaneOffset);
   }
 
-  Ref HighSrc1 = _VInsElement(SrcSize, OpSize::i128Bit, 0, 1, Src1, Src1);
-  Ref High = _VTBL1(SanitizedSrcSize, HighSrc1, MaskedIndices);
-  return _VInsElement(SrcSize, OpSize::i128Bit, 1, 0, Low, High);
+  return _VTBL1(SrcSize, Src1, MaskedIndices);
 }
 
 void OpDispatchBuilder::PSHUFBOp(OpcodeArgs) {
@@ -1256,6 +1252,78 @@ Ref OpDispatchBuilder::Single128Bit4ByteVectorShuffle(Ref Src, uint8_t Shuffle)
   }
 }
 
+Ref OpDispatchBuilder::Lane256Bit4ByteVectorShuffle(Ref Src, uint8_t Shuffle) {
+  // Only SVE permutes that work within 64-bit or 128-bit granules keep the two lanes separate,
+  // which limits these to TRN and REV. Everything else uses a precomputed TBL table.
+  switch (Shuffle) {
+  case 0b11'10'01'00:
+    ///< Identity copy
+    return Src;
+  case 0b01'00'01'00:
+    ///< Duplicate bottom 64-bits of each lane
+    return _VTrn(OpSize::i256Bit, OpSize::i64Bit, Src, Src);
+  case 0b10'10'00'00:
+    ///< Duplicate even elements
+    return _VTrn(OpSize::i256Bit, OpSize::i32Bit, Src, Src);
+  case 0b10'11'00'01:
+    ///< Reverse each 64-bit chunk
+    return _VRev64(OpSize::i256Bit, OpSize::i32Bit, Src);
+  case 0b11'10'11'10:
+    ///< Duplicate top 64-bits of each lane
+    return _VTrn2(OpSize::i256Bit, OpSize::i64Bit, Src, Src);
+  case 0b11'11'01'01:
+    ///< Duplicate odd elements
+    return _VTrn2(OpSize::i256Bit, OpSize::i32Bit, Src, Src);
+  default: {
+    // VPSHUFD shuffles both lanes the same way, which a precomputed table can do in one TBL.
+    auto LookupIndexes =
+      LoadAndCacheIndexedNamedVectorConstant(OpSize::i256Bit, FEXCore::IR::IndexNamedVectorConstant::INDEXED_NAMED_VECTOR_PSHUFD_256, Shuffle * 32);
+    return _VTBL1(OpSize::i256Bit, Src, LookupIndexes);
+  }
+  }
+}
+
+Ref OpDispatchBuilder::Single256Bit8ByteVectorShuffle(Ref Src, uint8_t Shuffle) {
+  switch (Shuffle) {
+  case 0b11'10'01'00:
+    ///< Identity copy
+    return Src;
+  case 0b00'11'10'01:
+    ///< Vector rotate - One element
+    return _VExtr(OpSize::i256Bit, OpSize::i64Bit, Src, Src, 1);
+  case 0b01'00'11'10:
+    ///< Vector rotate - Two elements, swaps the 128-bit lanes
+    return _VExtr(OpSize::i256Bit, OpSize::i64Bit, Src, Src, 2);
+  case 0b10'01'00'11:
+    ///< Vector rotate - Three elements
+    return _VExtr(OpSize::i256Bit, OpSize::i64Bit, Src, Src, 3);
+  case 0b01'01'00'00:
+    ///< Zip with self
+    return _VZip(OpSize::i256Bit, OpSize::i64Bit, Src, Src);
+  case 0b11'11'10'10:
+    ///< Zip top half with self
+    return _VZip2(OpSize::i256Bit, OpSize::i64Bit, Src, Src);
+  case 0b10'00'10'00:
+    ///< Even elements broadcast
+    return _VUnZip(OpSize::i256Bit, OpSize::i64Bit, Src, Src);
+  case 0b11'01'11'01:
+    ///< Odd elements broadcast
+    return _VUnZip2(OpSize::i256Bit, OpSize::i64Bit, Src, Src);
+  case 0b10'10'00'00:
+    ///< Duplicate even elements
+    return _VTrn(OpSize::i256Bit, OpSize::i64Bit, Src, Src);
+  case 0b11'11'01'01:
+    ///< Duplicate odd elements
+    return _VTrn2(OpSize::i256Bit, OpSize::i64Bit, Src, Src);
+  default: {
+    // With SVE256 a single TBL can move elements across the 128-bit lanes.
+    auto LookupIndexes =
+      LoadAndCacheIndexedNamedVectorConstant(OpSize::i256Bit, FEXCore::IR::IndexNamedVectorConstant::INDEXED_NAMED_VECTOR_VPERMQ, Shuffle * 32);
+    return _VTBL1(OpSize::i256Bit, Src, LookupIndexes);
+  }
+  }
+}
+
 void OpDispatchBuilder::PSHUFDOp(OpcodeArgs) {
   uint16_t Shuffle = Op->Src[1].Data.Literal.Value;
   Ref Src = LoadSourceFPR(Op, Op->Src[0], Op->Flags);
@@ -1269,6 +1337,11 @@ void OpDispatchBuilder::VPSHUFWOp(OpcodeArgs, IR::OpSize ElementSize, bool Low)
 
   Ref Src = LoadSourceFPR(Op, Op->Src[0], Op->Flags);
 
+  if (Is256Bit && ElementSize == OpSize::i32Bit) {
+    StoreResultFPR(Op, Lane256Bit4ByteVectorShuffle(Src, Shuffle));
+    return;
+  }
+
   // Note/TODO: With better immediate facilities or vector loading in our IR
   //            much of this can be reduced to setting up a table index register
   //            and then using TBL
@@ -4689,8 +4762,8 @@ void OpDispatchBuilder::VPERMDOp(OpcodeArgs) {
   // Get rid of any junk unrelated to the relevant selector index bits (bits [2:0])
   Ref IndexMask = _VectorImm(DstSize, OpSize::i32Bit, 0b111);
 
-  Ref AddConst = Constant(0x03020100);
-  Ref Repeating3210 = _VDupFromGPR(DstSize, OpSize::i32Bit, AddConst);
+  Ref Repeating3210 =
+    LoadAndCacheIndexedNamedVectorConstant(DstSize, FEXCore::IR::IndexNamedVectorConstant::INDEXED_NAMED_VECTOR_VPERMD_INDEX_256, 0);
   Ref FinalIndices = VPERMDIndices(OpSizeFromDst(Op), Indices, IndexMask, Repeating3210);
 
   // Now lets finally shuffle this bad boy around.
@@ -4711,6 +4784,8 @@ void OpDispatchBuilder::VPERMQOp(OpcodeArgs) {
   if (Selector == 0x00 || Selector == 0x55 || Selector == 0xAA || Selector == 0xFF) {
     const auto Index = Selector & 0b11;
     Result = _VDupElement(DstSize, OpSize::i64Bit, Src, Index);
+  } else if (DstSize == OpSize::i256Bit) {
+    Result = Single256Bit8ByteVectorShuffle(Src, Selector);
   } else {
     Result = LoadZeroVector(DstSize);
     for (size_t i = 0; i < IR::NumElements(DstSize, IR::OpSize::i64Bit); i++) {
@@ -4866,28 +4941,32 @@ void OpDispatchBuilder::VPERMILImmOp(OpcodeArgs, IR::OpSize ElementSize) {
   const auto Selector = Op->Src[1].Literal() & 0xFF;
 
   Ref Src = LoadSourceFPR(Op, Op->Src[0], Op->Flags);
+
+  if (Is256Bit) {
+    // VPERMILPS matches VPSHUFD, and VPERMILPD is a VPERMQ that doesn't cross lanes.
+    if (ElementSize == OpSize::i32Bit) {
+      StoreResultFPR(Op, Lane256Bit4ByteVectorShuffle(Src, Selector));
+      return;
+    }
+
+    uint8_t Shuffle = 0;
+    for (size_t i = 0; i < 4; ++i) {
+      Shuffle |= ((i & 0b10) | ((Selector >> i) & 1)) << (i * 2);
+    }
+    StoreResultFPR(Op, Single256Bit8ByteVectorShuffle(Src, Shuffle));
+    return;
+  }
+
   Ref Result = LoadZeroVector(DstSize);
 
   if (ElementSize == OpSize::i64Bit) {
     Result = _VInsElement(DstSize, ElementSize, 0, Selector & 0b0001, Result, Src);
     Result = _VInsElement(DstSize, ElementSize, 1, (Selector & 0b0010) >> 1, Result, Src);
-
-    if (Is256Bit) {
-      Result = _VInsElement(DstSize, ElementSize, 2, ((Selector & 0b0100) >> 2) + 2, Result, Src);
-      Result = _VInsElement(DstSize, ElementSize, 3, ((Selector & 0b1000) >> 3) + 2, Result, Src);
-    }
   } else {
     Result = _VInsElement(DstSize, ElementSize, 0, Selector & 0b00000011, Result, Src);
     Result = _VInsElement(DstSize, ElementSize, 1, (Selector & 0b00001100) >> 2, Result, Src);
     Result = _VInsElement(DstSize, ElementSize, 2, (Selector & 0b00110000) >> 4, Result, Src);
     Result = _VInsElement(DstSize, ElementSize, 3, (Selector & 0b11000000) >> 6, Result, Src);
-
-    if (Is256Bit) {
-      Result = _VInsElement(DstSize, ElementSize, 4, (Selector & 0b00000011) + 4, Result, Src);
-      Result = _VInsElement(DstSize, ElementSize, 5, ((Selector & 0b00001100) >> 2) + 4, Result, Src);
-      Result = _VInsElement(DstSize, ElementSize, 6, ((Selector & 0b00110000) >> 4) + 4, Result, Src);
-      Result = _VInsElement(DstSize, ElementSize, 7, ((Selector & 0b11000000) >> 6) + 4, Result, Src);
-    }
   }
 
   StoreResultFPR(Op, Result);
@@ -4896,10 +4975,9 @@ void OpDispatchBuilder::VPERMILImmOp(OpcodeArgs, IR::OpSize ElementSize) {
 Ref OpDispatchBuilder::VPERMILRegOpImpl(OpSize DstSize, IR::OpSize ElementSize, Ref Src, Ref Indices) {
   // NOTE: See implementation of VPERMD for the gist of what we do to make this work.
   //
-  //       The only difference here is that we need to add 16 to the upper lane
-  //       before doing the final addition to build up the indices for TBL.
+  //       The only difference here is that the upper lane's indices need 16 added
+  //       to them, which the 256-bit named constant already includes.
 
-  const auto Is256Bit = DstSize == OpSize::i256Bit;
   auto IsPD = ElementSize == OpSize::i64Bit;
 
   if (IsPD) {
@@ -4923,19 +5001,17 @@ Ref OpDispatchBuilder::VPERMILRegOpImpl(OpSize DstSize, IR::OpSize ElementSize,
   auto IndexShift = IsPD ? 3 : 2;
   Ref ShiftedIndices = _VShlI(DstSize, OpSize::i8Bit, IndexTrn3, IndexShift);
 
-  uint64_t VConstant = IsPD ? 0x0706050403020100 : 0x03020100;
-  Ref VectorConst = _VDupFromGPR(DstSize, ElementSize, Constant(VConstant));
-  Ref FinalIndices {};
-
-  if (Is256Bit) {
-    const auto ZeroRegister = LoadZeroVector(DstSize);
-    Ref Vector16 = _VInsElement(DstSize, OpSize::i128Bit, 1, 0, ZeroRegister, _VectorImm(DstSize, OpSize::i8Bit, 16));
-    Ref IndexOffsets = _VAdd(DstSize, OpSize::i8Bit, VectorConst, Vector16);
-
-    FinalIndices = _VAdd(DstSize, OpSize::i8Bit, IndexOffsets, ShiftedIndices);
+  // The upper half of the 256-bit constant already has the upper lane offset folded in.
+  Ref IndexOffsets {};
+  if (DstSize == OpSize::i256Bit) {
+    IndexOffsets = LoadAndCacheIndexedNamedVectorConstant(
+      DstSize, IsPD ? FEXCore::IR::IndexNamedVectorConstant::INDEXED_NAMED_VECTOR_VPERMILPD_INDEX_256 :
+                      FEXCore::IR::IndexNamedVectorConstant::INDEXED_NAMED_VECTOR_VPERMILPS_INDEX_256,
+      0);
   } else {
-    FinalIndices = _VAdd(DstSize, OpSize::i8Bit, VectorConst, ShiftedIndices);
+    IndexOffsets = LoadAndCacheNamedVectorConstant(DstSize, IsPD ? NAMED_VECTOR_VPERMILPD_INDEX : NAMED_VECTOR_VPERMILPS_INDEX);
   }
+  Ref FinalIndices = _VAdd(DstSize, OpSize::i8Bit, IndexOffsets, ShiftedIndices);
 
   return _VTBL1(DstSize, Src, FinalIndices);
 }
@@ -4952,8 +5028,143 @@ void OpDispatchBuilder::VPERMILRegOp(OpcodeArgs) {
 template void OpDispatchBuilder::VPERMILRegOp<OpSize::i32Bit>(OpcodeArgs);
 template void OpDispatchBuilder::VPERMILRegOp<OpSize::i64Bit>(OpcodeArgs);
 
+Ref OpDispatchBuilder::PCMPXSTRXImplicitLength(Ref Src, IR::OpSize ElementSize) {
+  // Narrowing the null element mask with a shift leaves 4 bits per byte, so the
+  // first null element can be found with a single CTZ. A vector without a null
+  // element gives a CTZ of 64, which saturates to 16 bytes or 8 words as-is.
+  Ref NullMask = _VCMPEQZ(OpSize::i128Bit, ElementSize, Src);
+  Ref NibbleMask = _VUShrNI(OpSize::i128Bit, OpSize::i16Bit, NullMask, 4);
+  Ref Nibbles = _VExtractToGPR(OpSize::i128Bit, OpSize::i64Bit, NibbleMask, 0);
+  Ref TrailingZeroes = _FindTrailingZeroes(OpSize::i64Bit, Nibbles);
+
+  return _Lshr(OpSize::i64Bit, TrailingZeroes, Constant(ElementSize == OpSize::i16Bit ? 3 : 2));
+}
+
+Ref OpDispatchBuilder::PCMPXSTRXExplicitLength(Ref Length, bool Is64Bit, uint32_t NumElements) {
+  // The length is signed and saturates to the number of elements when its
+  // absolute value exceeds it. Comparing the absolute value unsigned also
+  // handles the magnitude of INT64_MIN not being representable.
+  if (!Is64Bit) {
+    Length = _Sbfe(OpSize::i64Bit, 32, 0, Length);
+  }
+
+  Ref Zero = Constant(0);
+  Ref MaxLength = Constant(NumElements);
+  Ref Negated = _Neg(OpSize::i64Bit, Length);
+  Ref Abs = _Select(OpSize::i64Bit, OpSize::i64Bit, CondClass::SLT, Length, Zero, Negated, Length);
+  return _Select(OpSize::i64Bit, OpSize::i64Bit, CondClass::ULT, Abs, MaxLength, Abs, MaxLength);
+}
+
+Ref OpDispatchBuilder::PCMPXSTRXAggregateOpImpl(uint16_t Control, Ref Src1, Ref Src2, Ref Length1, Ref Length2, Ref Valid1, Ref Valid2) {
+  const auto IsWord = (Control & 0b01) != 0;
+  const auto IsSigned = (Control & 0b10) != 0;
+  const auto ElementSize = IsWord ? OpSize::i16Bit : OpSize::i8Bit;
+  const auto NumElements = 16U >> IsWord;
+
+  // Every aggregation returns a mask with each element of Src2 set to all 1s or all 0s.
+  switch ((Control >> 2) & 0b11) {
+  case 0b00: {
+    // Equal any: Src2[j] matches any valid element of Src1.
+    //
+    // Invalid elements of Src1 are replaced with Src1[0], duplicates can't change the
+    // result. The empty Src1 case is then handled by masking with the validity of Src1[0].
+    Ref First = _VDupElement(OpSize::i128Bit, ElementSize, Src1, 0);
+    Ref Set = _VBSL(OpSize::i128Bit, Valid1, Src1, First);
+
+    Ref Result {};
+    for (uint32_t i = 0; i < NumElements; ++i) {
+      Ref Element = _VDupElement(OpSize::i128Bit, ElementSize, Set, i);
+      Ref Match = _VCMPEQ(OpSize::i128Bit, ElementSize, Src2, Element);
+      Result = Result ? _VOr(OpSize::i128Bit, OpSize::i128Bit, Result, Match) : Match;
+    }
+
+    Ref FirstValid = _VDupElement(OpSize::i128Bit, ElementSize, Valid1, 0);
+    Ref Valid = _VAnd(OpSize::i128Bit, OpSize::i128Bit, Valid2, FirstValid);
+    return _VAnd(OpSize::i128Bit, OpSize::i128Bit, Result, Valid);
+  }
+  case 0b01: {
+    // Ranges: Src1[2p] <= Src2[j] <= Src1[2p + 1] for any pair p that is fully valid.
+    //
+    // Unsigned elements are biased so that the signed compares give unsigned results.
+    if (!IsSigned) {
+      Ref SignBit = _VectorImm(OpSize::i128Bit, ElementSize, 0x80, IsWord ? 8 : 0);
+      Src1 = _VXor(OpSize::i128Bit, OpSize::i128Bit, Src1, SignBit);
+      Src2 = _VXor(OpSize::i128Bit, OpSize::i128Bit, Src2, SignBit);
+    }
+
+    // A pair is valid if its upper bound is. Invalid pairs are replaced with the empty range [MAX, MIN].
+    const auto PairSize = ElementSize << 1;
+    Ref PairValid = _VSShrI(OpSize::i128Bit, PairSize, Valid1, IR::OpSizeAsBits(ElementSize));
+    Ref EmptyBounds = Constant(IsWord ? 0x8000'7FFF : 0x807F);
+    Ref EmptyRange = _VDupFromGPR(OpSize::i128Bit, PairSize, EmptyBounds);
+    Ref Bounds = _VBSL(OpSize::i128Bit, PairValid, Src1, EmptyRange);
+
+    // Accumulate whether Src2[j] is outside of every range.
+    Ref Outside {};
+    for (uint32_t i = 0; i < NumElements; i += 2) {
+      Ref Lower = _VDupElement(OpSize::i128Bit, ElementSize, Bounds, i);
+      Ref Upper = _VDupElement(OpSize::i128Bit, ElementSize, Bounds, i + 1);
+      Ref Below = _VCMPGT(OpSize::i128Bit, ElementSize, Lower, Src2);
+      Ref Above = _VCMPGT(OpSize::i128Bit, ElementSize, Src2, Upper);
+      Ref Out = _VOr(OpSize::i128Bit, OpSize::i128Bit, Below, Above);
+      Outside = Outside ? _VAnd(OpSize::i128Bit, OpSize::i128Bit, Outside, Out) : Out;
+    }
+
+    return _VAndn(OpSize::i128Bit, OpSize::i128Bit, Valid2, Outside);
+  }
+  case 0b10: {
+    // Equal each: Src1[j] == Src2[j] where both are valid, true where both are
+    // invalid and false where only one of them is valid.
+    Ref Equal = _VCMPEQ(OpSize::i128Bit, ElementSize, Src1, Src2);
+    Ref ValidDiffers = _VXor(OpSize::i128Bit, OpSize::i128Bit, Valid1, Valid2);
+    Ref EqualOrInvalid = _VOrn(OpSize::i128Bit, OpSize::i128Bit, Equal, Valid1);
+    return _VAndn(OpSize::i128Bit, OpSize::i128Bit, EqualOrInvalid, ValidDiffers);
+  }
+  case 0b11:
+  default: {
+    // Equal ordered: Src1 is found as a substring of Src2 starting at Src2[j].
+    //
+    // Each valid Src1[i] is compared against all of Src2, then the matches are shifted
+    // down by i elements so they line up with the start of the substring. Elements
+    // shifted in from the top are past the end of the vector and always match.
+    Ref Ones = _VectorImm(OpSize::i128Bit, OpSize::i8Bit, 0xFF);
+
+    Ref Result {};
+    for (uint32_t i = 0; i < NumElements; ++i) {
+      Ref Element = _VDupElement(OpSize::i128Bit, ElementSize, Src1, i);
+      Ref ElementValid = _VDupElement(OpSize::i128Bit, ElementSize, Valid1, i);
+      Ref Match = _VCMPEQ(OpSize::i128Bit, ElementSize, Src2, Element);
+      Match = _VOrn(OpSize::i128Bit, OpSize::i128Bit, Match, ElementValid);
+      if (i != 0) {
+        Match = _VExtr(OpSize::i128Bit, ElementSize, Ones, Match, i);
+      }
+      Result = Result ? _VAnd(OpSize::i128Bit, OpSize::i128Bit, Result, Match) : Match;
+    }
+
+    // If Src2 is shorter than the vector, the substring must also end within it,
+    // so only the first (Length2 - Length1 + 1) positions can match. An empty
+    // Src1 matches everywhere.
+    Ref MaxLength = Constant(NumElements);
+    Ref Zero = Constant(0);
+    Ref Remaining = _Sub(OpSize::i64Bit, Length2, Length1);
+    Ref Limit = Add(OpSize::i64Bit, Remaining, 1);
+    Limit = _Select(OpSize::i64Bit, OpSize::i64Bit, CondClass::EQ, Length2, MaxLength, MaxLength, Limit);
+    Limit = _Select(OpSize::i64Bit, OpSize::i64Bit, CondClass::EQ, Length1, Zero, MaxLength, Limit);
+
+    Ref Index = LoadAndCacheNamedVectorConstant(
+      OpSize::i128Bit, IsWord ? NAMED_VECTOR_INCREMENTAL_U16_INDEX : NAMED_VECTOR_INCREMENTAL_U8_INDEX);
+    Ref LimitVector = _VDupFromGPR(OpSize::i128Bit, ElementSize, Limit);
+    Ref InLimit = _VCMPGT(OpSize::i128Bit, ElementSize, LimitVector, Index);
+    return _VAnd(OpSize::i128Bit, OpSize::i128Bit, Result, InLimit);
+  }
+  }
+}
+
 void OpDispatchBuilder::PCMPXSTRXOpImpl(OpcodeArgs, bool IsExplicit, bool IsMask) {
   const uint16_t Control = Op->Src[1].Literal();
+  const auto IsWord = (Control & 0b01) != 0;
+  const auto ElementSize = IsWord ? OpSize::i16Bit : OpSize::i8Bit;
+  const auto NumElements = 16U >> IsWord;
 
   // NOTE: Unlike most other SSE/AVX instructions, the SSE4.2 string and text
   //       instructions do *not* require memory operands to be aligned on a 16 byte
@@ -4964,23 +5175,51 @@ void OpDispatchBuilder::PCMPXSTRXOpImpl(OpcodeArgs, bool IsExplicit, bool IsMask
   Ref Src1 = LoadSourceFPR_WithOpSize(Op, Op->Dest, OpSize::i128Bit, Op->Flags);
   Ref Src2 = LoadSourceFPR_WithOpSize(Op, Op->Src[0], OpSize::i128Bit, Op->Flags, {.Align = OpSize::i8Bit});
 
-  Ref IntermediateResult {};
+  // Lengths of both strings in elements, saturated to the number of elements in a vector.
+  Ref Length1 {};
+  Ref Length2 {};
   if (IsExplicit) {
-    // Will be 4 in the absence of a REX.W bit and 8 in the presence of a REX.W bit.
-    //
-    // While the control bit immediate for the instruction itself is only ever 8 bits
-    // in size, we use it as a 16-bit value so that we can use the 8th bit to signify
-    // whether or not RAX and RDX should be interpreted as a 64-bit value.
-    const auto SrcSize = OpSizeFromSrc(Op);
-    const auto Is64Bit = SrcSize == OpSize::i64Bit;
-    const auto NewControl = uint16_t(Control | (uint16_t(Is64Bit) << 8));
+    // RAX and RDX are only treated as 64-bit in the presence of a REX.W bit.
+    const auto Is64Bit = OpSizeFromSrc(Op) == OpSize::i64Bit;
+    Length1 = PCMPXSTRXExplicitLength(LoadGPRRegister(X86State::REG_RAX), Is64Bit, NumElements);
+    Length2 = PCMPXSTRXExplicitLength(LoadGPRRegister(X86State::REG_RDX), Is64Bit, NumElements);
+  } else {
+    Length1 = PCMPXSTRXImplicitLength(Src1, ElementSize);
+    Length2 = PCMPXSTRXImplicitLength(Src2, ElementSize);
+  }
 
-    Ref SrcRAX = LoadGPRRegister(X86State::REG_RAX);
-    Ref SrcRDX = LoadGPRRegister(X86State::REG_RDX);
+  // All 1s for each element that is within the length of its string.
+  Ref Index =
+    LoadAndCacheNamedVectorConstant(OpSize::i128Bit, IsWord ? NAMED_VECTOR_INCREMENTAL_U16_INDEX : NAMED_VECTOR_INCREMENTAL_U8_INDEX);
+  Ref Length1Vector = _VDupFromGPR(OpSize::i128Bit, ElementSize, Length1);
+  Ref Length2Vector = _VDupFromGPR(OpSize::i128Bit, ElementSize, Length2);
+  Ref Valid1 = _VCMPGT(OpSize::i128Bit, ElementSize, Length1Vector, Index);
+  Ref Valid2 = _VCMPGT(OpSize::i128Bit, ElementSize, Length2Vector, Index);
 
-    IntermediateResult = _VPCMPESTRX(Src1, Src2, SrcRAX, SrcRDX, NewControl);
+  Ref IntermediateMask = PCMPXSTRXAggregateOpImpl(Control, Src1, Src2, Length1, Length2, Valid1, Valid2);
+
+  // Polarity in control[5:4]. Negative inverts every element, masked negative
+  // only inverts the elements that are within the length of Src2.
+  switch ((Control >> 4) & 0b11) {
+  case 0b01: IntermediateMask = _VNot(OpSize::i128Bit, OpSize::i128Bit, IntermediateMask); break;
+  case 0b11: IntermediateMask = _VXor(OpSize::i128Bit, OpSize::i128Bit, IntermediateMask, Valid2); break;
+  default: break;
+  }
+
+  // Compress the element mask in to one bit per element.
+  Ref VMask = LoadAndCacheNamedVectorConstant(OpSize::i128Bit, NAMED_VECTOR_MOVMASKB);
+  Ref IntermediateResult {};
+  if (IsWord) {
+    Ref Bytes = _VUShrNI(OpSize::i128Bit, OpSize::i16Bit, IntermediateMask, 0);
+    Ref Bits = _VAnd(OpSize::i128Bit, OpSize::i8Bit, Bytes, VMask);
+    Ref Sum = _VAddV(OpSize::i128Bit, OpSize::i8Bit, Bits);
+    IntermediateResult = _VExtractToGPR(OpSize::i128Bit, OpSize::i8Bit, Sum, 0);
   } else {
-    IntermediateResult = _VPCMPISTRX(Src1, Src2, Control);
+    Ref Bits = _VAnd(OpSize::i128Bit, OpSize::i8Bit, IntermediateMask, VMask);
+    Bits = _VAddP(OpSize::i128Bit, OpSize::i8Bit, Bits, Bits);
+    Bits = _VAddP(OpSize::i64Bit, OpSize::i8Bit, Bits, Bits);
+    Bits = _VAddP(OpSize::i64Bit, OpSize::i8Bit, Bits, Bits);
+    IntermediateResult = _VExtractToGPR(OpSize::i128Bit, OpSize::i16Bit, Bits, 0);
   }
 
   Ref ZeroConst = Constant(0);
@@ -4989,25 +5228,14 @@ void OpDispatchBuilder::PCMPXSTRXOpImpl(OpcodeArgs, bool IsExplicit, bool IsMask
     // For the masked variant of the instructions, if control[6] is set, then we
     // need to expand the intermediate result into a byte or word mask (depending
     // on data size specified in control[1]) along the entire length of XMM0,
-    // where set bits in the intermediate result set the corresponding entry
-    // in XMM0 to all 1s and unset bits set the corresponding entry to all 0s.
+    // which is exactly the element mask we already have.
     //
     // If control[6] is not set, then we just store the intermediate result as-is
     // into the least significant bits of XMM0 and zero extend it.
     const auto IsExpandedMask = (Control & 0b0100'0000) != 0;
 
     if (IsExpandedMask) {
-      // We need to iterate over the intermediate result and
-      // expand the mask into XMM0 elements.
-      const auto ElementSize = 1U << (Control & 1);
-      const auto NumElements = 16U >> (Control & 1);
-
-      Ref Result = LoadZeroVector(OpSize::i128Bit);
-      for (uint32_t i = 0; i < NumElements; i++) {
-        Ref SignBit = _Sbfe(OpSize::i64Bit, 1, i, IntermediateResult);
-        Result = _VInsGPR(OpSize::i128Bit, IR::SizeToOpSize(ElementSize), i, Result, SignBit);
-      }
-      StoreXMMRegister(0, Result);
+      StoreXMMRegister(0, IntermediateMask);
     } else {
       // We insert the intermediate result as-is.
       StoreXMMRegister(0, _VCastFromGPR(OpSize::i128Bit, OpSize::i16Bit, IntermediateResult));
@@ -5018,19 +5246,31 @@ void OpDispatchBuilder::PCMPXSTRXOpImpl(OpcodeArgs, bool IsExplicit, bool IsMask
     // then we store the least significant bit.
     const auto UseMSBIndex = (Control & 0b0100'0000) != 0;
 
-    Ref ResultNoFlags = _Bfe(OpSize::i32Bit, 16, 0, IntermediateResult);
-
-    Ref IfZero = Constant(16 >> (Control & 1));
-    Ref IfNotZero = UseMSBIndex ? _FindMSB(IR::OpSize::i32Bit, ResultNoFlags) : _FindLSB(IR::OpSize::i32Bit, ResultNoFlags);
-    Ref Result = _Select(OpSize::i64Bit, OpSize::i64Bit, CondClass::EQ, ResultNoFlags, ZeroConst, IfZero, IfNotZero);
+    Ref IfZero = Constant(NumElements);
+    Ref IfNotZero = UseMSBIndex ? _FindMSB(IR::OpSize::i32Bit, IntermediateResult) : _FindLSB(IR::OpSize::i32Bit, IntermediateResult);
+    Ref Result = _Select(OpSize::i64Bit, OpSize::i64Bit, CondClass::EQ, IntermediateResult, ZeroConst, IfZero, IfNotZero);
 
     // Store the result, it is already zero-extended to 64-bit implicitly.
     StoreGPRRegister(X86State::REG_RCX, Result);
   }
 
-  // Set all of the necessary flags. NZCV stored in bits 28...31 like the hw op.
-  SetNZCV(IntermediateResult);
-  CFInverted = false;
+  // Set all of the necessary flags, with CF stored inverted in NZCV.
+  //   SF: Src1 is shorter than a vector
+  //   ZF: Src2 is shorter than a vector
+  //   CF: The intermediate result is non-zero
+  //   OF: Bit 0 of the intermediate result
+  Ref MaxLength = Constant(NumElements);
+  Ref OF = _And(OpSize::i32Bit, IntermediateResult, Constant(1));
+  Ref CFInv = Select01(OpSize::i32Bit, CondClass::EQ, IntermediateResult, ZeroConst);
+  Ref ZF = Select01(OpSize::i64Bit, CondClass::ULT, Length2, MaxLength);
+  Ref SF = Select01(OpSize::i64Bit, CondClass::ULT, Length1, MaxLength);
+
+  Ref Flags = _Lshl(OpSize::i32Bit, OF, Constant(28));
+  Flags = _Orlshl(OpSize::i32Bit, Flags, CFInv, 29);
+  Flags = _Orlshl(OpSize::i32Bit, Flags, ZF, 30);
+  Flags = _Orlshl(OpSize::i32Bit, Flags, SF, 31);
+  SetNZCV(Flags);
+  CFInverted = true;
   ZeroPF_AF();
 }
 
@@ -0,0 +1,81 @@
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace FEXCore::Context {
+// Tracks guest instructions whose atomic operations keep faulting on unaligned addresses.
+//
+// Every unaligned atomic that reaches the SIGBUS handler costs a full signal round trip. Once a guest RIP crosses the
+// configured threshold its block is invalidated and the JIT recompiles the atomic with an inline alignment check that
+// calls the emulation helper directly instead.
+//
+// The table is a fixed size open-addressed hash so it can be updated from signal context without allocating or locking.
+// When the table is full new RIPs are simply not tracked and keep taking the SIGBUS path.
+class UnalignedAtomicHotspots final {
+public:
+  // Returns the number of faults recorded for this RIP including this one, or 0 if the table is full.
+  uint32_t Record(uint64_t RIP) {
+    auto Entry = FindOrInsert(RIP);
+    if (!Entry) {
+      return 0;
+    }
+
+    return Entry->Count.fetch_add(1, std::memory_order_relaxed) + 1;
+  }
+
+  // Called from the JIT when compiling atomics, a RIP is hot once it has crossed the recompile threshold.
+  [[nodiscard]]
+  bool IsHot(uint64_t RIP, uint32_t Threshold) const {
+    if (!HasEntries.load(std::memory_order_relaxed)) {
+      return false;
+    }
+
+    for (size_t i = 0; i < MaxProbe; ++i) {
+      const auto& Entry = Entries[(Hash(RIP) + i) & (NumEntries - 1)];
+      const auto EntryRIP = Entry.RIP.load(std::memory_order_acquire);
+      if (EntryRIP == RIP) {
+        return Entry.Count.load(std::memory_order_relaxed) >= Threshold;
+      } else if (EntryRIP == 0) {
+        return false;
+      }
+    }
+    return false;
+  }
+
+private:
+  constexpr static size_t NumEntries = 1024;
+  constexpr static size_t MaxProbe = 16;
+
+  struct HotspotEntry {
+    std::atomic<uint64_t> RIP {};
+    std::atomic<uint32_t> Count {};
+  };
+
+  static size_t Hash(uint64_t RIP) {
+    return (RIP ^ (RIP >> 12)) * 0x9E37'79B9'7F4A'7C15ULL >> 54;
+  }
+
+  HotspotEntry* FindOrInsert(uint64_t RIP) {
+    for (size_t i = 0; i < MaxProbe; ++i) {
+      auto& Entry = Entries[(Hash(RIP) + i) & (NumEntries - 1)];
+      uint64_t EntryRIP = Entry.RIP.load(std::memory_order_acquire);
+      if (EntryRIP == 0 && Entry.RIP.compare_exchange_strong(EntryRIP, RIP, std::memory_order_acq_rel)) {
+        HasEntries.store(true, std::memory_order_relaxed);
+        return &Entry;
+      }
+
+      if (EntryRIP == RIP) {
+        return &Entry;
+      }
+    }
+
+    return nullptr;
+  }
+
+  std::array<HotspotEntry, NumEntries> Entries {};
+  std::atomic<bool> HasEntries {};
+};
+} // namespace FEXCore::Context
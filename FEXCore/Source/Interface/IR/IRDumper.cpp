@@ -244,6 +244,14 @@ static void PrintArg(fextl::stringstream* out, const IRListView*, NamedVectorCon
         return "sha1rnds_k2";
       case NamedVectorConstant::NAMED_VECTOR_SHA1RNDS_K3:
         return "sha1rnds_k3";
+      case NamedVectorConstant::NAMED_VECTOR_VPERMD_INDEX:
+        return "vpermd_index";
+      case NamedVectorConstant::NAMED_VECTOR_VPERMILPS_INDEX:
+        return "vpermilps_index";
+      case NamedVectorConstant::NAMED_VECTOR_VPERMILPD_INDEX:
+        return "vpermilpd_index";
+      case NamedVectorConstant::NAMED_VECTOR_INCREMENTAL_U8_INDEX:
+        return "u8_incremental_index";
       case NamedVectorConstant::NAMED_VECTOR_MAX:
         return "<Programming Error: Printing MAX value>";
     }
@@ -270,6 +278,18 @@ static void PrintArg(fextl::stringstream* out, const IRListView*, IndexNamedVect
       return "dppd_mask";
     case IndexNamedVectorConstant::INDEXED_NAMED_VECTOR_PBLENDW:
       return "pblendw";
+    case IndexNamedVectorConstant::INDEXED_NAMED_VECTOR_VPERMQ:
+      return "vpermq";
+    case IndexNamedVectorConstant::INDEXED_NAMED_VECTOR_PSHUFD_256:
+      return "pshufd_256";
+    case IndexNamedVectorConstant::INDEXED_NAMED_VECTOR_TBL_LANE_OFFSET_256:
+      return "tbl_lane_offset_256";
+    case IndexNamedVectorConstant::INDEXED_NAMED_VECTOR_VPERMD_INDEX_256:
+      return "vpermd_index_256";
+    case IndexNamedVectorConstant::INDEXED_NAMED_VECTOR_VPERMILPS_INDEX_256:
+      return "vpermilps_index_256";
+    case IndexNamedVectorConstant::INDEXED_NAMED_VECTOR_VPERMILPD_INDEX_256:
+      return "vpermilpd_index_256";
     case INDEXED_NAMED_VECTOR_MAX:
       return "<Programming Error: Printing MAX value>";
     }
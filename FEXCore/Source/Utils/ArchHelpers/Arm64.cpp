@@ -7,6 +7,7 @@
 #include <FEXCore/Debug/InternalThreadState.h>
 #include <FEXCore/Utils/EnumUtils.h>
 #include <FEXCore/Utils/LogManager.h>
+#include <FEXCore/Utils/MathUtils.h>
 #include <FEXCore/Utils/Telemetry.h>
 #include <FEXCore/Utils/ArchHelpers/Arm64.h>
 
@@ -1920,6 +1921,61 @@ static uint64_t HandleAtomicLoadstoreExclusive(uintptr_t ProgramCounter, uint64_
   return NumInstructionsToSkip * 4;
 }
 
+uint64_t HandleUnalignedAtomicOp(UnalignedAtomicOp Op, uint32_t Size, uint64_t Addr, uint64_t Value, uint64_t Expected,
+                                 uint32_t* StrictSplitLockMutex) {
+  // Route through the same emulation as the SIGBUS handler by synthesizing the LSE instruction the JIT would have emitted.
+  // x0 = result, x1 = source, x2 = address
+  uint64_t GPRs[3] {0, Value, Addr};
+  const uint32_t SizeBits = FEXCore::ilog2(Size) << 30;
+
+  if (Op == UnalignedAtomicOp::CAS) {
+    GPRs[0] = Expected;
+    // Rs holds expected and receives the result, Rt holds desired.
+    const uint32_t Instr = CASAL_INST | SizeBits | (0 << 16) | (2 << 5) | 1;
+    if (!HandleCASAL(GPRs, Instr, StrictSplitLockMutex)) {
+      ERROR_AND_DIE_FMT("Unhandled unaligned CAS of size {}", Size);
+    }
+    return GPRs[0];
+  }
+
+  if (Op == UnalignedAtomicOp::Neg) {
+    // No LSE equivalent, loop on CAS until the negated value lands.
+    auto Current = DoCAS(Size, 0, 0, Addr, StrictSplitLockMutex);
+    while (Current.has_value()) {
+      const auto Prev = DoCAS(Size, -*Current, *Current, Addr, StrictSplitLockMutex);
+      if (Prev == Current) {
+        return *Prev;
+      }
+      Current = Prev;
+    }
+    ERROR_AND_DIE_FMT("Unhandled unaligned NEG of size {}", Size);
+  }
+
+  uint32_t AtomicOp {};
+  switch (Op) {
+  case UnalignedAtomicOp::Swap: AtomicOp = ATOMIC_SWAP_OP; break;
+  case UnalignedAtomicOp::Add: AtomicOp = ATOMIC_ADD_OP; break;
+  case UnalignedAtomicOp::Sub:
+    AtomicOp = ATOMIC_ADD_OP;
+    GPRs[1] = -Value;
+    break;
+  case UnalignedAtomicOp::And:
+    AtomicOp = ATOMIC_CLR_OP;
+    GPRs[1] = ~Value;
+    break;
+  case UnalignedAtomicOp::CLR: AtomicOp = ATOMIC_CLR_OP; break;
+  case UnalignedAtomicOp::Or: AtomicOp = ATOMIC_SET_OP; break;
+  case UnalignedAtomicOp::Xor: AtomicOp = ATOMIC_EOR_OP; break;
+  default: ERROR_AND_DIE_FMT("Unknown unaligned atomic op {}", FEXCore::ToUnderlying(Op));
+  }
+
+  const uint32_t Instr = ATOMIC_MEM_INST | SizeBits | (1 << 16) | (AtomicOp << 12) | (2 << 5) | 0;
+  if (!HandleAtomicMemOp(Instr, GPRs, StrictSplitLockMutex)) {
+    ERROR_AND_DIE_FMT("Unhandled unaligned atomic op {} of size {}", FEXCore::ToUnderlying(Op), Size);
+  }
+  return GPRs[0];
+}
+
 [[nodiscard]]
 std::optional<int32_t> HandleUnalignedAccess(FEXCore::Core::InternalThreadState* Thread, UnalignedHandlerType HandleType,
                                              uintptr_t ProgramCounter, uint64_t* GPRs, bool IsJIT) {
@@ -2025,6 +2081,7 @@ std::optional<int32_t> HandleUnalignedAccess(FEXCore::Core::InternalThreadState*
     }
   } else if ((Instr & ArchHelpers::Arm64::CASAL_MASK) == ArchHelpers::Arm64::CASAL_INST) { // CASAL
     if (ArchHelpers::Arm64::HandleCASAL(GPRs, Instr, StrictSplitLockMutex)) {
+      CTX->RecordUnalignedAtomic(Thread, ProgramCounter);
       // Skip this instruction now
       return 4;
     } else {
@@ -2038,6 +2095,7 @@ std::optional<int32_t> HandleUnalignedAccess(FEXCore::Core::InternalThreadState*
     // This mask has a partial overlap with ATOMIC_MEM_INST so we need to check this here.
   } else if ((Instr & ArchHelpers::Arm64::ATOMIC_MEM_MASK) == ArchHelpers::Arm64::ATOMIC_MEM_INST) { // Atomic memory op
     if (ArchHelpers::Arm64::HandleAtomicMemOp(Instr, GPRs, StrictSplitLockMutex)) {
+      CTX->RecordUnalignedAtomic(Thread, ProgramCounter);
       // Skip this instruction now
       return 4;
     } else {
@@ -2048,6 +2106,7 @@ std::optional<int32_t> HandleUnalignedAccess(FEXCore::Core::InternalThreadState*
   } else if ((Instr & ArchHelpers::Arm64::LDAXR_MASK) == ArchHelpers::Arm64::LDAXR_INST) { // LDAXR*
     uint64_t BytesToSkip = ArchHelpers::Arm64::HandleAtomicLoadstoreExclusive(ProgramCounter, GPRs, StrictSplitLockMutex);
     if (BytesToSkip) {
+      CTX->RecordUnalignedAtomic(Thread, ProgramCounter);
       // Skip this instruction now
       return BytesToSkip;
     }
@@ -16,6 +16,11 @@ HandleUnalignedAccess(FEXCore::Core::InternalThreadState* Thread, UnalignedHandl
   ERROR_AND_DIE_FMT("HandleAtomicMemOp Not Implemented");
 }
 
+uint64_t HandleUnalignedAtomicOp(UnalignedAtomicOp Op, uint32_t Size, uint64_t Addr, uint64_t Value, uint64_t Expected,
+                                 uint32_t* StrictSplitLockMutex) {
+  ERROR_AND_DIE_FMT("HandleUnalignedAtomicOp Not Implemented");
+}
+
 #endif
 
 } // namespace FEXCore::ArchHelpers::Arm64
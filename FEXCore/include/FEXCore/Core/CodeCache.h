@@ -69,7 +69,8 @@ using CodeMapFileId = uint64_t;
  * and are written to disk during execution of FEX.
  *
  * Almost all CodeMap data will be an Entry that indicates blocks to be
- * compiled for cache generation. The reserved value `LoadExternalLibrary`
+ * compiled for cache generation. Entries are kept in the order they were
+ * recorded, which the offline compiler uses as the cache code layout. The reserved value `LoadExternalLibrary`
  * indicates that an instance of ExternalLibraryInfo follows (the entry data
  * itself should be skipped in that case).
  */
@@ -104,6 +105,9 @@ struct CodeMap {
   struct ParsedContents {
     fextl::string Filename;
     fextl::set<uint64_t> Blocks;
+    // The same blocks in the order they were first recorded.
+    // Blocks are recorded when they're compiled, so this approximates first-execution order.
+    fextl::vector<uint64_t> BlockOrder;
     bool IsExecutable = false;
   };
 
@@ -195,6 +195,14 @@ public:
   FEX_DEFAULT_VISIBILITY virtual void MarkMonoDetected() = 0;
 
   FEX_DEFAULT_VISIBILITY virtual void MarkMonoBackpatcherBlock(uint64_t BlockEntry) = 0;
+
+  /**
+   * @brief Writes the instrumented block execution counts to the configured directory.
+   *
+   * Does nothing unless the BlockExecutionCounts option is set. Guest addresses are resolved to file offsets through the syscall handler.
+   */
+  FEX_DEFAULT_VISIBILITY virtual void WriteBlockExecutionCounts(FEXCore::Core::InternalThreadState* Thread) = 0;
+
 private:
 };
 } // namespace FEXCore::Context
@@ -319,10 +319,6 @@ enum FallbackHandlerIndex {
   OPINDEX_F64FPREM1,
   OPINDEX_F64SCALE,
 
-  // SSE4.2 string instructions
-  OPINDEX_VPCMPESTRX,
-  OPINDEX_VPCMPISTRX,
-
   // Maximum
   OPINDEX_MAX,
 };
@@ -379,6 +375,8 @@ struct JITPointers {
 
   // Copy of process-wide named vector constants data.
   alignas(16) uint64_t NamedVectorConstants[FEXCore::IR::NamedVectorConstant::NAMED_VECTOR_CONST_POOL_MAX][2];
+
+  uint64_t UnalignedAtomicFallback {};
 };
 
 // Each guest JIT frame has one of these
@@ -396,8 +394,8 @@ struct CpuStateFrame {
    * @brief If we are in an inline syscall we need to store a bit of additional information about this
    *
    * ARM64:
-   *  - Bit 15: In syscall
-   *  - Bit 14-0: Number of static registers spilled
+   *  - Bit 63-16: Host address of the `svc` instruction for inline syscalls, zero otherwise
+   *  - Bit 15-0: Mask of static registers already spilled
    */
   uint64_t InSyscallInfo {};
 
@@ -18,5 +18,12 @@ class ThunkHandler {
 public:
   virtual ~ThunkHandler() = default;
   virtual ThunkedFunction* LookupThunk(const IR::SHA256Sum& sha256) = 0;
+
+  // Returns true if the thunk takes its arguments in the guest argument registers
+  // instead of a packed argument struct. Such thunks are called as
+  // `uint64_t (*)(uint64_t, uint64_t, uint64_t, uint64_t, uint64_t, uint64_t)`.
+  virtual bool IsRegisterABIThunk(const IR::SHA256Sum& sha256) {
+    return false;
+  }
 };
 } // namespace FEXCore
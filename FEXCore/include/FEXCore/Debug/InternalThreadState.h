@@ -8,6 +8,7 @@
 #include <FEXCore/fextl/memory.h>
 #include <FEXCore/fextl/vector.h>
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <shared_mutex>
@@ -111,6 +112,11 @@ struct alignas(FEXCore::Utils::FEX_PAGE_SIZE) InternalThreadState : public FEXCo
 
   UnalignedExclusiveStore ExclusiveStore;
 
+  // Guest range of a block with an unaligned atomic hotspot, set by the SIGBUS handler.
+  // The block is invalidated the next time this thread enters the dispatcher to compile code.
+  std::atomic<uint64_t> PendingUnalignedAtomicBlock {};
+  uint64_t PendingUnalignedAtomicBlockSize {};
+
   ///< Data pointer for exclusive use by the frontend
   void* FrontendPtr;
 
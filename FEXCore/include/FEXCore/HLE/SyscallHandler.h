@@ -58,6 +58,17 @@ public:
   SyscallOSABI GetOSABI() const {
     return OSABI;
   }
+
+  /**
+   * @brief Queried by the frontend when a guest syscall number is known at compile time
+   *
+   * Returning a HostSyscallNumber other than -1 allows the JIT to issue the host syscall inline with the guest arguments
+   * passed through unmodified, skipping HandleSyscall entirely.
+   */
+  virtual SyscallABI GetSyscallABI(uint64_t Syscall) {
+    return {0, false, -1};
+  }
+
   virtual void MarkGuestExecutableRange(FEXCore::Core::InternalThreadState* Thread, uint64_t Start, uint64_t Length) {}
   virtual void InvalidateGuestCodeRange(FEXCore::Core::InternalThreadState* Thread, uint64_t Start, uint64_t Length) {}
   virtual void MarkOvercommitRange(uint64_t Start, uint64_t Length) {}
@@ -54,6 +54,10 @@ enum NamedVectorConstant : uint8_t {
   NAMED_VECTOR_SHA1RNDS_K1,
   NAMED_VECTOR_SHA1RNDS_K2,
   NAMED_VECTOR_SHA1RNDS_K3,
+  NAMED_VECTOR_VPERMD_INDEX,
+  NAMED_VECTOR_VPERMILPS_INDEX,
+  NAMED_VECTOR_VPERMILPD_INDEX,
+  NAMED_VECTOR_INCREMENTAL_U8_INDEX,
 
   NAMED_VECTOR_CONST_POOL_MAX,
   // Beginning of named constants that don't have a constant pool backing.
@@ -72,6 +76,14 @@ enum IndexNamedVectorConstant : uint8_t {
   INDEXED_NAMED_VECTOR_DPPS_MASK,
   INDEXED_NAMED_VECTOR_DPPD_MASK,
   INDEXED_NAMED_VECTOR_PBLENDW,
+  INDEXED_NAMED_VECTOR_VPERMQ,
+  INDEXED_NAMED_VECTOR_PSHUFD_256,
+  // Single entry tables that are always loaded with index 0. These only live here because the named constant pool
+  // is copied in to every CpuStateFrame and has no room left inside the fault page's immediate range.
+  INDEXED_NAMED_VECTOR_TBL_LANE_OFFSET_256,
+  INDEXED_NAMED_VECTOR_VPERMD_INDEX_256,
+  INDEXED_NAMED_VECTOR_VPERMILPS_INDEX_256,
+  INDEXED_NAMED_VECTOR_VPERMILPD_INDEX_256,
   INDEXED_NAMED_VECTOR_MAX,
 };
 
@@ -34,4 +34,33 @@ enum class UnalignedHandlerType {
 [[nodiscard]]
 FEX_DEFAULT_VISIBILITY std::optional<int32_t> HandleUnalignedAccess(
   FEXCore::Core::InternalThreadState* Thread, UnalignedHandlerType HandleType, uintptr_t ProgramCounter, uint64_t* GPRs, bool IsJIT = true);
+
+enum class UnalignedAtomicOp : uint8_t {
+  CAS,
+  Swap,
+  Add,
+  Sub,
+  And,
+  CLR,
+  Or,
+  Xor,
+  Neg,
+};
+
+/**
+ * @brief Emulates an atomic operation on a potentially unaligned address.
+ *
+ * Used by JIT code that has detected an unaligned atomic ahead of time, rather than waiting for the SIGBUS.
+ *
+ * @param Op Which atomic operation to emulate.
+ * @param Size Size of the operation in bytes, 2, 4 or 8.
+ * @param Addr The guest address being operated on.
+ * @param Value The source operand, or the desired value for CAS.
+ * @param Expected The expected value for CAS, unused otherwise.
+ * @param StrictSplitLockMutex Optional mutex to serialize split-lock handling.
+ *
+ * @return The memory value prior to the operation.
+ */
+uint64_t HandleUnalignedAtomicOp(UnalignedAtomicOp Op, uint32_t Size, uint64_t Addr, uint64_t Value, uint64_t Expected,
+                                 uint32_t* StrictSplitLockMutex);
 } // namespace FEXCore::ArchHelpers::Arm64
@@ -1,6 +1,8 @@
 // SPDX-License-Identifier: MIT
 #pragma once
+#include <algorithm>
 #include <atomic>
+#include <bit>
 #include <cstddef>
 #include <cstdint>
 
@@ -24,12 +26,26 @@ static inline uint64_t GetCycleCounter() {
                  : [Res] "=r"(Result));
   return Result;
 }
+
+/**
+ * @brief Get the frequency of the cycle counter in Hz.
+ */
+static inline uint64_t GetCycleCounterFrequency() {
+  uint64_t Result {};
+  __asm volatile("mrs %[Res], CNTFRQ_EL0;" : [Res] "=r"(Result));
+  return Result;
+}
 #else
 static inline uint64_t GetCycleCounter() {
   unsigned dummy;
   uint64_t tsc = __rdtscp(&dummy);
   return tsc;
 }
+
+static inline uint64_t GetCycleCounterFrequency() {
+  // The TSC frequency isn't architecturally exposed, readers must calibrate it themselves.
+  return 0;
+}
 #endif
 // FEXCore live-stats
 constexpr uint8_t STATS_VERSION = 2;
@@ -75,6 +91,77 @@ struct ThreadStats {
 // Ensure 16-byte alignment to take advantage of ARM single-copy atomicity.
 static_assert(sizeof(ThreadStats) % 16 == 0, "Needs to be 16-byte aligned!");
 
+// FEX syscall live-stats, only published by the Linux frontend.
+// Lives in its own shared memory region next to the thread stats since its size depends on the syscall table.
+// The same rule applies here, only append new members to the end of {SyscallStatsHeader, SyscallStats}.
+constexpr uint8_t SYSCALL_STATS_VERSION = 1;
+constexpr size_t SYSCALL_LATENCY_BUCKETS = 32;
+
+struct SyscallStatsHeader {
+  uint8_t Version;
+  AppType app_type;
+  uint16_t SyscallStatsSize;
+  uint32_t NumSyscalls;
+  // Frequency of the cycle counter used for all times, 0 if unknown.
+  uint64_t CycleCounterFrequency;
+  uint32_t NumLatencyBuckets;
+  uint32_t Pad[3];
+};
+
+// One entry per guest syscall number.
+struct SyscallStats {
+  uint64_t Count;
+
+  // Accumulated time (In unscaled CPU cycles!)
+  // Total time from entering the syscall handler until returning to the JIT.
+  uint64_t AccumulatedTime;
+  // Part of AccumulatedTime spent inside of host syscalls, only measured for passthrough syscalls.
+  // The remainder is FEX's emulation overhead.
+  uint64_t AccumulatedHostTime;
+
+  // Bucket N counts syscalls that took [2^(N-1), 2^N) cycles, the last bucket also counts everything longer.
+  uint64_t LatencyHistogram[SYSCALL_LATENCY_BUCKETS];
+
+  uint64_t Pad;
+};
+
+static_assert(sizeof(SyscallStatsHeader) % 16 == 0, "Needs to be 16-byte aligned!");
+static_assert(sizeof(SyscallStats) % 16 == 0, "Needs to be 16-byte aligned!");
+
+// FEX thunk live-stats, only published by the Linux frontend.
+// Entries are assigned to thunked functions in order of their first lookup by the JIT.
+// The same rule applies here, only append new members to the end of {ThunkStatsHeader, ThunkStats}.
+constexpr uint8_t THUNK_STATS_VERSION = 1;
+
+struct ThunkStatsHeader {
+  uint8_t Version;
+  AppType app_type;
+  uint16_t ThunkStatsSize;
+  uint32_t NumThunks;
+  // Frequency of the cycle counter used for all times, 0 if unknown.
+  uint64_t CycleCounterFrequency;
+};
+
+struct ThunkStats {
+  // SHA256 of the thunk name, as used by the guest library to look it up.
+  uint8_t Sum[32];
+  // Name of the thunk library, NUL-terminated. "fex" for thunks built into the emulator.
+  char Library[32];
+
+  // Number of guest->host transitions. Entries with a zero count are unused.
+  uint64_t Count;
+  // Accumulated time (In unscaled CPU cycles!)
+  // Time spent in guest callbacks invoked by the host function is not included.
+  uint64_t AccumulatedHostTime;
+};
+
+static_assert(sizeof(ThunkStatsHeader) % 16 == 0, "Needs to be 16-byte aligned!");
+static_assert(sizeof(ThunkStats) % 16 == 0, "Needs to be 16-byte aligned!");
+
+constexpr size_t GetLatencyBucket(uint64_t Cycles) {
+  return std::min<size_t>(std::bit_width(Cycles), SYSCALL_LATENCY_BUCKETS - 1);
+}
+
 template<typename T, size_t FlatOffset = 0>
 class AccumulationBlock final {
 public:
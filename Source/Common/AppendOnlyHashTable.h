@@ -0,0 +1,109 @@
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#include <FEXCore/fextl/memory.h>
+#include <FEXCore/fextl/vector.h>
+
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+
+namespace FEX {
+/**
+ * Hash table that supports lookups without taking any locks.
+ *
+ * Entries can be added or updated but never removed, and writers must be
+ * serialized by the caller. Storage that was replaced when growing the
+ * table stays alive, so concurrent readers can finish their lookup in it.
+ */
+template<typename KeyT, typename ValueT, typename HashT>
+class AppendOnlyHashTable final {
+  static_assert(std::is_pointer_v<ValueT>, "Null values are used to mark empty slots");
+
+public:
+  AppendOnlyHashTable() {
+    Grow(64);
+  }
+
+  ValueT Find(const KeyT& Key) const {
+    const auto Storage = Current.load(std::memory_order_acquire);
+    const size_t Mask = Storage->Entries.size() - 1;
+    for (size_t i = HashT {}(Key) & Mask;; i = (i + 1) & Mask) {
+      const auto& Entry = Storage->Entries[i];
+      // The key is written before the value is published and never changes afterwards
+      const auto Value = Entry.Value.load(std::memory_order_acquire);
+      if (!Value) {
+        return nullptr;
+      }
+      if (Entry.Key == Key) {
+        return Value;
+      }
+    }
+  }
+
+  void Insert(const KeyT& Key, ValueT Value) {
+    auto Storage = Current.load(std::memory_order_relaxed);
+    if (auto Entry = FindSlot(*Storage, Key); Entry->Value.load(std::memory_order_relaxed)) {
+      Entry->Value.store(Value, std::memory_order_release);
+      return;
+    }
+
+    // Keep the load factor below 3/4 so that probe sequences stay short
+    if ((Storage->Used + 1) * 4 > Storage->Entries.size() * 3) {
+      Storage = Grow(Storage->Entries.size() * 2);
+    }
+
+    auto Entry = FindSlot(*Storage, Key);
+    Entry->Key = Key;
+    Entry->Value.store(Value, std::memory_order_release);
+    ++Storage->Used;
+  }
+
+private:
+  struct Entry {
+    KeyT Key {};
+    std::atomic<ValueT> Value {};
+  };
+
+  struct Storage {
+    explicit Storage(size_t Capacity)
+      : Entries(Capacity) {}
+
+    // Size is always a power of two
+    fextl::vector<Entry> Entries;
+    size_t Used {};
+  };
+
+  // Returns the slot holding Key, or the empty slot it should be inserted into
+  static Entry* FindSlot(Storage& Storage, const KeyT& Key) {
+    const size_t Mask = Storage.Entries.size() - 1;
+    for (size_t i = HashT {}(Key) & Mask;; i = (i + 1) & Mask) {
+      auto& Entry = Storage.Entries[i];
+      if (!Entry.Value.load(std::memory_order_relaxed) || Entry.Key == Key) {
+        return &Entry;
+      }
+    }
+  }
+
+  Storage* Grow(size_t Capacity) {
+    auto& NewStorage = *AllStorage.emplace_back(fextl::make_unique<Storage>(Capacity));
+
+    if (auto OldStorage = Current.load(std::memory_order_relaxed)) {
+      for (auto& OldEntry : OldStorage->Entries) {
+        if (auto Value = OldEntry.Value.load(std::memory_order_relaxed)) {
+          auto Entry = FindSlot(NewStorage, OldEntry.Key);
+          Entry->Key = OldEntry.Key;
+          Entry->Value.store(Value, std::memory_order_relaxed);
+          ++NewStorage.Used;
+        }
+      }
+    }
+
+    Current.store(&NewStorage, std::memory_order_release);
+    return &NewStorage;
+  }
+
+  std::atomic<Storage*> Current {};
+  fextl::vector<fextl::unique_ptr<Storage>> AllStorage;
+};
+} // namespace FEX
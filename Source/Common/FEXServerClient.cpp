@@ -405,6 +405,10 @@ int RequestPIDFD(int ServerSocket) {
   return RequestPIDFDPacket(ServerSocket, PacketType::TYPE_GET_PID_FD);
 }
 
+int RequestRootFSIndexFD(int ServerSocket) {
+  return RequestPIDFDPacket(ServerSocket, PacketType::TYPE_GET_ROOTFS_INDEX_FD);
+}
+
 void PopulateCodeCache(int ServerSocket, int ProgramFD, bool HasMultiblock) {
   fasio::error ec;
   fasio::tcp_socket Socket {ServerSocket};
@@ -23,6 +23,7 @@ enum class PacketType {
   TYPE_POPULATE_CODE_CACHE_NO_MULTIBLOCK,
   TYPE_QUERY_CODE_MAP,
   TYPE_QUERY_CODE_MAP_NO_MULTIBLOCK,
+  TYPE_GET_ROOTFS_INDEX_FD,
 
   // Result only
   TYPE_SUCCESS,
@@ -124,6 +125,15 @@ fextl::string RequestRootFSPath(int ServerSocket);
  */
 int RequestPIDFD(int ServerSocket);
 
+/**
+ * @brief Request a FEXServer to give us the path index of the mounted rootfs image
+ *
+ * @param ServerSocket - Socket to the server
+ *
+ * @return Sealed memfd holding a RootFSIndex, or -1 if the rootfs isn't an image or the index isn't ready yet
+ */
+int RequestRootFSIndexFD(int ServerSocket);
+
 /**
  * @brief Request FEXServer to populate the disk cache for the given executable
  *        and any libraries referenced in its code map
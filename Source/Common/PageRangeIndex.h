@@ -0,0 +1,249 @@
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#include <FEXCore/fextl/vector.h>
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+namespace FEX {
+/**
+ * @brief Tracks which pages of the 32-bit address space are in use and finds free page ranges in logarithmic time.
+ *
+ * Pages are stored as a bitmap, one 64-bit word per 64 pages. On top of that sits a segment tree where every node
+ * stores the length of the free run at its start, at its end, and the longest free run anywhere inside it.
+ * Searches skip any subtree whose longest run is too short, so the cost no longer scales with how fragmented the
+ * address space is.
+ */
+class PageRangeIndex final {
+public:
+  static constexpr uint64_t NumPages = 0x10'0000;
+  static constexpr uint64_t NoRange = ~0ULL;
+
+  PageRangeIndex()
+    : Words(NumWords)
+    , Tree(NumWords * 2) {
+    for (size_t Node = 1; Node < Tree.size(); ++Node) {
+      const uint32_t Length = NodeLength(Node);
+      Tree[Node] = {Length, Length, Length};
+    }
+  }
+
+  bool IsUsed(uint64_t Page) const {
+    return (Words[Page / 64] >> (Page % 64)) & 1;
+  }
+
+  bool IsRangeFree(uint64_t Page, uint64_t Pages) const {
+    if (Page >= NumPages || Pages > NumPages - Page) {
+      return false;
+    }
+
+    bool Free = true;
+    ForEachWord(Page, Pages, [&](uint64_t Word, uint64_t Mask) { Free &= (Words[Word] & Mask) == 0; });
+    return Free;
+  }
+
+  void SetUsed(uint64_t Page, uint64_t Pages) {
+    Update(Page, Pages, true);
+  }
+
+  void SetFree(uint64_t Page, uint64_t Pages) {
+    Update(Page, Pages, false);
+  }
+
+  // Returns the lowest page at or above `Start` that begins `Pages` free pages, or NoRange.
+  uint64_t FindFirstFit(uint64_t Start, uint64_t Pages) const {
+    if (Pages == 0 || Start >= NumPages) {
+      return Pages == 0 ? Start : NoRange;
+    }
+
+    uint64_t Run = 0;
+    return FindFirst(1, 0, NumPages, Start, Pages, Run);
+  }
+
+  // Returns the lowest page of the highest run of `Pages` free pages that ends at or below `Start`, or NoRange.
+  uint64_t FindLastFit(uint64_t Start, uint64_t Pages) const {
+    if (Pages == 0) {
+      return Start;
+    }
+
+    uint64_t Run = 0;
+    return FindLast(1, 0, NumPages, std::min(Start + 1, NumPages), Pages, Run);
+  }
+
+private:
+  static constexpr size_t NumWords = NumPages / 64;
+
+  struct Node {
+    // Free pages at the start of the node.
+    uint32_t Prefix;
+    // Free pages at the end of the node.
+    uint32_t Suffix;
+    // Longest run of free pages inside the node.
+    uint32_t Max;
+  };
+
+  static uint32_t NodeLength(size_t Node) {
+    return NumPages >> (std::bit_width(Node) - 1);
+  }
+
+  template<typename Fn>
+  static void ForEachWord(uint64_t Page, uint64_t Pages, Fn&& Func) {
+    const uint64_t End = Page + Pages;
+    while (Page < End) {
+      const uint64_t Bit = Page % 64;
+      const uint64_t Count = std::min<uint64_t>(64 - Bit, End - Page);
+      const uint64_t Mask = Count == 64 ? ~0ULL : ((1ULL << Count) - 1) << Bit;
+      Func(Page / 64, Mask);
+      Page += Count;
+    }
+  }
+
+  void Update(uint64_t Page, uint64_t Pages, bool Used) {
+    if (Page >= NumPages || Pages == 0) {
+      return;
+    }
+    Pages = std::min(Pages, NumPages - Page);
+
+    ForEachWord(Page, Pages, [&](uint64_t Word, uint64_t Mask) {
+      if (Used) {
+        Words[Word] |= Mask;
+      } else {
+        Words[Word] &= ~Mask;
+      }
+    });
+
+    // Refresh the touched leaves, then every ancestor level above them.
+    size_t First = NumWords + Page / 64;
+    size_t Last = NumWords + (Page + Pages - 1) / 64;
+    for (size_t Leaf = First; Leaf <= Last; ++Leaf) {
+      UpdateLeaf(Leaf);
+    }
+
+    for (First >>= 1, Last >>= 1; First >= 1; First >>= 1, Last >>= 1) {
+      for (size_t Parent = First; Parent <= Last; ++Parent) {
+        UpdateParent(Parent);
+      }
+    }
+  }
+
+  void UpdateLeaf(size_t Leaf) {
+    const uint64_t Word = Words[Leaf - NumWords];
+    uint32_t Max = 0;
+    uint64_t Free = ~Word;
+    while (Free) {
+      Free >>= std::countr_zero(Free);
+      const uint32_t Run = std::countr_one(Free);
+      Max = std::max(Max, Run);
+      if (Run == 64) {
+        break;
+      }
+      Free >>= Run;
+    }
+
+    Tree[Leaf] = {
+      .Prefix = static_cast<uint32_t>(std::countr_zero(Word)),
+      .Suffix = static_cast<uint32_t>(std::countl_zero(Word)),
+      .Max = Max,
+    };
+  }
+
+  void UpdateParent(size_t Parent) {
+    const auto& Left = Tree[Parent * 2];
+    const auto& Right = Tree[Parent * 2 + 1];
+    const uint32_t Half = NodeLength(Parent) / 2;
+
+    Tree[Parent] = {
+      .Prefix = Left.Prefix == Half ? Half + Right.Prefix : Left.Prefix,
+      .Suffix = Right.Suffix == Half ? Half + Left.Suffix : Right.Suffix,
+      .Max = std::max({Left.Max, Right.Max, Left.Suffix + Right.Prefix}),
+    };
+  }
+
+  // `Run` is the number of free pages at or above `Start` directly below `Lo`.
+  uint64_t FindFirst(size_t NodeIndex, uint64_t Lo, uint64_t Hi, uint64_t Start, uint64_t Pages, uint64_t& Run) const {
+    if (Hi <= Start) {
+      return NoRange;
+    }
+
+    const auto& Current = Tree[NodeIndex];
+    const uint64_t Length = Hi - Lo;
+    if (Lo >= Start) {
+      if (Run + Current.Prefix >= Pages) {
+        return Lo - Run;
+      }
+
+      if (Current.Max < Pages) {
+        // Nothing fits inside, only the free run at the end can carry over.
+        Run = Current.Prefix == Length ? Run + Length : Current.Suffix;
+        return NoRange;
+      }
+    }
+
+    if (NodeIndex >= NumWords) {
+      const uint64_t Word = Words[NodeIndex - NumWords];
+      for (uint64_t Page = std::max(Lo, Start); Page < Hi; ++Page) {
+        if ((Word >> (Page - Lo)) & 1) {
+          Run = 0;
+        } else if (++Run == Pages) {
+          return Page + 1 - Pages;
+        }
+      }
+      return NoRange;
+    }
+
+    const uint64_t Mid = Lo + Length / 2;
+    const uint64_t Result = FindFirst(NodeIndex * 2, Lo, Mid, Start, Pages, Run);
+    if (Result != NoRange) {
+      return Result;
+    }
+    return FindFirst(NodeIndex * 2 + 1, Mid, Hi, Start, Pages, Run);
+  }
+
+  // Mirror of FindFirst, walking down from `End` (exclusive). `Run` is the number of free pages below `End` directly above `Hi`.
+  uint64_t FindLast(size_t NodeIndex, uint64_t Lo, uint64_t Hi, uint64_t End, uint64_t Pages, uint64_t& Run) const {
+    if (Lo >= End) {
+      return NoRange;
+    }
+
+    const auto& Current = Tree[NodeIndex];
+    const uint64_t Length = Hi - Lo;
+    if (Hi <= End) {
+      if (Run + Current.Suffix >= Pages) {
+        return Hi + Run - Pages;
+      }
+
+      if (Current.Max < Pages) {
+        Run = Current.Suffix == Length ? Run + Length : Current.Prefix;
+        return NoRange;
+      }
+    }
+
+    if (NodeIndex >= NumWords) {
+      const uint64_t Word = Words[NodeIndex - NumWords];
+      for (uint64_t Page = std::min(Hi, End); Page-- > Lo;) {
+        if ((Word >> (Page - Lo)) & 1) {
+          Run = 0;
+        } else if (++Run == Pages) {
+          return Page;
+        }
+      }
+      return NoRange;
+    }
+
+    const uint64_t Mid = Lo + Length / 2;
+    const uint64_t Result = FindLast(NodeIndex * 2 + 1, Mid, Hi, End, Pages, Run);
+    if (Result != NoRange) {
+      return Result;
+    }
+    return FindLast(NodeIndex * 2, Lo, Mid, End, Pages, Run);
+  }
+
+  // Set bits are used pages.
+  fextl::vector<uint64_t> Words;
+  // Implicit binary tree, node 1 is the root and the leaves start at NumWords.
+  fextl::vector<Node> Tree;
+};
+} // namespace FEX
@@ -0,0 +1,105 @@
+// SPDX-License-Identifier: MIT
+#include "Common/ProtectedPageMap.h"
+
+#include <FEXCore/Utils/AllocatorHooks.h>
+#include <FEXCore/Utils/LogManager.h>
+#include <FEXCore/Utils/MathUtils.h>
+
+#include <algorithm>
+#include <sys/mman.h>
+
+namespace FEX {
+ProtectedPageMap::~ProtectedPageMap() {
+  for (auto& Leaf : Leaves) {
+    if (auto Ptr = Leaf.load(std::memory_order_relaxed)) {
+      FEXCore::Allocator::munmap(Ptr, LEAF_SIZE);
+    }
+  }
+}
+
+template<typename F>
+void ProtectedPageMap::ForEachLeaf(uint64_t Base, uint64_t Length, F&& Func) {
+  auto Page = Base >> FEXCore::Utils::FEX_PAGE_SHIFT;
+  const auto TopPage = std::min(FEXCore::AlignUp(Base + Length, FEXCore::Utils::FEX_PAGE_SIZE) >> FEXCore::Utils::FEX_PAGE_SHIFT, MAX_PAGES);
+
+  while (Page < TopPage) {
+    const auto FirstBit = Page % PAGES_PER_LEAF;
+    const auto Count = std::min(PAGES_PER_LEAF - FirstBit, TopPage - Page);
+    Func(Page / PAGES_PER_LEAF, FirstBit, Count);
+    Page += Count;
+  }
+}
+
+// Calls Func(Word, Mask) for every bitmap word covering [FirstBit, FirstBit + Count)
+template<typename F>
+static void ForEachWord(uint64_t FirstBit, uint64_t Count, F&& Func) {
+  const auto TopBit = FirstBit + Count;
+  while (FirstBit < TopBit) {
+    const auto Shift = FirstBit % 64;
+    const auto Bits = std::min<uint64_t>(64 - Shift, TopBit - FirstBit);
+    const uint64_t Mask = (Bits == 64 ? ~0ULL : ((1ULL << Bits) - 1)) << Shift;
+    if (Func(FirstBit / 64, Mask)) {
+      return;
+    }
+    FirstBit += Bits;
+  }
+}
+
+uint64_t* ProtectedPageMap::GetOrAllocateLeaf(uint64_t Index) {
+  auto Leaf = Leaves[Index].load(std::memory_order_acquire);
+  if (Leaf) {
+    return Leaf;
+  }
+
+  // Multiple threads can be marking under the shared lock, whoever loses the race frees its allocation.
+  auto NewLeaf = reinterpret_cast<uint64_t*>(
+    FEXCore::Allocator::mmap(nullptr, LEAF_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0));
+  LOGMAN_THROW_A_FMT(NewLeaf != MAP_FAILED, "Couldn't allocate protected page map");
+
+  if (!Leaves[Index].compare_exchange_strong(Leaf, NewLeaf, std::memory_order_acq_rel)) {
+    FEXCore::Allocator::munmap(NewLeaf, LEAF_SIZE);
+    return Leaf;
+  }
+  return NewLeaf;
+}
+
+void ProtectedPageMap::Mark(uint64_t Base, uint64_t Length) {
+  ForEachLeaf(Base, Length, [this](uint64_t Index, uint64_t FirstBit, uint64_t Count) {
+    auto Leaf = GetOrAllocateLeaf(Index);
+    ForEachWord(FirstBit, Count, [Leaf](uint64_t Word, uint64_t Mask) {
+      std::atomic_ref(Leaf[Word]).fetch_or(Mask, std::memory_order_release);
+      return false;
+    });
+  });
+}
+
+void ProtectedPageMap::Clear(uint64_t Base, uint64_t Length) {
+  ForEachLeaf(Base, Length, [this](uint64_t Index, uint64_t FirstBit, uint64_t Count) {
+    auto Leaf = Leaves[Index].load(std::memory_order_relaxed);
+    if (!Leaf) {
+      return;
+    }
+
+    ForEachWord(FirstBit, Count, [Leaf](uint64_t Word, uint64_t Mask) {
+      std::atomic_ref(Leaf[Word]).fetch_and(~Mask, std::memory_order_relaxed);
+      return false;
+    });
+  });
+}
+
+bool ProtectedPageMap::IsAnyMarked(uint64_t Base, uint64_t Length) const {
+  bool Marked = false;
+  ForEachLeaf(Base, Length, [this, &Marked](uint64_t Index, uint64_t FirstBit, uint64_t Count) {
+    auto Leaf = Leaves[Index].load(std::memory_order_acquire);
+    if (!Leaf || Marked) {
+      return;
+    }
+
+    ForEachWord(FirstBit, Count, [Leaf, &Marked](uint64_t Word, uint64_t Mask) {
+      Marked = std::atomic_ref(Leaf[Word]).load(std::memory_order_relaxed) & Mask;
+      return Marked;
+    });
+  });
+  return Marked;
+}
+} // namespace FEX
@@ -0,0 +1,83 @@
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#include <FEXCore/Utils/TypeDefines.h>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace FEX {
+// Lock-free set of the guest pages FEX has write protected for SMC detection.
+// Lets the SIGSEGV handler forward faults on every other page to the guest without taking the VMATracking Mutex.
+// A page is marked before it gets protected and only cleared once it gets unmapped, so a marked page might not be
+// protected anymore but an unmarked page is never protected by FEX.
+class ProtectedPageMap final {
+public:
+  ProtectedPageMap() = default;
+  ProtectedPageMap(const ProtectedPageMap&) = delete;
+  ProtectedPageMap& operator=(const ProtectedPageMap&) = delete;
+  ~ProtectedPageMap();
+
+  // - VMATracking Mutex must be at least shared_locked before calling
+  void Mark(uint64_t Base, uint64_t Length);
+
+  // - VMATracking Mutex must be unique_locked before calling
+  void Clear(uint64_t Base, uint64_t Length);
+
+  // - VMATracking Mutex must be at least shared_locked before calling
+  bool IsAnyMarked(uint64_t Base, uint64_t Length) const;
+
+  // - Mutex doesn't need to be held
+  bool IsMarked(uint64_t GuestAddr) const {
+    const auto Page = GuestAddr >> FEXCore::Utils::FEX_PAGE_SHIFT;
+    if (Page >= MAX_PAGES) {
+      return false;
+    }
+
+    const auto Leaf = Leaves[Page / PAGES_PER_LEAF].load(std::memory_order_acquire);
+    if (!Leaf) {
+      return false;
+    }
+
+    const auto Index = Page % PAGES_PER_LEAF;
+    return std::atomic_ref(Leaf[Index / 64]).load(std::memory_order_acquire) & (1ULL << (Index % 64));
+  }
+
+  // mremap carries FEX's protection over to the new range before it can be marked there.
+  // Faults need to take the locked path while one is in flight.
+  class RemapGuard final {
+  public:
+    explicit RemapGuard(ProtectedPageMap& Map)
+      : Map {Map} {
+      Map.PendingRemaps.fetch_add(1);
+    }
+    ~RemapGuard() {
+      Map.PendingRemaps.fetch_sub(1, std::memory_order_release);
+    }
+
+  private:
+    ProtectedPageMap& Map;
+  };
+
+  // - Mutex doesn't need to be held
+  bool MightBeProtected(uint64_t GuestAddr) const {
+    return PendingRemaps.load(std::memory_order_acquire) != 0 || IsMarked(GuestAddr);
+  }
+
+private:
+  // Covers the full 47-bit guest address space, each leaf is a lazily allocated 128KiB bitmap covering 4GiB.
+  constexpr static uint64_t MAX_PAGES = (1ULL << 47) >> FEXCore::Utils::FEX_PAGE_SHIFT;
+  constexpr static uint64_t PAGES_PER_LEAF = (1ULL << 32) >> FEXCore::Utils::FEX_PAGE_SHIFT;
+  constexpr static uint64_t LEAF_SIZE = PAGES_PER_LEAF / 8;
+
+  // Calls Func(Leaf, FirstBit, Count) for every leaf overlapping the page range.
+  template<typename F>
+  static void ForEachLeaf(uint64_t Base, uint64_t Length, F&& Func);
+
+  uint64_t* GetOrAllocateLeaf(uint64_t Index);
+
+  std::array<std::atomic<uint64_t*>, MAX_PAGES / PAGES_PER_LEAF> Leaves {};
+  std::atomic<uint32_t> PendingRemaps {};
+};
+} // namespace FEX
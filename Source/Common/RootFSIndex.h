@@ -0,0 +1,228 @@
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <linux/limits.h>
+#include <span>
+#include <string_view>
+#include <sys/stat.h>
+
+/**
+ * @brief Sorted path index of a rootfs image.
+ *
+ * FEXServer walks a freshly mounted squashfs/erofs image once, caches the result on disk and hands it to clients as a
+ * sealed memfd. Clients map it read-only and answer existence and symlink questions without going through FUSE.
+ *
+ * Layout: Header, followed by `NumEntries` Entry structures sorted by path, followed by the string table.
+ * Paths are relative to the image root, without a leading or trailing slash.
+ */
+namespace FEX::RootFSIndex {
+constexpr uint64_t MAGIC = 0x5844'4E49'5346'5852ULL; // "RXFSINDX"
+constexpr uint32_t VERSION = 2;
+
+struct Header {
+  uint64_t Magic;
+  uint32_t Version;
+  uint32_t NumEntries;
+  // Hash of the image this index was generated from.
+  uint64_t ImageHash;
+  uint64_t StringTableSize;
+};
+
+struct Entry {
+  uint32_t PathOffset;
+  uint32_t PathLength;
+  // Symlink target, only valid for S_IFLNK.
+  uint32_t TargetOffset;
+  uint32_t TargetLength;
+  uint32_t Mode;
+  uint32_t Pad;
+};
+
+static_assert(sizeof(Header) == 32, "Wrong size");
+static_assert(sizeof(Entry) == 24, "Wrong size");
+
+enum class LookupResult {
+  // The path can't be answered from the index, resolve it through the mount.
+  Unknown,
+  // The path doesn't exist in the image.
+  Missing,
+  Found,
+};
+
+class View final {
+public:
+  View() = default;
+
+  // Returns false if `Data` isn't a well-formed index.
+  bool Init(std::span<const std::byte> Data) {
+    if (Data.size() < sizeof(Header)) {
+      return false;
+    }
+
+    auto Head = reinterpret_cast<const Header*>(Data.data());
+    if (Head->Magic != MAGIC || Head->Version != VERSION) {
+      return false;
+    }
+
+    const size_t EntriesSize = size_t {Head->NumEntries} * sizeof(Entry);
+    if (Data.size() != sizeof(Header) + EntriesSize + Head->StringTableSize) {
+      return false;
+    }
+
+    Entries = {reinterpret_cast<const Entry*>(Data.data() + sizeof(Header)), Head->NumEntries};
+    Strings = {reinterpret_cast<const char*>(Data.data() + sizeof(Header) + EntriesSize), Head->StringTableSize};
+
+    for (const auto& It : Entries) {
+      if (size_t {It.PathOffset} + It.PathLength > Strings.size() || size_t {It.TargetOffset} + It.TargetLength > Strings.size()) {
+        Entries = {};
+        Strings = {};
+        return false;
+      }
+    }
+
+    Loaded = true;
+    return true;
+  }
+
+  std::string_view GetPath(const Entry& It) const {
+    return Strings.substr(It.PathOffset, It.PathLength);
+  }
+
+  std::string_view GetTarget(const Entry& It) const {
+    return Strings.substr(It.TargetOffset, It.TargetLength);
+  }
+
+  /**
+   * @brief Looks up a rootfs relative path without following a final symlink.
+   *
+   * Only canonical paths are answered. Paths with empty, `.` or `..` components, or that go through a symlinked directory,
+   * return Unknown since resolving those is left to the kernel.
+   */
+  LookupResult Find(std::string_view Path, const Entry** Result) const {
+    if (!Loaded || !IsCanonical(Path)) {
+      return LookupResult::Unknown;
+    }
+
+    if (auto It = FindExact(Path)) {
+      *Result = It;
+      return LookupResult::Found;
+    }
+
+    // Not in the image as written, but a parent component could still redirect through a symlink.
+    for (size_t Slash = Path.find('/'); Slash != std::string_view::npos; Slash = Path.find('/', Slash + 1)) {
+      auto Parent = FindExact(Path.substr(0, Slash));
+      if (!Parent) {
+        return LookupResult::Missing;
+      }
+
+      if (S_ISLNK(Parent->Mode)) {
+        return LookupResult::Unknown;
+      }
+
+      if (!S_ISDIR(Parent->Mode)) {
+        // ENOTDIR
+        return LookupResult::Missing;
+      }
+    }
+
+    return LookupResult::Missing;
+  }
+
+  /**
+   * @brief Resolves an absolute path inside the rootfs, following absolute symlinks if `FollowSymlink` is set.
+   *
+   * Mirrors the fstatat and readlinkat walk of FileManager::GetEmulatedFDPath. On Found, `*Result` is the rootfs relative
+   * path, which may point in to `TmpPaths`. A dangling symlink resolves to its last target like the walk does.
+   */
+  LookupResult Resolve(const char* Path, bool FollowSymlink, std::array<char[PATH_MAX], 2>& TmpPaths, const char** Result) const {
+    // Matches the kernel's MAXSYMLINKS.
+    constexpr size_t MaxSymlinkHops = 40;
+
+    const char* SubPath = Path;
+    uint32_t CurrentIndex {};
+    bool HadAtLeastOne {};
+
+    for (size_t Hops = 0;; ++Hops) {
+      if (Hops == MaxSymlinkHops) {
+        // Let the kernel report the loop.
+        return LookupResult::Unknown;
+      }
+
+      const Entry* It {};
+      switch (Find(&SubPath[1], &It)) {
+      case LookupResult::Unknown: return LookupResult::Unknown;
+      case LookupResult::Missing:
+        if (!HadAtLeastOne) {
+          // Initial file didn't exist at all
+          return LookupResult::Missing;
+        }
+        // Dangling symlink, return the last path like the fstatat walk does.
+        *Result = &SubPath[1];
+        return LookupResult::Found;
+      case LookupResult::Found: break;
+      }
+
+      HadAtLeastOne = true;
+
+      if (!FollowSymlink || !S_ISLNK(It->Mode)) {
+        break;
+      }
+
+      const auto Target = GetTarget(*It);
+      if (Target.size() <= 1 || Target.size() >= PATH_MAX || Target[0] != '/') {
+        // Relative symlinks are left for the kernel to resolve.
+        break;
+      }
+
+      auto CurrentTmp = TmpPaths[CurrentIndex];
+      memcpy(CurrentTmp, Target.data(), Target.size());
+      CurrentTmp[Target.size()] = 0;
+      SubPath = CurrentTmp;
+      CurrentIndex ^= 1;
+    }
+
+    *Result = &SubPath[1];
+    return LookupResult::Found;
+  }
+
+private:
+  static bool IsCanonical(std::string_view Path) {
+    if (Path.empty() || Path.front() == '/' || Path.back() == '/') {
+      return false;
+    }
+
+    size_t Start = 0;
+    while (Start <= Path.size()) {
+      size_t End = Path.find('/', Start);
+      if (End == std::string_view::npos) {
+        End = Path.size();
+      }
+
+      const auto Component = Path.substr(Start, End - Start);
+      if (Component.empty() || Component == "." || Component == "..") {
+        return false;
+      }
+      Start = End + 1;
+    }
+
+    return true;
+  }
+
+  const Entry* FindExact(std::string_view Path) const {
+    auto It = std::ranges::lower_bound(Entries, Path, {}, [this](const Entry& E) { return GetPath(E); });
+    if (It == Entries.end() || GetPath(*It) != Path) {
+      return nullptr;
+    }
+    return &*It;
+  }
+
+  std::span<const Entry> Entries;
+  std::string_view Strings;
+  bool Loaded {};
+};
+} // namespace FEX::RootFSIndex
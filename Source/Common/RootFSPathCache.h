@@ -0,0 +1,154 @@
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#include <FEXCore/Utils/SignalScopeGuards.h>
+#include <FEXCore/fextl/string.h>
+#include <FEXCore/fextl/unordered_map.h>
+
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <fcntl.h>
+#include <functional>
+#include <linux/limits.h>
+#include <mutex>
+#include <shared_mutex>
+#include <string_view>
+#include <sys/stat.h>
+
+namespace FEX {
+/**
+ * @brief Remembers how absolute guest paths resolve inside of the rootfs.
+ *
+ * Every absolute path syscall probes the rootfs first, with an fstatat plus a readlinkat per symlink hop, before falling back to the host.
+ * When the rootfs is a squashfs or erofs image mounted through FUSE each of those probes is a round trip to the FUSE helper.
+ *
+ * Since a read-only image can't change underneath us, both outcomes can be cached:
+ * - Positive entries store the rootfs relative path after following absolute symlinks.
+ * - Negative entries store that the path doesn't exist in the rootfs, so the caller goes straight to the host.
+ *
+ * The cache is only used when the rootfs is mounted read-only. It is cleared wholesale when it fills up.
+ * The mutex must be handled around fork through `LockBeforeFork`/`UnlockAfterFork`, like the other forkable mutexes.
+ */
+class RootFSPathCache final {
+public:
+  enum class LookupResult {
+    Miss,
+    NotInRootFS,
+    Resolved,
+  };
+
+  // On `Resolved` the rootfs relative path is copied to `ResolvedPath`, which must be PATH_MAX bytes.
+  LookupResult Find(std::string_view Path, bool FollowSymlink, char* ResolvedPath) {
+    std::shared_lock lk {Mutex};
+    auto& Map = FollowSymlink ? Follow : NoFollow;
+    auto It = Map.find(Path);
+    if (It == Map.end()) {
+      Misses.fetch_add(1, std::memory_order_relaxed);
+      return LookupResult::Miss;
+    }
+
+    if (!It->second.Exists) {
+      NegativeHits.fetch_add(1, std::memory_order_relaxed);
+      return LookupResult::NotInRootFS;
+    }
+
+    Hits.fetch_add(1, std::memory_order_relaxed);
+    const auto& Resolved = It->second.Resolved;
+    memcpy(ResolvedPath, Resolved.c_str(), Resolved.size() + 1);
+    return LookupResult::Resolved;
+  }
+
+  // Lookup without following symlinks. On a miss the rootfs is probed once and the outcome is cached.
+  // `Path` is absolute, on `Resolved` the rootfs relative path is copied to `ResolvedPath`, which must be PATH_MAX bytes.
+  LookupResult FindOrProbeNoFollow(int RootFSFD, const char* Path, char* ResolvedPath) {
+    const auto Result = Find(Path, false, ResolvedPath);
+    if (Result != LookupResult::Miss) {
+      return Result;
+    }
+
+    struct stat Buffer {};
+    if (fstatat(RootFSFD, &Path[1], &Buffer, AT_SYMLINK_NOFOLLOW) != 0) {
+      if (errno == ENOENT || errno == ENOTDIR) {
+        InsertNotInRootFS(Path, false);
+        return LookupResult::NotInRootFS;
+      }
+    } else {
+      InsertResolved(Path, false, &Path[1]);
+    }
+
+    // Other errors are left to the caller's rootfs attempt.
+    strncpy(ResolvedPath, &Path[1], PATH_MAX - 1);
+    ResolvedPath[PATH_MAX - 1] = 0;
+    return LookupResult::Resolved;
+  }
+
+  void InsertResolved(std::string_view Path, bool FollowSymlink, std::string_view Resolved) {
+    if (Resolved.size() >= PATH_MAX) {
+      return;
+    }
+    Insert(Path, FollowSymlink, Entry {true, fextl::string {Resolved}});
+  }
+
+  void InsertNotInRootFS(std::string_view Path, bool FollowSymlink) {
+    Insert(Path, FollowSymlink, Entry {false, {}});
+  }
+
+  void LockBeforeFork() {
+    Mutex.lock();
+  }
+
+  void UnlockAfterFork(bool Child) {
+    if (Child) {
+      Mutex.StealAndDropActiveLocks();
+    } else {
+      Mutex.unlock();
+    }
+  }
+
+  uint64_t GetHits() const {
+    return Hits.load(std::memory_order_relaxed);
+  }
+  uint64_t GetNegativeHits() const {
+    return NegativeHits.load(std::memory_order_relaxed);
+  }
+  uint64_t GetMisses() const {
+    return Misses.load(std::memory_order_relaxed);
+  }
+
+private:
+  constexpr static size_t MaxEntries = 1U << 16;
+
+  struct Entry {
+    bool Exists;
+    fextl::string Resolved;
+  };
+
+  struct PathHash {
+    using is_transparent = void;
+    size_t operator()(std::string_view Path) const {
+      return std::hash<std::string_view> {}(Path);
+    }
+  };
+  using PathMap = fextl::unordered_map<fextl::string, Entry, PathHash, std::equal_to<>>;
+
+  void Insert(std::string_view Path, bool FollowSymlink, Entry&& NewEntry) {
+    std::unique_lock lk {Mutex};
+    auto& Map = FollowSymlink ? Follow : NoFollow;
+    if (Map.size() >= MaxEntries) {
+      // Programs walking huge trees would otherwise grow this without bound.
+      Map.clear();
+    }
+    Map.try_emplace(fextl::string {Path}, std::move(NewEntry));
+  }
+
+  FEXCore::ForkableSharedMutex Mutex;
+  PathMap Follow;
+  PathMap NoFollow;
+
+  std::atomic<uint64_t> Hits {};
+  std::atomic<uint64_t> NegativeHits {};
+  std::atomic<uint64_t> Misses {};
+};
+} // namespace FEX
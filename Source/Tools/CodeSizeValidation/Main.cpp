@@ -1,5 +1,6 @@
 // SPDX-License-Identifier: MIT
 #include "DummyHandlers.h"
+#include "InstCountCI.h"
 #include "Common/HostFeatures.h"
 #include "FEXCore/Core/Context.h"
 #include "FEXCore/Debug/InternalThreadState.h"
@@ -90,11 +91,8 @@ private:
   bool SetupInfoDisabled {};
 };
 
-constexpr std::string_view RIPMessage = "RIP: 0x";
-constexpr std::string_view GuestCodeMessage = "Guest Code instructions: ";
 constexpr std::string_view DisassembleBeginMessage = "Disassemble Begin";
 constexpr std::string_view DisassembleEndMessage = "Disassemble End";
-constexpr std::string_view BlowUpMsg = "Blow-up Amt: ";
 
 static std::string_view SanitizeDisassembly(std::string_view Message) {
   auto it = Message.find(" (addr");
@@ -109,17 +107,15 @@ static std::string_view SanitizeDisassembly(std::string_view Message) {
 bool CodeSizeValidation::ParseMessage(const char* Message) {
   // std::string_view doesn't have contains until c++23.
   std::string_view MessageView {Message};
-  if (MessageView.find(RIPMessage) != MessageView.npos) {
+  if (auto RIP = FEX::InstCountCI::ParseStatsMessage(MessageView, FEX::InstCountCI::RIPMessage, 16)) {
     // New RIP found
-    std::string_view RIPView = std::string_view {Message + RIPMessage.size()};
-    std::from_chars(RIPView.data(), RIPView.end(), CurrentRIPParse, 16);
+    CurrentRIPParse = *RIP;
     ClearStats();
     return false;
   }
 
-  if (MessageView.find(GuestCodeMessage) != MessageView.npos) {
-    std::string_view CodeSizeView = std::string_view {Message + GuestCodeMessage.size()};
-    std::from_chars(CodeSizeView.data(), CodeSizeView.end(), CurrentStats.first.GuestCodeInstructions);
+  if (auto GuestCode = FEX::InstCountCI::ParseStatsMessage(MessageView, FEX::InstCountCI::GuestCodeMessage)) {
+    CurrentStats.first.GuestCodeInstructions = *GuestCode;
     return false;
   }
   if (MessageView.find(DisassembleBeginMessage) != MessageView.npos) {
@@ -142,7 +138,7 @@ bool CodeSizeValidation::ParseMessage(const char* Message) {
     return false;
   }
 
-  if (MessageView.find(BlowUpMsg) != MessageView.npos) {
+  if (MessageView.starts_with(FEX::InstCountCI::BlowUpMessage)) {
     return false;
   }
 
@@ -213,38 +209,19 @@ void AssertHandler(const char* Message) {
   fflush(nullptr);
 }
 
-struct TestInfo {
-  char TestInst[128];
-  int64_t ExpectedInstructionCount;
-  uint64_t CodeSize;
-  uint64_t x86InstCount;
-  uint32_t Cookie;
-  uint8_t Code[];
-};
-
-struct TestHeader {
-  uint64_t Bitness;
-  uint64_t NumTests {};
-  uint64_t EnabledHostFeatures;
-  uint64_t DisabledHostFeatures;
-  uint64_t EnvironmentVariableCount;
-  uint8_t Data[];
-};
+using FEX::InstCountCI::TestInfo;
 
-static void* TestData;
-static size_t TestDataSize;
-static const TestHeader* TestHeaderData {};
-static const TestInfo* TestsStart {};
+static FEX::InstCountCI::TestFile Tests {};
 static fextl::vector<std::pair<std::string_view, std::string_view>> EnvironmentVariables {};
 
 static bool TestInstructions(FEXCore::Context::Context* CTX, FEXCore::Core::InternalThreadState* Thread, const char* UpdatedInstructionCountsPath) {
   LogMan::Msg::IFmt("Compiling code");
 
   // Tell FEXCore to compile all the instructions upfront.
-  const TestInfo* CurrentTest = TestsStart;
+  const TestInfo* CurrentTest = Tests.TestsStart;
   fextl::vector<CodeSize::CodeSizeValidation::InstructionData> TestData {};
-  TestData.resize(TestHeaderData->NumTests);
-  for (size_t i = 0; i < TestHeaderData->NumTests; ++i) {
+  TestData.resize(Tests.Header->NumTests);
+  for (size_t i = 0; i < Tests.Header->NumTests; ++i) {
     uint64_t CodeRIP = (uint64_t)&CurrentTest->Code[0];
     LogMan::Msg::IFmt("Compiling instruction '{}'", CurrentTest->TestInst);
 
@@ -252,14 +229,14 @@ static bool TestInstructions(FEXCore::Context::Context* CTX, FEXCore::Core::Inte
       CodeSize::Validation->CompileAndGetStats(CTX, Thread, reinterpret_cast<void*>(CodeRIP), CurrentTest->CodeSize, CurrentTest->x86InstCount);
 
     // Go to the next test.
-    CurrentTest = reinterpret_cast<const TestInfo*>(&CurrentTest->Code[CurrentTest->CodeSize]);
+    CurrentTest = CurrentTest->Next();
   }
 
   bool TestsPassed {true};
 
   // Get all the data for the instructions compiled.
-  CurrentTest = TestsStart;
-  for (size_t i = 0; i < TestHeaderData->NumTests; ++i) {
+  CurrentTest = Tests.TestsStart;
+  for (size_t i = 0; i < Tests.Header->NumTests; ++i) {
     // Get the instruction stats.
     const auto INSTStats = &TestData[i];
 
@@ -284,7 +261,7 @@ static bool TestInstructions(FEXCore::Context::Context* CTX, FEXCore::Core::Inte
     }
 
     // Go to the next test.
-    CurrentTest = reinterpret_cast<const TestInfo*>(&CurrentTest->Code[CurrentTest->CodeSize]);
+    CurrentTest = CurrentTest->Next();
   }
 
   if (UpdatedInstructionCountsPath) {
@@ -302,8 +279,8 @@ static bool TestInstructions(FEXCore::Context::Context* CTX, FEXCore::Core::Inte
 
     FD.Write("{\n", 2);
 
-    CurrentTest = TestsStart;
-    for (size_t i = 0; i < TestHeaderData->NumTests; ++i) {
+    CurrentTest = Tests.TestsStart;
+    for (size_t i = 0; i < Tests.Header->NumTests; ++i) {
       // Get the instruction stats.
       const auto INSTStats = &TestData[i];
 
@@ -324,7 +301,7 @@ static bool TestInstructions(FEXCore::Context::Context* CTX, FEXCore::Core::Inte
       FD.Write(fextl::fmt::format("\t}},\n", CurrentTest->TestInst));
 
       // Go to the next test.
-      CurrentTest = reinterpret_cast<const TestInfo*>(&CurrentTest->Code[CurrentTest->CodeSize]);
+      CurrentTest = CurrentTest->Next();
     }
 
     // Print a null member
@@ -335,40 +312,6 @@ static bool TestInstructions(FEXCore::Context::Context* CTX, FEXCore::Core::Inte
   return TestsPassed;
 }
 
-bool LoadTests(const char* Path) {
-  int FD = open(Path, O_RDONLY | O_CLOEXEC);
-  if (FD == -1) {
-    return false;
-  }
-
-  struct stat buf;
-  if (fstat(FD, &buf) == -1) {
-    close(FD);
-    return false;
-  }
-
-  TestDataSize = buf.st_size;
-  TestData = FEXCore::Allocator::mmap(nullptr, TestDataSize, PROT_READ, MAP_PRIVATE, FD, 0);
-  if (reinterpret_cast<uint64_t>(TestData) == ~0ULL) {
-    close(FD);
-    return false;
-  }
-
-  close(FD);
-
-  TestHeaderData = reinterpret_cast<const TestHeader*>(TestData);
-
-  // Need to walk past the environment variables to get to the actual tests.
-  const uint8_t* Data = TestHeaderData->Data;
-  for (size_t i = 0; i < TestHeaderData->EnvironmentVariableCount; ++i) {
-    // Environment variables are a pair of null terminated strings.
-    Data += strlen(reinterpret_cast<const char*>(Data)) + 1;
-    Data += strlen(reinterpret_cast<const char*>(Data)) + 1;
-  }
-  TestsStart = reinterpret_cast<const TestInfo*>(Data);
-  return true;
-}
-
 namespace {
 static const fextl::vector<std::pair<const char*, FEXCore::Config::ConfigOption>> EnvConfigLookup = {{
 #define OPT_BASE(type, group, enum, json, default) {"FEX_" #enum, FEXCore::Config::ConfigOption::CONFIG_##enum},
@@ -385,8 +328,8 @@ public:
 
   void Load() override {
     fextl::unordered_map<std::string_view, std::string> EnvMap;
-    const uint8_t* Data = TestHeaderData->Data;
-    for (size_t i = 0; i < TestHeaderData->EnvironmentVariableCount; ++i) {
+    const uint8_t* Data = Tests.Header->Data;
+    for (size_t i = 0; i < Tests.Header->EnvironmentVariableCount; ++i) {
       // Environment variables are a pair of null terminated strings.
       const std::string_view Key = reinterpret_cast<const char*>(Data);
       Data += strlen(reinterpret_cast<const char*>(Data)) + 1;
@@ -476,7 +419,7 @@ int main(int argc, char** argv, char** const envp) {
     return 1;
   }
 
-  if (!LoadTests(argv[1])) {
+  if (!FEX::InstCountCI::LoadTests(argv[1], Tests)) {
     LogMan::Msg::EFmt("Couldn't load tests from {}", argv[1]);
     return 1;
   }
@@ -492,7 +435,7 @@ int main(int argc, char** argv, char** const envp) {
     FEXCore::Config::CONFIG_DISASSEMBLE,
     fextl::fmt::format("{}", static_cast<uint64_t>(FEXCore::Config::Disassemble::BLOCKS | FEXCore::Config::Disassemble::STATS)));
   // Choose bitness.
-  FEXCore::Config::Set(FEXCore::Config::CONFIG_IS64BIT_MODE, TestHeaderData->Bitness == 64 ? "1" : "0");
+  FEXCore::Config::Set(FEXCore::Config::CONFIG_IS64BIT_MODE, Tests.Header->Bitness == 64 ? "1" : "0");
   // Disable telemetry, it can affect instruction counts.
   FEXCore::Config::Set(FEXCore::Config::CONFIG_DISABLETELEMETRY, "1");
   // Disable vixl simulator indirect calls as it can affect instruction counts.
@@ -501,76 +444,57 @@ int main(int argc, char** argv, char** const envp) {
   FEXCore::Config::Set(FEXCore::Config::CONFIG_TSOENABLED, "0");
 
   // Host feature override. Only supports overriding SVE width.
-  enum HostFeatures {
-    FEATURE_SVE128 = (1U << 0),
-    FEATURE_SVE256 = (1U << 1),
-    FEATURE_CLZERO = (1U << 2),
-    FEATURE_RNG = (1U << 3),
-    FEATURE_FCMA = (1U << 4),
-    FEATURE_CSSC = (1U << 5),
-    FEATURE_AFP = (1U << 6),
-    FEATURE_RPRES = (1U << 7),
-    FEATURE_FLAGM = (1U << 8),
-    FEATURE_FLAGM2 = (1U << 9),
-    FEATURE_CRYPTO = (1U << 10),
-    FEATURE_AES256 = (1U << 11),
-    FEATURE_SVEBITPERM = (1U << 12),
-    FEATURE_TSO = (1U << 13),
-    FEATURE_LRCPC = (1U << 14),
-    FEATURE_LRCPC2 = (1U << 15),
-    FEATURE_FRINTTS = (1U << 16),
-  };
-
+  using namespace FEX::InstCountCI;
   uint64_t SVEWidth = 0;
   uint64_t HostFeatureControl {};
-  if (TestHeaderData->EnabledHostFeatures & FEATURE_SVE128) {
+  if (Tests.Header->EnabledHostFeatures & FEATURE_SVE128) {
     HostFeatureControl |= static_cast<uint64_t>(FEXCore::Config::HostFeatures::ENABLESVE);
     SVEWidth = 128;
   }
-  if (TestHeaderData->EnabledHostFeatures & FEATURE_SVE256) {
+  if (Tests.Header->EnabledHostFeatures & FEATURE_SVE256) {
     SVEWidth = 256;
   }
-  if (TestHeaderData->EnabledHostFeatures & FEATURE_CLZERO) {
+  if (Tests.Header->EnabledHostFeatures & FEATURE_CLZERO) {
     HostFeatureControl |= static_cast<uint64_t>(FEXCore::Config::HostFeatures::ENABLECLZERO);
   }
-  if (TestHeaderData->EnabledHostFeatures & FEATURE_RNG) {
+  if (Tests.Header->EnabledHostFeatures & FEATURE_RNG) {
     HostFeatureControl |= static_cast<uint64_t>(FEXCore::Config::HostFeatures::ENABLERNG);
   }
-  if (TestHeaderData->EnabledHostFeatures & FEATURE_FCMA) {
+  if (Tests.Header->EnabledHostFeatures & FEATURE_FCMA) {
     HostFeatureControl |= static_cast<uint64_t>(FEXCore::Config::HostFeatures::ENABLEFCMA);
   }
-  if (TestHeaderData->EnabledHostFeatures & FEATURE_CSSC) {
+  if (Tests.Header->EnabledHostFeatures & FEATURE_CSSC) {
     HostFeatureControl |= static_cast<uint64_t>(FEXCore::Config::HostFeatures::ENABLECSSC);
   }
-  if (TestHeaderData->EnabledHostFeatures & FEATURE_AFP) {
+  if (Tests.Header->EnabledHostFeatures & FEATURE_AFP) {
     HostFeatureControl |= static_cast<uint64_t>(FEXCore::Config::HostFeatures::ENABLEAFP);
   }
-  if (TestHeaderData->EnabledHostFeatures & FEATURE_RPRES) {
+  if (Tests.Header->EnabledHostFeatures & FEATURE_RPRES) {
     HostFeatureControl |= static_cast<uint64_t>(FEXCore::Config::HostFeatures::ENABLERPRES);
   }
-  if (TestHeaderData->EnabledHostFeatures & FEATURE_FLAGM) {
+  if (Tests.Header->EnabledHostFeatures & FEATURE_FLAGM) {
     HostFeatureControl |= static_cast<uint64_t>(FEXCore::Config::HostFeatures::ENABLEFLAGM);
   }
-  if (TestHeaderData->EnabledHostFeatures & FEATURE_FLAGM2) {
+  if (Tests.Header->EnabledHostFeatures & FEATURE_FLAGM2) {
     HostFeatureControl |= static_cast<uint64_t>(FEXCore::Config::HostFeatures::ENABLEFLAGM2);
   }
-  if (TestHeaderData->EnabledHostFeatures & FEATURE_CRYPTO) {
+  if (Tests.Header->EnabledHostFeatures & FEATURE_CRYPTO) {
     HostFeatureControl |= static_cast<uint64_t>(FEXCore::Config::HostFeatures::ENABLECRYPTO);
   }
-  if (TestHeaderData->EnabledHostFeatures & FEATURE_SVEBITPERM) {
+  if (Tests.Header->EnabledHostFeatures & FEATURE_SVEBITPERM) {
     HostFeatureControl |= static_cast<uint64_t>(FEXCore::Config::HostFeatures::ENABLESVEBITPERM);
   }
-  if (TestHeaderData->EnabledHostFeatures & FEATURE_LRCPC) {
+  if (Tests.Header->EnabledHostFeatures & FEATURE_LRCPC) {
     HostFeatureControl |= static_cast<uint64_t>(FEXCore::Config::HostFeatures::ENABLELRCPC);
   }
-  if (TestHeaderData->EnabledHostFeatures & FEATURE_LRCPC2) {
+  if (Tests.Header->EnabledHostFeatures & FEATURE_LRCPC2) {
     HostFeatureControl |= static_cast<uint64_t>(FEXCore::Config::HostFeatures::ENABLELRCPC2);
   }
-  if (TestHeaderData->EnabledHostFeatures & FEATURE_FRINTTS) {
+  if (Tests.Header->EnabledHostFeatures & FEATURE_FRINTTS) {
     HostFeatureControl |= static_cast<uint64_t>(FEXCore::Config::HostFeatures::ENABLEFRINTTS);
   }
 
-  if (TestHeaderData->EnabledHostFeatures & FEATURE_TSO) {
+  if (Tests.Header->EnabledHostFeatures & FEATURE_TSO) {
     FEXCore::Config::Set(FEXCore::Config::ConfigOption::CONFIG_TSOENABLED, "1");
     FEXCore::Config::Set(FEXCore::Config::ConfigOption::CONFIG_VECTORTSOENABLED, "1");
     FEXCore::Config::Set(FEXCore::Config::ConfigOption::CONFIG_MEMCPYSETTSOENABLED, "1");
@@ -582,50 +506,50 @@ int main(int argc, char** argv, char** const envp) {
   // Always enable ARMv8.1 LSE atomics.
   HostFeatureControl |= static_cast<uint64_t>(FEXCore::Config::HostFeatures::ENABLEATOMICS);
 
-  if (TestHeaderData->DisabledHostFeatures & FEATURE_SVE128) {
+  if (Tests.Header->DisabledHostFeatures & FEATURE_SVE128) {
     HostFeatureControl |= static_cast<uint64_t>(FEXCore::Config::HostFeatures::DISABLESVE);
   }
-  if (TestHeaderData->DisabledHostFeatures & FEATURE_CLZERO) {
+  if (Tests.Header->DisabledHostFeatures & FEATURE_CLZERO) {
     HostFeatureControl |= static_cast<uint64_t>(FEXCore::Config::HostFeatures::DISABLECLZERO);
   }
-  if (TestHeaderData->DisabledHostFeatures & FEATURE_RNG) {
+  if (Tests.Header->DisabledHostFeatures & FEATURE_RNG) {
     HostFeatureControl |= static_cast<uint64_t>(FEXCore::Config::HostFeatures::DISABLERNG);
   }
-  if (TestHeaderData->DisabledHostFeatures & FEATURE_FCMA) {
+  if (Tests.Header->DisabledHostFeatures & FEATURE_FCMA) {
     HostFeatureControl |= static_cast<uint64_t>(FEXCore::Config::HostFeatures::DISABLEFCMA);
   }
-  if (TestHeaderData->DisabledHostFeatures & FEATURE_CSSC) {
+  if (Tests.Header->DisabledHostFeatures & FEATURE_CSSC) {
     HostFeatureControl |= static_cast<uint64_t>(FEXCore::Config::HostFeatures::DISABLECSSC);
   }
-  if (TestHeaderData->DisabledHostFeatures & FEATURE_AFP) {
+  if (Tests.Header->DisabledHostFeatures & FEATURE_AFP) {
     HostFeatureControl |= static_cast<uint64_t>(FEXCore::Config::HostFeatures::DISABLEAFP);
   }
-  if (TestHeaderData->DisabledHostFeatures & FEATURE_RPRES) {
+  if (Tests.Header->DisabledHostFeatures & FEATURE_RPRES) {
     HostFeatureControl |= static_cast<uint64_t>(FEXCore::Config::HostFeatures::DISABLERPRES);
   }
-  if (TestHeaderData->DisabledHostFeatures & FEATURE_FLAGM) {
+  if (Tests.Header->DisabledHostFeatures & FEATURE_FLAGM) {
     HostFeatureControl |= static_cast<uint64_t>(FEXCore::Config::HostFeatures::DISABLEFLAGM);
   }
-  if (TestHeaderData->DisabledHostFeatures & FEATURE_FLAGM2) {
+  if (Tests.Header->DisabledHostFeatures & FEATURE_FLAGM2) {
     HostFeatureControl |= static_cast<uint64_t>(FEXCore::Config::HostFeatures::DISABLEFLAGM2);
   }
-  if (TestHeaderData->DisabledHostFeatures & FEATURE_CRYPTO) {
+  if (Tests.Header->DisabledHostFeatures & FEATURE_CRYPTO) {
     HostFeatureControl |= static_cast<uint64_t>(FEXCore::Config::HostFeatures::DISABLECRYPTO);
   }
-  if (TestHeaderData->DisabledHostFeatures & FEATURE_SVEBITPERM) {
+  if (Tests.Header->DisabledHostFeatures & FEATURE_SVEBITPERM) {
     HostFeatureControl |= static_cast<uint64_t>(FEXCore::Config::HostFeatures::DISABLESVEBITPERM);
   }
-  if (TestHeaderData->DisabledHostFeatures & FEATURE_LRCPC) {
+  if (Tests.Header->DisabledHostFeatures & FEATURE_LRCPC) {
     HostFeatureControl |= static_cast<uint64_t>(FEXCore::Config::HostFeatures::DISABLELRCPC);
   }
-  if (TestHeaderData->DisabledHostFeatures & FEATURE_LRCPC2) {
+  if (Tests.Header->DisabledHostFeatures & FEATURE_LRCPC2) {
     HostFeatureControl |= static_cast<uint64_t>(FEXCore::Config::HostFeatures::DISABLELRCPC2);
   }
-  if (TestHeaderData->DisabledHostFeatures & FEATURE_FRINTTS) {
+  if (Tests.Header->DisabledHostFeatures & FEATURE_FRINTTS) {
     HostFeatureControl |= static_cast<uint64_t>(FEXCore::Config::HostFeatures::DISABLEFRINTTS);
   }
 
-  if (TestHeaderData->DisabledHostFeatures & FEATURE_TSO) {
+  if (Tests.Header->DisabledHostFeatures & FEATURE_TSO) {
     FEXCore::Config::Set(FEXCore::Config::ConfigOption::CONFIG_TSOENABLED, "0");
     FEXCore::Config::Set(FEXCore::Config::ConfigOption::CONFIG_VECTORTSOENABLED, "0");
     FEXCore::Config::Set(FEXCore::Config::ConfigOption::CONFIG_MEMCPYSETTSOENABLED, "0");
@@ -658,29 +582,7 @@ int main(int argc, char** argv, char** const envp) {
   // GDT data
   FEXCore::Core::CPUState::gdt_segment gdt[32] {};
 
-  {
-    auto Frame = ParentThread->CurrentFrame;
-    // GDT and LDT are tracked per thread.
-    Frame->State.segment_arrays[FEXCore::Core::CPUState::SEGMENT_ARRAY_INDEX_GDT] = &gdt[0];
-    // TODO: LDTs are currently unsupported, mirror them to GDT.
-    Frame->State.segment_arrays[FEXCore::Core::CPUState::SEGMENT_ARRAY_INDEX_LDT] = &gdt[0];
-
-    // Default code segment indexes match the numbers that the Linux kernel uses.
-    Frame->State.cs_idx = FEXCore::Core::CPUState::DEFAULT_USER_CS << 3;
-    auto GDT = FEXCore::Core::CPUState::GetSegmentFromIndex(Frame->State, Frame->State.cs_idx);
-    FEXCore::Core::CPUState::SetGDTBase(GDT, 0);
-    FEXCore::Core::CPUState::SetGDTLimit(GDT, 0xF'FFFFU);
-    Frame->State.cs_cached =
-      FEXCore::Core::CPUState::CalculateGDTBase(*FEXCore::Core::CPUState::GetSegmentFromIndex(Frame->State, Frame->State.cs_idx));
-
-    if (TestHeaderData->Bitness == 64) {
-      GDT->L = 1; // L = Long Mode = 64-bit
-      GDT->D = 0; // D = Default Operand SIze = Reserved
-    } else {
-      GDT->L = 0; // L = Long Mode = 32-bit
-      GDT->D = 1; // D = Default Operand Size = 32-bit
-    }
-  }
+  FEX::InstCountCI::SetupCodeSegment(ParentThread->CurrentFrame, &gdt[0], Tests.Header->Bitness == 64);
 
   // Calculate the base stats for instruction testing.
   CodeSize::Validation->CalculateBaseStats(CTX.get(), ParentThread);
@@ -689,6 +591,6 @@ int main(int argc, char** argv, char** const envp) {
   auto Result = TestInstructions(CTX.get(), ParentThread, argc >= 2 ? argv[2] : nullptr) ? 0 : 1;
   CTX->DestroyThread(ParentThread);
 
-  FEXCore::Allocator::VirtualFree(TestData, TestDataSize);
+  FEX::InstCountCI::UnloadTests(Tests);
   return Result;
 }
@@ -0,0 +1,152 @@
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#include <FEXCore/Core/CoreState.h>
+#include <FEXCore/Utils/Allocator.h>
+
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+#include <fcntl.h>
+#include <optional>
+#include <string_view>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Shared pieces of the tools that consume the test binaries written by InstructionCountParser.py.
+namespace FEX::InstCountCI {
+struct TestInfo {
+  char TestInst[128];
+  int64_t ExpectedInstructionCount;
+  uint64_t CodeSize;
+  uint64_t x86InstCount;
+  uint32_t Cookie;
+  uint8_t Code[];
+
+  const TestInfo* Next() const {
+    return reinterpret_cast<const TestInfo*>(&Code[CodeSize]);
+  }
+};
+
+struct TestHeader {
+  uint64_t Bitness;
+  uint64_t NumTests {};
+  uint64_t EnabledHostFeatures;
+  uint64_t DisabledHostFeatures;
+  uint64_t EnvironmentVariableCount;
+  uint8_t Data[];
+};
+
+// Matches the host feature bits written by InstructionCountParser.py.
+enum HostFeatures {
+  FEATURE_SVE128 = (1U << 0),
+  FEATURE_SVE256 = (1U << 1),
+  FEATURE_CLZERO = (1U << 2),
+  FEATURE_RNG = (1U << 3),
+  FEATURE_FCMA = (1U << 4),
+  FEATURE_CSSC = (1U << 5),
+  FEATURE_AFP = (1U << 6),
+  FEATURE_RPRES = (1U << 7),
+  FEATURE_FLAGM = (1U << 8),
+  FEATURE_FLAGM2 = (1U << 9),
+  FEATURE_CRYPTO = (1U << 10),
+  FEATURE_AES256 = (1U << 11),
+  FEATURE_SVEBITPERM = (1U << 12),
+  FEATURE_TSO = (1U << 13),
+  FEATURE_LRCPC = (1U << 14),
+  FEATURE_LRCPC2 = (1U << 15),
+  FEATURE_FRINTTS = (1U << 16),
+};
+
+struct TestFile {
+  void* Data {};
+  size_t DataSize {};
+  const TestHeader* Header {};
+  const TestInfo* TestsStart {};
+};
+
+inline bool LoadTests(const char* Path, TestFile& File) {
+  int FD = open(Path, O_RDONLY | O_CLOEXEC);
+  if (FD == -1) {
+    return false;
+  }
+
+  struct stat buf;
+  if (fstat(FD, &buf) == -1) {
+    close(FD);
+    return false;
+  }
+
+  File.DataSize = buf.st_size;
+  File.Data = FEXCore::Allocator::mmap(nullptr, File.DataSize, PROT_READ, MAP_PRIVATE, FD, 0);
+  close(FD);
+  if (reinterpret_cast<uint64_t>(File.Data) == ~0ULL) {
+    return false;
+  }
+
+  File.Header = reinterpret_cast<const TestHeader*>(File.Data);
+
+  // Need to walk past the environment variables to get to the actual tests.
+  const uint8_t* Data = File.Header->Data;
+  for (size_t i = 0; i < File.Header->EnvironmentVariableCount; ++i) {
+    // Environment variables are a pair of null terminated strings.
+    Data += strlen(reinterpret_cast<const char*>(Data)) + 1;
+    Data += strlen(reinterpret_cast<const char*>(Data)) + 1;
+  }
+  File.TestsStart = reinterpret_cast<const TestInfo*>(Data);
+  return true;
+}
+
+inline void UnloadTests(TestFile& File) {
+  FEXCore::Allocator::VirtualFree(File.Data, File.DataSize);
+  File = {};
+}
+
+// Block statistics the JIT prints through the info log when Disassemble::STATS is enabled.
+constexpr std::string_view RIPMessage = "RIP: 0x";
+constexpr std::string_view GuestCodeMessage = "Guest Code instructions: ";
+constexpr std::string_view HostCodeMessage = "Host Code instructions: ";
+constexpr std::string_view BlowUpMessage = "Blow-up Amt: ";
+
+inline bool IsStatsMessage(std::string_view Message) {
+  return Message.starts_with(RIPMessage) || Message.starts_with(GuestCodeMessage) || Message.starts_with(HostCodeMessage) ||
+         Message.starts_with(BlowUpMessage);
+}
+
+// Returns the number following Prefix if Message is that statistic.
+inline std::optional<uint64_t> ParseStatsMessage(std::string_view Message, std::string_view Prefix, int Base = 10) {
+  if (!Message.starts_with(Prefix)) {
+    return std::nullopt;
+  }
+
+  Message.remove_prefix(Prefix.size());
+  uint64_t Value {};
+  std::from_chars(Message.data(), Message.data() + Message.size(), Value, Base);
+  return Value;
+}
+
+// Sets up a flat code segment like the Linux kernel's default user code segment, the GDT needs to outlive the thread.
+inline void SetupCodeSegment(FEXCore::Core::CpuStateFrame* Frame, FEXCore::Core::CPUState::gdt_segment* GDTArray, bool Is64Bit) {
+  // GDT and LDT are tracked per thread.
+  Frame->State.segment_arrays[FEXCore::Core::CPUState::SEGMENT_ARRAY_INDEX_GDT] = GDTArray;
+  // TODO: LDTs are currently unsupported, mirror them to GDT.
+  Frame->State.segment_arrays[FEXCore::Core::CPUState::SEGMENT_ARRAY_INDEX_LDT] = GDTArray;
+
+  // Default code segment indexes match the numbers that the Linux kernel uses.
+  Frame->State.cs_idx = FEXCore::Core::CPUState::DEFAULT_USER_CS << 3;
+  auto GDT = FEXCore::Core::CPUState::GetSegmentFromIndex(Frame->State, Frame->State.cs_idx);
+  FEXCore::Core::CPUState::SetGDTBase(GDT, 0);
+  FEXCore::Core::CPUState::SetGDTLimit(GDT, 0xF'FFFFU);
+  Frame->State.cs_cached =
+    FEXCore::Core::CPUState::CalculateGDTBase(*FEXCore::Core::CPUState::GetSegmentFromIndex(Frame->State, Frame->State.cs_idx));
+
+  if (Is64Bit) {
+    GDT->L = 1; // L = Long Mode = 64-bit
+    GDT->D = 0; // D = Default Operand SIze = Reserved
+  } else {
+    GDT->L = 0; // L = Long Mode = 32-bit
+    GDT->D = 1; // D = Default Operand Size = 32-bit
+  }
+}
+} // namespace FEX::InstCountCI
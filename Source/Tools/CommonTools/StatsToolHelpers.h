@@ -0,0 +1,74 @@
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#include "OptionParser.h"
+
+#include <FEXCore/Utils/SHMStats.h>
+
+#include <charconv>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <fcntl.h>
+#include <fmt/format.h>
+#include <optional>
+#include <string>
+#include <sys/mman.h>
+#include <thread>
+
+// Shared pieces of the tools that attach to the shared memory stats of a running FEX process.
+namespace FEX::StatsTools {
+// Sets up the usage line for a tool that takes the pid of the FEX process as its only argument.
+inline void InitPIDOptionParser(optparse::OptionParser& Parser, const char* Description) {
+  Parser.usage("%prog [options] <pid>");
+  Parser.description(Description);
+}
+
+// Returns the pid argument once the options have been parsed, prints the usage if it is missing or malformed.
+inline std::optional<int32_t> GetPID(optparse::OptionParser& Parser) {
+  const auto& Args = Parser.args();
+  if (Args.size() != 1) {
+    Parser.print_usage(stderr);
+    return std::nullopt;
+  }
+
+  int32_t PID {};
+  const auto& Arg = Args[0];
+  const auto Result = std::from_chars(Arg.data(), Arg.data() + Arg.size(), PID);
+  if (Result.ec != std::errc {} || Result.ptr != Arg.data() + Arg.size() || PID <= 0) {
+    fmt::print(stderr, "Invalid pid '{}'\n", Arg);
+    return std::nullopt;
+  }
+
+  return PID;
+}
+
+// Opens the fex-{pid}-{Suffix} region read only, returns -1 after printing why it isn't available.
+inline int OpenStatsRegion(int32_t PID, const char* Suffix, std::string& Name) {
+  Name = fmt::format("fex-{}-{}", PID, Suffix);
+  const int FD = shm_open(Name.c_str(), O_RDONLY, 0);
+  if (FD == -1) {
+    fmt::print(stderr, "Couldn't open {}. Is the process running under FEX with ProfileStats enabled?\n", Name);
+  }
+  return FD;
+}
+
+// Returns the frequency the emulator published, or calibrates the cycle counter against the steady clock when it
+// couldn't, which is the case for the x86 TSC.
+inline uint64_t GetCycleCounterFrequency(uint64_t PublishedFrequency = 0) {
+  if (PublishedFrequency) {
+    return PublishedFrequency;
+  }
+
+  if (auto Frequency = FEXCore::SHMStats::GetCycleCounterFrequency()) {
+    return Frequency;
+  }
+
+  const auto BeginTime = std::chrono::steady_clock::now();
+  const auto BeginCycles = FEXCore::SHMStats::GetCycleCounter();
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  const auto EndCycles = FEXCore::SHMStats::GetCycleCounter();
+  const auto Elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - BeginTime);
+  return (EndCycles - BeginCycles) * 1'000'000'000ULL / Elapsed.count();
+}
+} // namespace FEX::StatsTools
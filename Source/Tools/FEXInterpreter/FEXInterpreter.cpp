@@ -611,6 +611,9 @@ int main(int argc, char** argv, char** const envp) {
 
   CTX->ExecuteThread(ParentThread->Thread);
 
+  SignalDelegation->SaveGuestProfile(ParentThread->Thread);
+  CTX->WriteBlockExecutionCounts(ParentThread->Thread);
+
   DebugServer.reset();
   SyscallHandler->TM.Stop();
 
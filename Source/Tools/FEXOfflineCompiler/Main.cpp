@@ -17,8 +17,12 @@
 
 #include <fmt/printf.h>
 
+#include <algorithm>
+#include <cinttypes>
 #include <fstream>
+#include <functional>
 #include <optional>
+#include <span>
 
 class AOTSyscallHandler : public FEXCore::HLE::SyscallHandler, public FEX::HLE::SyscallMmapInterface {
 public:
@@ -114,7 +118,7 @@ static FEXCore::Core::InternalThreadState* SetupCompileThread(FEXCore::Context::
 
 // Returns filename of generated cache on success
 static std::optional<std::string>
-GenerateSingleCache(const FEXCore::ExecutableFileInfo& Binary, fextl::set<uintptr_t> BlockList, std::string_view OutDir) {
+GenerateSingleCache(const FEXCore::ExecutableFileInfo& Binary, std::span<const uintptr_t> BlockList, std::string_view OutDir) {
   uint64_t CodeCacheConfigId = 0; // TODO: Make unique to active configuration
 
   ELFCodeLoader Loader(Binary.Filename.c_str(), -1, "", fextl::vector<fextl::string> {Binary.Filename.c_str()},
@@ -173,6 +177,7 @@ GenerateSingleCache(const FEXCore::ExecutableFileInfo& Binary, fextl::set<uintpt
   {
     std::vector<std::unique_ptr<ELFCodeLoader>> LoaderMem;
 
+    // Blocks are emitted back to back into the code buffer, so compile order determines the layout of the cache.
     fmt::print(stderr, "Compiling code...\n");
     for (auto Addr : BlockList) {
       CTX->CompileRIP(Thread, Addr + SyscallHandler->VAFileStart);
@@ -191,12 +196,35 @@ GenerateSingleCache(const FEXCore::ExecutableFileInfo& Binary, fextl::set<uintpt
   }
 }
 
+// Parses a block execution counts file as written by the BlockExecutionCounts option.
+// Returns the execution count of each block keyed by file id and block offset.
+static std::optional<std::map<std::pair<FEXCore::CodeMapFileId, uint64_t>, uint64_t>> ParseBlockCounts(const fextl::string& Path) {
+  std::ifstream File(Path.c_str());
+  if (!File) {
+    return std::nullopt;
+  }
+
+  std::map<std::pair<FEXCore::CodeMapFileId, uint64_t>, uint64_t> Counts;
+  std::string Line;
+  while (std::getline(File, Line)) {
+    FEXCore::CodeMapFileId FileId;
+    uint64_t Offset, Count;
+    if (sscanf(Line.c_str(), "%" SCNx64 " %" SCNx64 " %" SCNu64, &FileId, &Offset, &Count) != 3) {
+      continue;
+    }
+    Counts[{FileId, Offset}] += Count;
+  }
+  return Counts;
+}
+
 // Command handler that parses the given code map and generates a code cache for the selected x86 binary.
 // If no binary is selected explicitly, it is inferred from the code map ExecutableFileId block.
 static int GenerateCache(int argc, const char** argv) {
   optparse::OptionParser Parser {};
   Parser.add_option("--outdir").set_default(FEX::Config::GetCacheDirectory() + "cache").help("Output directory for generated cache files");
   Parser.add_option("--fileid").help("Select binary to generate cache for");
+  Parser.add_option("--block-counts").help("Only compile blocks listed in this block execution counts file, hottest first");
+  Parser.add_option("--min-count").set_default("1").help("Minimum execution count for a block to be selected with --block-counts");
 
   optparse::Values Options = Parser.parse_args(argc, argv);
   if (Parser.args().size() != 1) {
@@ -212,7 +240,7 @@ static int GenerateCache(int argc, const char** argv) {
   }
 
   FEXCore::ExecutableFileInfo ProgramName;
-  std::map<FEXCore::ExecutableFileInfo, fextl::set<uintptr_t>> Data;
+  std::map<FEXCore::ExecutableFileInfo, fextl::vector<uintptr_t>> Data;
   {
     auto Parsed = FEXCore::CodeMap::ParseCodeMap(Codemap);
 
@@ -230,7 +258,7 @@ static int GenerateCache(int argc, const char** argv) {
         ProgramName.Filename = Contents.Filename;
       }
       Data.emplace(std::piecewise_construct, std::forward_as_tuple(nullptr, FileId, std::move(Contents.Filename)),
-                   std::forward_as_tuple(std::move(Contents.Blocks)));
+                   std::forward_as_tuple(std::move(Contents.BlockOrder)));
     }
   }
   if (!ProgramName.FileId) {
@@ -250,6 +278,31 @@ static int GenerateCache(int argc, const char** argv) {
     throw std::runtime_error(fmt::format("Input code map {} did not contain {} ({:016x})", CodeMapPath, ProgramName.Filename, ProgramName.FileId));
   }
 
+  if (Options.is_set_by_user("block-counts")) {
+    const fextl::string CountsPath(Options.get("block-counts"));
+    auto Counts = ParseBlockCounts(CountsPath);
+    if (!Counts) {
+      fmt::print("Could not open {}\n", CountsPath);
+      return 1;
+    }
+
+    const auto GetCount = [&](uintptr_t Offset) -> uint64_t {
+      auto It = Counts->find({ProgramName.FileId, Offset});
+      return It != Counts->end() ? It->second : 0;
+    };
+
+    // Drop blocks that were rarely or never executed, they would only bloat the cache.
+    const uint64_t MinCount = strtoull(((fextl::string)Options.get("min-count")).c_str(), nullptr, 10);
+    auto& Blocks = Data.at(ProgramName);
+    const auto NumParsed = Blocks.size();
+    std::erase_if(Blocks, [&](uintptr_t Offset) { return GetCount(Offset) < MinCount; });
+    fmt::print("Selected {} of {} blocks executed at least {} times\n", Blocks.size(), NumParsed, MinCount);
+
+    // Hottest blocks first so they share as few pages as possible.
+    // Equally hot blocks keep their first-execution order, which tends to keep successors next to each other.
+    std::ranges::stable_sort(Blocks, std::greater {}, GetCount);
+  }
+
   fextl::string OutDir(Options.get("outdir"));
   if (!OutDir.ends_with('/')) {
     OutDir.push_back('/');
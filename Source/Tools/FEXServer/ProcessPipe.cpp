@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: MIT
 #include "FEXHeaderUtils/Syscalls.h"
 #include "Logger.h"
+#include "RootFSIndex.h"
 #include "SquashFS.h"
 
 #include <Common/AsyncNet.h>
@@ -19,6 +20,7 @@
 #include <filesystem>
 #include <fstream>
 #include <poll.h>
+#include <span>
 #include <string>
 #include <sys/file.h>
 #include <sys/resource.h>
@@ -295,8 +297,28 @@ void SendFDSuccessPacket(fasio::tcp_socket& Socket, int FD) {
   write(Socket, Data, ec);
 }
 
+// Unique code map blocks in first-execution order.
+// The order is carried through to the aggregated code map so that the offline compiler lays out code in execution order.
+struct OrderedBlocks {
+  fextl::set<uintptr_t> Known;
+  fextl::vector<uintptr_t> Order;
+
+  // Appends blocks that weren't seen before, keeping their relative order.
+  void Append(std::span<const uint64_t> Blocks) {
+    for (auto Block : Blocks) {
+      if (Known.insert(Block).second) {
+        Order.push_back(Block);
+      }
+    }
+  }
+
+  size_t size() const {
+    return Order.size();
+  }
+};
+
 // Discovers any pending code maps, parses their contents into a runtime data structure, and deletes them
-static std::map<FEXCore::ExecutableFileInfo, fextl::set<uintptr_t>>
+static std::map<FEXCore::ExecutableFileInfo, OrderedBlocks>
 ImportPendingCodeMaps(const FEXCore::ExecutableFileInfo& MainFileId, bool HasMultiblock) {
   // Detect code maps by checking file name suffixes by counting up an index.
   // Code maps that are ready for reading must be non-empty and flock(FLOCK_EX) must succeed:
@@ -328,7 +350,7 @@ ImportPendingCodeMaps(const FEXCore::ExecutableFileInfo& MainFileId, bool HasMul
   }
 
   // Update merged code map
-  std::map<FEXCore::ExecutableFileInfo, fextl::set<uintptr_t>> ImportedCodeMaps;
+  std::map<FEXCore::ExecutableFileInfo, OrderedBlocks> ImportedCodeMaps;
   if (!CodeMaps.empty()) {
     fmt::print("Found {} new code maps, updating reference code map\n", CodeMaps.size());
 
@@ -336,8 +358,11 @@ ImportPendingCodeMaps(const FEXCore::ExecutableFileInfo& MainFileId, bool HasMul
       std::ifstream Incoming(CodeMap, std::ios_base::binary);
       auto NewBlocks = FEXCore::CodeMap::ParseCodeMap(Incoming);
       for (auto& [FileId, Contents] : NewBlocks) {
-        ImportedCodeMaps.emplace(std::piecewise_construct, std::forward_as_tuple(nullptr, FileId, std::move(Contents.Filename)),
-                                 std::forward_as_tuple(std::move(Contents.Blocks)));
+        // Multiple processes may have recorded the same file, merge them in the order the code maps were written.
+        auto It = ImportedCodeMaps
+                    .emplace(std::piecewise_construct, std::forward_as_tuple(nullptr, FileId, std::move(Contents.Filename)), std::forward_as_tuple())
+                    .first;
+        It->second.Append(Contents.BlockOrder);
       }
     }
   }
@@ -354,7 +379,7 @@ ImportPendingCodeMaps(const FEXCore::ExecutableFileInfo& MainFileId, bool HasMul
 /**
  * Writes aggregated code map data into a single code map file that is ready to be used for cache generation
  */
-static void WriteNewCodeMap(const FEXCore::ExecutableFileInfo& File, const std::string& OutputName, const fextl::set<uintptr_t>& Blocks,
+static void WriteNewCodeMap(const FEXCore::ExecutableFileInfo& File, const std::string& OutputName, std::span<const uintptr_t> Blocks,
                             bool IsMainFile, const auto& Dependencies) {
   fmt::print("Writing {} blocks to {}\n", Blocks.size(), OutputName);
 
@@ -429,9 +454,12 @@ static std::map<FEXCore::ExecutableFileInfo, NeedsCacheRefresh> AggregateCodeMap
 
     // Check if the new code maps add any new information to the previous code map
     if (auto ReferenceCodeMap = std::ifstream(OutputName, std::ios_base::binary)) {
-      auto PreviousBlocks = FEXCore::CodeMap::ParseCodeMap(ReferenceCodeMap).at(File.FileId).Blocks;
-      auto NumPreviousBlocks = PreviousBlocks.size();
-      Blocks.merge(std::move(PreviousBlocks));
+      // Blocks from previous runs keep their position, new blocks are appended in their first-execution order.
+      OrderedBlocks Merged;
+      Merged.Append(FEXCore::CodeMap::ParseCodeMap(ReferenceCodeMap).at(File.FileId).BlockOrder);
+      auto NumPreviousBlocks = Merged.size();
+      Merged.Append(Blocks.Order);
+      Blocks = std::move(Merged);
       if (Blocks.size() == NumPreviousBlocks) {
         // No new blocks => no need to regenerate the corresponding cache
         continue;
@@ -442,7 +470,7 @@ static std::map<FEXCore::ExecutableFileInfo, NeedsCacheRefresh> AggregateCodeMap
 
     // Update code map and queue for cache generation
     std::map<FEXCore::ExecutableFileInfo, NeedsCacheRefresh> Empty;
-    WriteNewCodeMap(File, OutputName, Blocks, true, File.FileId == MainFileId.FileId ? Result : Empty);
+    WriteNewCodeMap(File, OutputName, Blocks.Order, true, File.FileId == MainFileId.FileId ? Result : Empty);
     Result.at(File) = NeedsCacheRefresh::Yes;
   }
 
@@ -583,6 +611,19 @@ void HandleSocketData(fasio::tcp_socket& Socket) {
       buffer += sizeof(FEXServerClient::FEXServerRequestPacket::Header);
       break;
     }
+    case FEXServerClient::PacketType::TYPE_GET_ROOTFS_INDEX_FD: {
+      // The index is generated in the background, clients that connect before it is ready go through the mount.
+      int FD = RootFSIndex::DupFD();
+      if (FD != -1) {
+        SendFDSuccessPacket(Socket, FD);
+        close(FD);
+      } else {
+        SendEmptyErrorPacket(Socket);
+      }
+
+      buffer += sizeof(FEXServerClient::FEXServerRequestPacket::Header);
+      break;
+    }
 
     case FEXServerClient::PacketType::TYPE_POPULATE_CODE_CACHE:
     case FEXServerClient::PacketType::TYPE_POPULATE_CODE_CACHE_NO_MULTIBLOCK: {
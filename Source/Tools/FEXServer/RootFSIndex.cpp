@@ -0,0 +1,287 @@
+// SPDX-License-Identifier: MIT
+#include "RootFSIndex.h"
+
+#include <Common/Config.h>
+#include <Common/RootFSIndex.h>
+
+#include <FEXCore/Utils/FileLoading.h>
+#include <FEXCore/Utils/LogManager.h>
+#include <FEXCore/fextl/fmt.h>
+#include <FEXCore/fextl/vector.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <dirent.h>
+#include <fcntl.h>
+#include <filesystem>
+#include <linux/limits.h>
+#include <mutex>
+#include <span>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <thread>
+#include <unistd.h>
+
+#include <xxhash.h>
+
+namespace RootFSIndex {
+std::thread IndexThread;
+std::atomic<bool> ShouldStop {};
+// Protects IndexFD, so that Shutdown can't close it while a client request is duplicating it.
+std::mutex IndexFDMutex;
+int IndexFD {-1};
+
+struct PendingEntry {
+  fextl::string Path;
+  fextl::string Target;
+  uint32_t Mode;
+};
+
+// Hashing the full contents of a multi-gigabyte image would take longer than walking it.
+// The superblock changes with any rebuild of the image, combined with the file identity that is enough to key the cache.
+uint64_t HashImage(const fextl::string& ImagePath) {
+  int FD = open(ImagePath.c_str(), O_RDONLY | O_CLOEXEC);
+  if (FD == -1) {
+    return 0;
+  }
+
+  struct stat Buffer {};
+  if (fstat(FD, &Buffer) != 0) {
+    close(FD);
+    return 0;
+  }
+
+  const uint64_t Identity[] = {
+    static_cast<uint64_t>(Buffer.st_size),
+    static_cast<uint64_t>(Buffer.st_mtim.tv_sec),
+    static_cast<uint64_t>(Buffer.st_mtim.tv_nsec),
+    static_cast<uint64_t>(Buffer.st_ino),
+  };
+
+  char Superblock[4096];
+  const auto SuperblockSize = pread(FD, Superblock, sizeof(Superblock), 0);
+  close(FD);
+  if (SuperblockSize <= 0) {
+    return 0;
+  }
+
+  return XXH3_64bits_withSeed(Superblock, SuperblockSize, XXH3_64bits(Identity, sizeof(Identity)));
+}
+
+// Takes ownership of `DirFD`.
+void Walk(int DirFD, fextl::string& Path, fextl::vector<PendingEntry>& Entries) {
+  DIR* Dir = fdopendir(DirFD);
+  if (!Dir) {
+    close(DirFD);
+    return;
+  }
+
+  const size_t BaseLength = Path.size();
+  while (auto Ent = readdir(Dir)) {
+    if (ShouldStop.load(std::memory_order_relaxed)) {
+      break;
+    }
+
+    const std::string_view Name = Ent->d_name;
+    if (Name == "." || Name == "..") {
+      continue;
+    }
+
+    Path.resize(BaseLength);
+    if (!Path.empty()) {
+      Path += '/';
+    }
+    Path += Name;
+
+    struct stat Buffer {};
+    if (fstatat(dirfd(Dir), Ent->d_name, &Buffer, AT_SYMLINK_NOFOLLOW) != 0) {
+      continue;
+    }
+
+    PendingEntry New {
+      .Path = Path,
+      .Mode = Buffer.st_mode,
+    };
+
+    if (S_ISLNK(Buffer.st_mode)) {
+      char Target[PATH_MAX];
+      const auto TargetSize = readlinkat(dirfd(Dir), Ent->d_name, Target, sizeof(Target));
+      if (TargetSize > 0) {
+        New.Target.assign(Target, TargetSize);
+      }
+    }
+
+    Entries.emplace_back(std::move(New));
+
+    if (S_ISDIR(Buffer.st_mode)) {
+      int ChildFD = openat(dirfd(Dir), Ent->d_name, O_RDONLY | O_DIRECTORY | O_NOFOLLOW | O_CLOEXEC);
+      if (ChildFD != -1) {
+        Walk(ChildFD, Path, Entries);
+      }
+    }
+  }
+
+  Path.resize(BaseLength);
+  closedir(Dir);
+}
+
+fextl::vector<char> Serialize(fextl::vector<PendingEntry>& Entries, uint64_t ImageHash) {
+  std::ranges::sort(Entries, {}, [](const PendingEntry& Entry) { return std::string_view {Entry.Path}; });
+
+  fextl::vector<FEX::RootFSIndex::Entry> Out;
+  Out.reserve(Entries.size());
+  fextl::string Strings;
+  for (const auto& Entry : Entries) {
+    auto& New = Out.emplace_back(FEX::RootFSIndex::Entry {
+      .PathOffset = static_cast<uint32_t>(Strings.size()),
+      .PathLength = static_cast<uint32_t>(Entry.Path.size()),
+      .Mode = Entry.Mode,
+    });
+    Strings += Entry.Path;
+
+    if (!Entry.Target.empty()) {
+      New.TargetOffset = Strings.size();
+      New.TargetLength = Entry.Target.size();
+      Strings += Entry.Target;
+    }
+  }
+
+  if (Strings.size() > UINT32_MAX) {
+    return {};
+  }
+
+  const FEX::RootFSIndex::Header Head {
+    .Magic = FEX::RootFSIndex::MAGIC,
+    .Version = FEX::RootFSIndex::VERSION,
+    .NumEntries = static_cast<uint32_t>(Out.size()),
+    .ImageHash = ImageHash,
+    .StringTableSize = Strings.size(),
+  };
+
+  fextl::vector<char> Data(sizeof(Head) + Out.size() * sizeof(FEX::RootFSIndex::Entry) + Strings.size());
+  auto Ptr = Data.data();
+  memcpy(Ptr, &Head, sizeof(Head));
+  Ptr += sizeof(Head);
+  memcpy(Ptr, Out.data(), Out.size() * sizeof(FEX::RootFSIndex::Entry));
+  Ptr += Out.size() * sizeof(FEX::RootFSIndex::Entry);
+  memcpy(Ptr, Strings.data(), Strings.size());
+  return Data;
+}
+
+bool IsValidIndex(const fextl::vector<char>& Data, uint64_t ImageHash) {
+  FEX::RootFSIndex::View View;
+  if (!View.Init(std::as_bytes(std::span {Data}))) {
+    return false;
+  }
+  return reinterpret_cast<const FEX::RootFSIndex::Header*>(Data.data())->ImageHash == ImageHash;
+}
+
+bool WriteAll(int FD, std::span<const char> Data) {
+  while (!Data.empty()) {
+    auto Result = write(FD, Data.data(), Data.size());
+    if (Result == -1) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return false;
+    }
+    Data = Data.subspan(Result);
+  }
+  return true;
+}
+
+void StoreCachedIndex(const fextl::string& CachePath, const fextl::vector<char>& Data) {
+  std::error_code ec;
+  std::filesystem::create_directories(std::filesystem::path(CachePath).parent_path(), ec);
+
+  // Write to a temporary and rename so that concurrent servers never see a partial index.
+  const auto TmpPath = fextl::fmt::format("{}.{}", CachePath, ::getpid());
+  int FD = open(TmpPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+  if (FD == -1) {
+    return;
+  }
+
+  const bool Written = WriteAll(FD, Data);
+  close(FD);
+  if (!Written || rename(TmpPath.c_str(), CachePath.c_str()) != 0) {
+    unlink(TmpPath.c_str());
+  }
+}
+
+int CreateSealedFD(const fextl::vector<char>& Data) {
+  int FD = memfd_create("FEXRootFSIndex", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+  if (FD == -1) {
+    return -1;
+  }
+
+  // Clients map this read-only, seal it so they can trust that it never changes underneath them.
+  if (!WriteAll(FD, Data) || fcntl(FD, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_WRITE | F_SEAL_SEAL) != 0) {
+    close(FD);
+    return -1;
+  }
+
+  return FD;
+}
+
+void GenerateIndex(fextl::string ImagePath, fextl::string MountFolder) {
+  const uint64_t ImageHash = HashImage(ImagePath);
+  if (ImageHash == 0) {
+    return;
+  }
+
+  const auto CachePath = fextl::fmt::format("{}rootfs/{:016x}.index", FEX::Config::GetCacheDirectory(), ImageHash);
+
+  fextl::vector<char> Data;
+  if (!FEXCore::FileLoading::LoadFile(Data, CachePath) || !IsValidIndex(Data, ImageHash)) {
+    int RootFD = open(MountFolder.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (RootFD == -1) {
+      return;
+    }
+
+    fextl::vector<PendingEntry> Entries;
+    fextl::string Path;
+    Walk(RootFD, Path, Entries);
+    if (ShouldStop.load(std::memory_order_relaxed)) {
+      return;
+    }
+
+    Data = Serialize(Entries, ImageHash);
+    if (Data.empty()) {
+      return;
+    }
+
+    StoreCachedIndex(CachePath, Data);
+    LogMan::Msg::DFmt("[FEXServer] Generated rootfs index with {} entries", Entries.size());
+  }
+
+  int FD = CreateSealedFD(Data);
+  std::scoped_lock lk(IndexFDMutex);
+  IndexFD = FD;
+}
+
+void Initialize(const fextl::string& ImagePath, const fextl::string& MountFolder) {
+  IndexThread = std::thread(GenerateIndex, ImagePath, MountFolder);
+}
+
+void Shutdown() {
+  ShouldStop.store(true, std::memory_order_relaxed);
+  if (IndexThread.joinable()) {
+    IndexThread.join();
+  }
+
+  std::scoped_lock lk(IndexFDMutex);
+  if (IndexFD != -1) {
+    close(IndexFD);
+    IndexFD = -1;
+  }
+}
+
+int DupFD() {
+  std::scoped_lock lk(IndexFDMutex);
+  if (IndexFD == -1) {
+    return -1;
+  }
+  return fcntl(IndexFD, F_DUPFD_CLOEXEC, 0);
+}
+} // namespace RootFSIndex
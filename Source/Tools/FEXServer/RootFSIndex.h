@@ -0,0 +1,23 @@
+// SPDX-License-Identifier: MIT
+#pragma once
+#include <FEXCore/fextl/string.h>
+
+namespace RootFSIndex {
+/**
+ * @brief Starts loading or generating the path index of a mounted rootfs image on a background thread
+ *
+ * @param ImagePath - Path to the squashfs or erofs image, used to key the on-disk cache
+ * @param MountFolder - Where the image is mounted
+ */
+void Initialize(const fextl::string& ImagePath, const fextl::string& MountFolder);
+
+/**
+ * @brief Stops index generation, must be called before the image is unmounted
+ */
+void Shutdown();
+
+/**
+ * @return New duplicate of the sealed memfd holding the index that the caller needs to close, or -1 if it isn't available
+ */
+int DupFD();
+} // namespace RootFSIndex
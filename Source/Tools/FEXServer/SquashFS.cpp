@@ -1,4 +1,6 @@
 // SPDX-License-Identifier: MIT
+#include "RootFSIndex.h"
+
 #include "Common/FEXServerClient.h"
 #include "Common/FileFormatCheck.h"
 
@@ -194,6 +196,9 @@ void UnmountRootFS() {
     return;
   }
 
+  // Stop walking the image before it goes away.
+  RootFSIndex::Shutdown();
+
   SquashFS::ShutdownImagePID();
 
   // Handle final mount removal
@@ -264,6 +269,8 @@ bool InitializeSquashFS() {
     return false;
   }
 
+  RootFSIndex::Initialize(LDPath(), MountFolder);
+
   return true;
 }
 
@@ -0,0 +1,336 @@
+// SPDX-License-Identifier: MIT
+#include "StatsToolHelpers.h"
+
+#include <FEXCore/Utils/SHMStats.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <fmt/format.h>
+#include <signal.h>
+#include <string>
+#include <string_view>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <thread>
+#include <unistd.h>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+namespace Config {
+  int32_t PID {};
+  uint32_t IntervalMS {1000};
+  uint32_t Samples {};
+  uint32_t MaxThreads {32};
+  bool Machine {};
+
+  bool LoadOptions(int argc, char** argv) {
+    optparse::OptionParser Parser {};
+    FEX::StatsTools::InitPIDOptionParser(Parser,
+                                         "Live view of the statistics published by a FEX process running with ProfileStats enabled");
+
+    Parser.add_option("-i", "--interval").dest("interval").help("Sampling interval in milliseconds").type("int").set_default(IntervalMS);
+    Parser.add_option("-c", "--count").dest("count").help("Number of samples to take, 0 runs until the process exits").type("int").set_default(Samples);
+    Parser.add_option("-n", "--threads").dest("threads").help("Maximum number of threads to display").type("int").set_default(MaxThreads);
+    Parser.add_option("-m", "--machine")
+      .dest("machine")
+      .help("Print one JSON object per sample instead of the interactive view")
+      .action("store_true")
+      .set_default(Machine);
+
+    optparse::Values Options = Parser.parse_args(argc, argv);
+    int Interval = Options.get("interval");
+    int Count = Options.get("count");
+    int Threads = Options.get("threads");
+    IntervalMS = std::max(Interval, 1);
+    Samples = std::max(Count, 0);
+    MaxThreads = std::max(Threads, 0);
+    Machine = Options.get("machine");
+
+    const auto ParsedPID = FEX::StatsTools::GetPID(Parser);
+    if (!ParsedPID) {
+      return false;
+    }
+
+    PID = *ParsedPID;
+    return true;
+  }
+} // namespace Config
+
+// Plain copy of the counters in a ThreadStats slot.
+struct ThreadSample {
+  uint64_t AccumulatedJITTime;
+  uint64_t AccumulatedSignalTime;
+  uint64_t AccumulatedSIGBUSCount;
+  uint64_t AccumulatedSMCCount;
+  uint64_t AccumulatedFloatFallbackCount;
+  uint64_t AccumulatedCacheMissCount;
+  uint64_t AccumulatedCacheReadLockTime;
+  uint64_t AccumulatedCacheWriteLockTime;
+  uint64_t AccumulatedJITCount;
+};
+
+class StatReader final {
+public:
+  ~StatReader() {
+    Unmap();
+    if (FD != -1) {
+      close(FD);
+    }
+  }
+
+  bool Open(int32_t PID) {
+    FD = FEX::StatsTools::OpenStatsRegion(PID, "stats", Name);
+    if (FD == -1) {
+      return false;
+    }
+
+    if (!Remap()) {
+      return false;
+    }
+
+    if (Header()->Version != FEXCore::SHMStats::STATS_VERSION) {
+      fmt::print(stderr, "Unsupported stats version {}, expected {}\n", Header()->Version, FEXCore::SHMStats::STATS_VERSION);
+      return false;
+    }
+
+    return true;
+  }
+
+  const FEXCore::SHMStats::ThreadStatsHeader* Header() const {
+    return reinterpret_cast<const FEXCore::SHMStats::ThreadStatsHeader*>(Base);
+  }
+
+  // Copies out every live thread slot, keyed by TID.
+  bool Snapshot(std::unordered_map<uint32_t, ThreadSample>& Out) {
+    Out.clear();
+
+    // The emulator grows the region as threads are created.
+    if (Header()->Size.load(std::memory_order_relaxed) != Size && !Remap()) {
+      return false;
+    }
+
+    uint32_t Offset = Header()->Head.load(std::memory_order_relaxed);
+
+    // Bounded walk, the list can be modified while it's being read.
+    for (size_t i = 0; Offset && i < Size / sizeof(FEXCore::SHMStats::ThreadStats); ++i) {
+      if (Offset + Header()->ThreadStatsSize > Size) {
+        break;
+      }
+
+      auto Slot = reinterpret_cast<const FEXCore::SHMStats::ThreadStats*>(Base + Offset);
+
+      // TID == 0 means the slot is being deallocated.
+      if (const auto TID = Slot->TID.load(std::memory_order_relaxed)) {
+        Out.insert_or_assign(TID, ThreadSample {
+                                    .AccumulatedJITTime = Slot->AccumulatedJITTime,
+                                    .AccumulatedSignalTime = Slot->AccumulatedSignalTime,
+                                    .AccumulatedSIGBUSCount = Slot->AccumulatedSIGBUSCount,
+                                    .AccumulatedSMCCount = Slot->AccumulatedSMCCount,
+                                    .AccumulatedFloatFallbackCount = Slot->AccumulatedFloatFallbackCount,
+                                    .AccumulatedCacheMissCount = Slot->AccumulatedCacheMissCount,
+                                    .AccumulatedCacheReadLockTime = Slot->AccumulatedCacheReadLockTime,
+                                    .AccumulatedCacheWriteLockTime = Slot->AccumulatedCacheWriteLockTime,
+                                    .AccumulatedJITCount = Slot->AccumulatedJITCount,
+                                  });
+      }
+
+      Offset = Slot->Next.load(std::memory_order_relaxed);
+    }
+
+    return true;
+  }
+
+private:
+  bool Remap() {
+    struct stat buf {};
+    if (fstat(FD, &buf) == -1 || static_cast<size_t>(buf.st_size) < sizeof(FEXCore::SHMStats::ThreadStatsHeader)) {
+      fmt::print(stderr, "{} is too small\n", Name);
+      return false;
+    }
+
+    Unmap();
+    auto Ptr = mmap(nullptr, buf.st_size, PROT_READ, MAP_SHARED, FD, 0);
+    if (Ptr == MAP_FAILED) {
+      fmt::print(stderr, "Couldn't map {}\n", Name);
+      return false;
+    }
+
+    Base = reinterpret_cast<const std::byte*>(Ptr);
+    Size = buf.st_size;
+    return true;
+  }
+
+  void Unmap() {
+    if (Base) {
+      munmap(const_cast<std::byte*>(Base), Size);
+      Base = nullptr;
+      Size = 0;
+    }
+  }
+
+  std::string Name;
+  int FD {-1};
+  const std::byte* Base {};
+  size_t Size {};
+};
+
+struct ThreadRates {
+  uint32_t TID;
+  // Percent of wall time.
+  double JIT;
+  double Signal;
+  double CacheReadLock;
+  double CacheWriteLock;
+  // Events per second.
+  double JITCount;
+  double SIGBUSCount;
+  double SMC;
+  double FloatFallback;
+  double CacheMiss;
+};
+
+ThreadRates CalculateRates(uint32_t TID, const ThreadSample& Current, const ThreadSample* Previous, double Seconds, uint64_t Frequency) {
+  // Threads created during the interval started out at zero.
+  const ThreadSample Zero {};
+  if (!Previous) {
+    Previous = &Zero;
+  }
+
+  const double Cycles = Seconds * Frequency;
+  const auto Percent = [&](uint64_t ThreadSample::*Member) {
+    return (Current.*Member - Previous->*Member) * 100.0 / Cycles;
+  };
+  const auto PerSecond = [&](uint64_t ThreadSample::*Member) {
+    return (Current.*Member - Previous->*Member) / Seconds;
+  };
+
+  return {
+    .TID = TID,
+    .JIT = Percent(&ThreadSample::AccumulatedJITTime),
+    .Signal = Percent(&ThreadSample::AccumulatedSignalTime),
+    .CacheReadLock = Percent(&ThreadSample::AccumulatedCacheReadLockTime),
+    .CacheWriteLock = Percent(&ThreadSample::AccumulatedCacheWriteLockTime),
+    .JITCount = PerSecond(&ThreadSample::AccumulatedJITCount),
+    .SIGBUSCount = PerSecond(&ThreadSample::AccumulatedSIGBUSCount),
+    .SMC = PerSecond(&ThreadSample::AccumulatedSMCCount),
+    .FloatFallback = PerSecond(&ThreadSample::AccumulatedFloatFallbackCount),
+    .CacheMiss = PerSecond(&ThreadSample::AccumulatedCacheMissCount),
+  };
+}
+
+ThreadRates Accumulate(const std::vector<ThreadRates>& Threads) {
+  ThreadRates Total {};
+  for (const auto& Thread : Threads) {
+    Total.JIT += Thread.JIT;
+    Total.Signal += Thread.Signal;
+    Total.CacheReadLock += Thread.CacheReadLock;
+    Total.CacheWriteLock += Thread.CacheWriteLock;
+    Total.JITCount += Thread.JITCount;
+    Total.SIGBUSCount += Thread.SIGBUSCount;
+    Total.SMC += Thread.SMC;
+    Total.FloatFallback += Thread.FloatFallback;
+    Total.CacheMiss += Thread.CacheMiss;
+  }
+  return Total;
+}
+
+std::string FormatJSON(const ThreadRates& Rates) {
+  return fmt::format(R"({{"tid":{},"jit_pct":{:.3f},"signal_pct":{:.3f},"cache_read_lock_pct":{:.3f},"cache_write_lock_pct":{:.3f},)"
+                     R"("jit_per_s":{:.1f},"sigbus_per_s":{:.1f},"smc_per_s":{:.1f},"float_fallback_per_s":{:.1f},"cache_miss_per_s":{:.1f}}})",
+                     Rates.TID, Rates.JIT, Rates.Signal, Rates.CacheReadLock, Rates.CacheWriteLock, Rates.JITCount, Rates.SIGBUSCount, Rates.SMC,
+                     Rates.FloatFallback, Rates.CacheMiss);
+}
+
+void PrintMachine(uint64_t Timestamp, double Seconds, const ThreadRates& Total, const std::vector<ThreadRates>& Threads) {
+  std::string ThreadList;
+  for (const auto& Thread : Threads) {
+    if (!ThreadList.empty()) {
+      ThreadList += ',';
+    }
+    ThreadList += FormatJSON(Thread);
+  }
+
+  fmt::print(R"({{"pid":{},"timestamp_ms":{},"interval_s":{:.3f},"threads":{},"total":{},"per_thread":[{}]}})"
+             "\n",
+             Config::PID, Timestamp, Seconds, Threads.size(), FormatJSON(Total), ThreadList);
+  fflush(stdout);
+}
+
+void PrintRow(std::string_view Name, const ThreadRates& Rates) {
+  fmt::print("{:>8} {:>7.2f} {:>7.2f} {:>9.1f} {:>9.1f} {:>9.1f} {:>9.1f} {:>10.1f} {:>7.2f} {:>7.2f}\n", Name, Rates.JIT, Rates.Signal,
+             Rates.JITCount, Rates.SMC, Rates.SIGBUSCount, Rates.FloatFallback, Rates.CacheMiss, Rates.CacheReadLock, Rates.CacheWriteLock);
+}
+
+void PrintInteractive(const FEXCore::SHMStats::ThreadStatsHeader* Header, const ThreadRates& Total, const std::vector<ThreadRates>& Threads) {
+  const std::string_view Version(Header->fex_version, strnlen(Header->fex_version, sizeof(Header->fex_version)));
+
+  fmt::print("\033[H\033[2J");
+  fmt::print("pid {} ({}), {} threads\n", Config::PID, Version, Threads.size());
+  fmt::print("Time columns are percent of wall time, event columns are per second\n\n");
+  fmt::print("{:>8} {:>7} {:>7} {:>9} {:>9} {:>9} {:>9} {:>10} {:>7} {:>7}\n", "TID", "JIT%", "Sig%", "JITs/s", "SMC/s", "SIGBUS/s",
+             "F80/s", "CMiss/s", "RLock%", "WLock%");
+  PrintRow("total", Total);
+
+  for (size_t i = 0; i < std::min<size_t>(Threads.size(), Config::MaxThreads); ++i) {
+    PrintRow(fmt::format("{}", Threads[i].TID), Threads[i]);
+  }
+  fflush(stdout);
+}
+} // namespace
+
+int main(int argc, char** argv) {
+  if (!Config::LoadOptions(argc, argv)) {
+    return 1;
+  }
+
+  StatReader Reader;
+  if (!Reader.Open(Config::PID)) {
+    return 1;
+  }
+
+  const uint64_t Frequency = FEX::StatsTools::GetCycleCounterFrequency();
+
+  std::unordered_map<uint32_t, ThreadSample> Previous, Current;
+  if (!Reader.Snapshot(Previous)) {
+    return 1;
+  }
+  auto PreviousTime = std::chrono::steady_clock::now();
+
+  for (uint32_t Sample = 0; (Config::Samples == 0 || Sample < Config::Samples) && kill(Config::PID, 0) == 0; ++Sample) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(Config::IntervalMS));
+
+    if (!Reader.Snapshot(Current)) {
+      return 1;
+    }
+    const auto Now = std::chrono::steady_clock::now();
+    const double Seconds = std::chrono::duration<double>(Now - PreviousTime).count();
+
+    std::vector<ThreadRates> Threads;
+    for (const auto& [TID, Stats] : Current) {
+      auto It = Previous.find(TID);
+      Threads.emplace_back(CalculateRates(TID, Stats, It != Previous.end() ? &It->second : nullptr, Seconds, Frequency));
+    }
+
+    // Busiest threads first.
+    std::sort(Threads.begin(), Threads.end(), [](const ThreadRates& a, const ThreadRates& b) { return a.JIT > b.JIT; });
+    const auto Total = Accumulate(Threads);
+
+    if (Config::Machine) {
+      const auto Timestamp =
+        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+      PrintMachine(Timestamp, Seconds, Total, Threads);
+    } else {
+      PrintInteractive(Reader.Header(), Total, Threads);
+    }
+
+    std::swap(Previous, Current);
+    PreviousTime = Now;
+  }
+
+  return 0;
+}
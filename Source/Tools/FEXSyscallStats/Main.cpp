@@ -0,0 +1,228 @@
+// SPDX-License-Identifier: MIT
+#include "StatsToolHelpers.h"
+
+#include <FEXCore/Utils/SHMStats.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <fmt/format.h>
+#include <map>
+#include <signal.h>
+#include <string>
+#include <string_view>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+namespace {
+const std::map<uint32_t, std::string_view> x64SyscallNames = {
+#include "LinuxSyscalls/x64/SyscallsNames.inl"
+};
+
+const std::map<uint32_t, std::string_view> x32SyscallNames = {
+#include "LinuxSyscalls/x32/SyscallsNames.inl"
+};
+
+namespace Config {
+  int32_t PID {};
+  uint32_t TopCount {20};
+  uint32_t IntervalMS {1000};
+  bool SingleShot {};
+
+  bool LoadOptions(int argc, char** argv) {
+    optparse::OptionParser Parser {};
+    FEX::StatsTools::InitPIDOptionParser(Parser,
+                                         "Displays per-syscall frequency and latency of a FEX process running with ProfileStats enabled");
+
+    Parser.add_option("-n").help("Number of syscalls to display").type("int").set_default(TopCount);
+    Parser.add_option("-i").help("Sampling interval in milliseconds").type("int").set_default(IntervalMS);
+    Parser.add_option("-1").dest("single").help("Print totals since process start once and exit").action("store_true").set_default(SingleShot);
+
+    optparse::Values Options = Parser.parse_args(argc, argv);
+    int Top = Options.get("n");
+    int Interval = Options.get("i");
+    TopCount = std::max(Top, 0);
+    IntervalMS = std::max(Interval, 1);
+    SingleShot = Options.get("single");
+
+    const auto ParsedPID = FEX::StatsTools::GetPID(Parser);
+    if (!ParsedPID) {
+      return false;
+    }
+
+    PID = *ParsedPID;
+    return true;
+  }
+} // namespace Config
+
+struct SyscallSample {
+  uint32_t Syscall;
+  FEXCore::SHMStats::SyscallStats Stats;
+};
+
+void Snapshot(const FEXCore::SHMStats::SyscallStatsHeader* Header, const std::byte* Entries, std::vector<FEXCore::SHMStats::SyscallStats>& Out) {
+  Out.resize(Header->NumSyscalls);
+  for (size_t i = 0; i < Header->NumSyscalls; ++i) {
+    // Entries may be larger than what this tool knows about if the emulator is newer.
+    memcpy(&Out[i], Entries + i * Header->SyscallStatsSize, std::min<size_t>(Header->SyscallStatsSize, sizeof(FEXCore::SHMStats::SyscallStats)));
+  }
+}
+
+// Returns the upper bound, in cycles, of the bucket that contains the requested percentile.
+uint64_t Percentile(const FEXCore::SHMStats::SyscallStats& Stats, uint32_t NumBuckets, double Fraction) {
+  const uint64_t Target = std::max<uint64_t>(1, Stats.Count * Fraction);
+  uint64_t Seen {};
+  for (uint32_t i = 0; i < NumBuckets; ++i) {
+    Seen += Stats.LatencyHistogram[i];
+    if (Seen >= Target) {
+      return 1ULL << i;
+    }
+  }
+  return 1ULL << (NumBuckets - 1);
+}
+
+void Print(const FEXCore::SHMStats::SyscallStatsHeader* Header, const std::vector<FEXCore::SHMStats::SyscallStats>& Current,
+           const std::vector<FEXCore::SHMStats::SyscallStats>& Previous, double Seconds, uint64_t Frequency, bool Totals) {
+  const auto& Names = Header->app_type == FEXCore::SHMStats::AppType::LINUX_32 ? x32SyscallNames : x64SyscallNames;
+  const uint32_t NumBuckets = std::min<uint32_t>(Header->NumLatencyBuckets, FEXCore::SHMStats::SYSCALL_LATENCY_BUCKETS);
+  const double CyclesToUS = 1'000'000.0 / Frequency;
+
+  std::vector<SyscallSample> Samples;
+  uint64_t TotalCount {};
+  uint64_t TotalTime {};
+  for (uint32_t i = 0; i < Current.size(); ++i) {
+    SyscallSample Sample {i, Current[i]};
+    if (!Previous.empty()) {
+      Sample.Stats.Count -= Previous[i].Count;
+      Sample.Stats.AccumulatedTime -= Previous[i].AccumulatedTime;
+      Sample.Stats.AccumulatedHostTime -= Previous[i].AccumulatedHostTime;
+      for (uint32_t j = 0; j < NumBuckets; ++j) {
+        Sample.Stats.LatencyHistogram[j] -= Previous[i].LatencyHistogram[j];
+      }
+    }
+
+    if (Sample.Stats.Count) {
+      TotalCount += Sample.Stats.Count;
+      TotalTime += Sample.Stats.AccumulatedTime;
+      Samples.emplace_back(Sample);
+    }
+  }
+
+  // Sort by time spent, that's where the overhead is.
+  std::sort(Samples.begin(), Samples.end(),
+            [](const SyscallSample& a, const SyscallSample& b) { return a.Stats.AccumulatedTime > b.Stats.AccumulatedTime; });
+
+  if (Totals) {
+    fmt::print("pid {}: {} syscalls, {:.2f} ms in syscalls\n\n", Config::PID, TotalCount, TotalTime * CyclesToUS / 1000.0);
+  } else {
+    fmt::print("\033[H\033[2J");
+    fmt::print("pid {}: {} syscalls/s, {:.2f} ms/s in syscalls\n\n", Config::PID, static_cast<uint64_t>(TotalCount / Seconds),
+               TotalTime * CyclesToUS / 1000.0 / Seconds);
+  }
+  fmt::print("{:<24} {:>12} {:>12} {:>10} {:>10} {:>10} {:>8}\n", "syscall", Totals ? "calls" : "calls/s", "avg(us)", "p50(us)", "p99(us)",
+             "max(us)", "host%");
+
+  for (size_t i = 0; i < std::min<size_t>(Samples.size(), Config::TopCount); ++i) {
+    const auto& Sample = Samples[i];
+    const auto& Stats = Sample.Stats;
+
+    std::string Name;
+    if (auto It = Names.find(Sample.Syscall); It != Names.end()) {
+      Name = It->second;
+    } else {
+      Name = fmt::format("syscall_{}", Sample.Syscall);
+    }
+
+    uint64_t MaxBucket {};
+    for (uint32_t j = 0; j < NumBuckets; ++j) {
+      if (Stats.LatencyHistogram[j]) {
+        MaxBucket = j;
+      }
+    }
+
+    // Host time is only measured for passthrough syscalls, a 0 here means the syscall is fully emulated.
+    const double HostPercent = Stats.AccumulatedTime ? Stats.AccumulatedHostTime * 100.0 / Stats.AccumulatedTime : 0.0;
+
+    fmt::print("{:<24} {:>12.1f} {:>12.2f} {:>10.2f} {:>10.2f} {:>10.2f} {:>7.1f}%\n", Name, Stats.Count / Seconds,
+               Stats.AccumulatedTime * CyclesToUS / Stats.Count, Percentile(Stats, NumBuckets, 0.5) * CyclesToUS,
+               Percentile(Stats, NumBuckets, 0.99) * CyclesToUS, (1ULL << MaxBucket) * CyclesToUS, HostPercent);
+  }
+  fflush(stdout);
+}
+} // namespace
+
+int main(int argc, char** argv) {
+  if (!Config::LoadOptions(argc, argv)) {
+    return 1;
+  }
+
+  std::string Name;
+  int fd = FEX::StatsTools::OpenStatsRegion(Config::PID, "syscalls", Name);
+  if (fd == -1) {
+    return 1;
+  }
+
+  struct stat buf {};
+  if (fstat(fd, &buf) == -1 || static_cast<size_t>(buf.st_size) < sizeof(FEXCore::SHMStats::SyscallStatsHeader)) {
+    fmt::print(stderr, "{} is too small\n", Name);
+    close(fd);
+    return 1;
+  }
+
+  const auto Size = buf.st_size;
+  auto Base = reinterpret_cast<const std::byte*>(mmap(nullptr, Size, PROT_READ, MAP_SHARED, fd, 0));
+  close(fd);
+
+  if (Base == MAP_FAILED) {
+    fmt::print(stderr, "Couldn't map {}\n", Name);
+    return 1;
+  }
+
+  auto Header = reinterpret_cast<const FEXCore::SHMStats::SyscallStatsHeader*>(Base);
+  if (Header->Version != FEXCore::SHMStats::SYSCALL_STATS_VERSION) {
+    fmt::print(stderr, "Unsupported syscall stats version {}, expected {}\n", Header->Version, FEXCore::SHMStats::SYSCALL_STATS_VERSION);
+    return 1;
+  }
+
+  if (sizeof(FEXCore::SHMStats::SyscallStatsHeader) + static_cast<size_t>(Header->NumSyscalls) * Header->SyscallStatsSize >
+      static_cast<size_t>(Size)) {
+    fmt::print(stderr, "{} is truncated\n", Name);
+    return 1;
+  }
+
+  const uint64_t Frequency = FEX::StatsTools::GetCycleCounterFrequency(Header->CycleCounterFrequency);
+  const auto Entries = Base + sizeof(FEXCore::SHMStats::SyscallStatsHeader);
+
+  std::vector<FEXCore::SHMStats::SyscallStats> Previous, Current;
+
+  if (Config::SingleShot) {
+    // Totals since the process started.
+    Snapshot(Header, Entries, Current);
+    Print(Header, Current, Previous, 1.0, Frequency, true);
+    return 0;
+  }
+
+  Snapshot(Header, Entries, Previous);
+  auto PreviousTime = std::chrono::steady_clock::now();
+
+  while (kill(Config::PID, 0) == 0) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(Config::IntervalMS));
+
+    Snapshot(Header, Entries, Current);
+    const auto Now = std::chrono::steady_clock::now();
+    const double Seconds = std::chrono::duration<double>(Now - PreviousTime).count();
+
+    Print(Header, Current, Previous, Seconds, Frequency, false);
+
+    std::swap(Previous, Current);
+    PreviousTime = Now;
+  }
+
+  return 0;
+}
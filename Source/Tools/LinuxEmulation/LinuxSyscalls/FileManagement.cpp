@@ -8,6 +8,7 @@ $end_info$
 
 #include "Common/Config.h"
 #include "Common/FDUtils.h"
+#include "Common/FEXServerClient.h"
 #include "Common/JSONPool.h"
 
 #include "FEXCore/Config/Config.h"
@@ -16,6 +17,7 @@ $end_info$
 #include "LinuxSyscalls/Syscalls.h"
 #include "LinuxSyscalls/x64/Syscalls.h"
 
+#include <FEXCore/Utils/Allocator.h>
 #include <FEXCore/Utils/LogManager.h>
 #include <FEXCore/Utils/FileLoading.h>
 #include <FEXCore/fextl/fmt.h>
@@ -34,8 +36,10 @@ $end_info$
 #include <filesystem>
 #include <optional>
 #include <stdio.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/statfs.h>
+#include <sys/statvfs.h>
 #include <sys/xattr.h>
 #include <syscall.h>
 #include <system_error>
@@ -227,6 +231,13 @@ FileManager::FileManager(FEXCore::Context::Context* ctx)
       RootFSFD = AT_FDCWD;
     } else {
       TrackFEXFD(RootFSFD);
+
+      // Squashfs and erofs images are mounted read-only, their path resolution can't change so it is safe to cache.
+      struct statvfs RootFSStat {};
+      if (fstatvfs(RootFSFD, &RootFSStat) == 0 && (RootFSStat.f_flag & ST_RDONLY)) {
+        PathCache = fextl::make_unique<RootFSPathCache>();
+        MapRootFSIndex();
+      }
     }
   }
 
@@ -346,9 +357,46 @@ FileManager::FileManager(FEXCore::Context::Context* ctx)
 }
 
 FileManager::~FileManager() {
+  if (PathCache) {
+    LogMan::Msg::DFmt("RootFS path cache: {} hits, {} negative hits, {} misses", PathCache->GetHits(), PathCache->GetNegativeHits(),
+                      PathCache->GetMisses());
+  }
+  if (RootFSIndexMapping) {
+    FEXCore::Allocator::munmap(RootFSIndexMapping, RootFSIndexSize);
+  }
   close(RootFSFD);
 }
 
+void FileManager::MapRootFSIndex() {
+  // In a pressure-vessel container the rootfs isn't the image that FEXServer mounted.
+  const int ServerFD = FEXServerClient::GetServerFD();
+  if (ServerFD == -1 || FEXCore::Config::FindContainer() == "pressure-vessel") {
+    return;
+  }
+
+  int FD = FEXServerClient::RequestRootFSIndexFD(ServerFD);
+  if (FD == -1) {
+    return;
+  }
+
+  // Only trust an index that can't be truncated or modified while mapped.
+  constexpr int RequiredSeals = F_SEAL_SHRINK | F_SEAL_WRITE;
+  struct stat Buffer {};
+  if ((fcntl(FD, F_GET_SEALS) & RequiredSeals) == RequiredSeals && fstat(FD, &Buffer) == 0 && Buffer.st_size > 0) {
+    auto Mapping = FEXCore::Allocator::mmap(nullptr, Buffer.st_size, PROT_READ, MAP_SHARED, FD, 0);
+    if (Mapping != MAP_FAILED) {
+      if (RootFSIndex.Init({static_cast<const std::byte*>(Mapping), static_cast<size_t>(Buffer.st_size)})) {
+        RootFSIndexMapping = Mapping;
+        RootFSIndexSize = Buffer.st_size;
+      } else {
+        FEXCore::Allocator::munmap(Mapping, Buffer.st_size);
+      }
+    }
+  }
+
+  close(FD);
+}
+
 size_t FileManager::GetRootFSPrefixLen(const char* pathname, size_t len, bool AliasedOnly) const {
   if (len < 2 ||            // If no pathname or root
       pathname[0] != '/') { // If we are getting root
@@ -506,6 +554,23 @@ FileManager::GetEmulatedFDPath(int dirfd, const char* pathname, bool FollowSymli
     return NoEntry;
   }
 
+  if (RootFSIndexMapping) {
+    if (auto Result = GetIndexedFDPath(pathname, FollowSymlink, TmpFilename)) {
+      return *Result;
+    }
+  }
+
+  if (PathCache) {
+    // The uncached path doesn't probe without following symlinks, but a negative entry saves the caller's rootfs attempt.
+    const auto Result = FollowSymlink ? PathCache->Find(pathname, true, TmpFilename[0]) :
+                                        PathCache->FindOrProbeNoFollow(RootFSFD, pathname, TmpFilename[0]);
+    switch (Result) {
+    case RootFSPathCache::LookupResult::NotInRootFS: return NoEntry;
+    case RootFSPathCache::LookupResult::Resolved: return EmulatedFDPathResult {RootFSFD, TmpFilename[0]};
+    case RootFSPathCache::LookupResult::Miss: break;
+    }
+  }
+
   // Starting subpath is the pathname passed in.
   const char* SubPath = pathname;
 
@@ -529,6 +594,9 @@ FileManager::GetEmulatedFDPath(int dirfd, const char* pathname, bool FollowSymli
       int Result = fstatat(RootFSFD, &SubPath[1], &Buffer, AT_SYMLINK_NOFOLLOW);
       if (Result != 0 && errno == ENOENT && !HadAtLeastOne) {
         // Initial file didn't exist at all
+        if (PathCache) {
+          PathCache->InsertNotInRootFS(pathname, true);
+        }
         return NoEntry;
       }
 
@@ -567,10 +635,28 @@ FileManager::GetEmulatedFDPath(int dirfd, const char* pathname, bool FollowSymli
     }
   }
 
+  if (PathCache) {
+    PathCache->InsertResolved(pathname, FollowSymlink, &SubPath[1]);
+  }
+
   // Return the pair of rootfs FD plus relative subpath by stripping off the front '/'
   return EmulatedFDPathResult {RootFSFD, &SubPath[1]};
 }
 
+std::optional<FileManager::EmulatedFDPathResult>
+FileManager::GetIndexedFDPath(const char* pathname, bool FollowSymlink, FDPathTmpData& TmpFilename) const {
+  // The image index stands in for fstatat and readlinkat in the symlink walk.
+  // Anything the index can't answer returns nullopt, to be resolved through the mount instead.
+  const char* SubPath {};
+  switch (RootFSIndex.Resolve(pathname, FollowSymlink, TmpFilename, &SubPath)) {
+  case FEX::RootFSIndex::LookupResult::Unknown: return std::nullopt;
+  case FEX::RootFSIndex::LookupResult::Missing: return EmulatedFDPathResult {-1, nullptr};
+  case FEX::RootFSIndex::LookupResult::Found: break;
+  }
+
+  return EmulatedFDPathResult {RootFSFD, SubPath};
+}
+
 ///< Returns true if the pathname is self and symlink flags are set NOFOLLOW.
 bool FileManager::IsSelfNoFollow(const char* Pathname, int flags) const {
   const bool Follow = (flags & AT_SYMLINK_NOFOLLOW) == 0;
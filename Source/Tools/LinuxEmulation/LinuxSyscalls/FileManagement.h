@@ -8,6 +8,7 @@ $end_info$
 #pragma once
 #include <FEXCore/Config/Config.h>
 #include <FEXCore/fextl/map.h>
+#include <FEXCore/fextl/memory.h>
 #include <FEXCore/fextl/set.h>
 #include <FEXCore/fextl/string.h>
 #include <FEXCore/fextl/unordered_map.h>
@@ -25,6 +26,8 @@ $end_info$
 #include <sys/stat.h>
 #include <unistd.h>
 
+#include "Common/RootFSIndex.h"
+#include "Common/RootFSPathCache.h"
 #include "LinuxSyscalls/EmulatedFiles/EmulatedFiles.h"
 
 namespace FEXCore::Context {
@@ -99,6 +102,17 @@ public:
   bool IsProtectedFile(int ParentDirFD, uint64_t inode) const;
   void SetProtectedCodeMapFD(int FD);
 
+  void LockBeforeFork() {
+    if (PathCache) {
+      PathCache->LockBeforeFork();
+    }
+  }
+  void UnlockAfterFork(bool Child) {
+    if (PathCache) {
+      PathCache->UnlockAfterFork(Child);
+    }
+  }
+
   fextl::string GetEmulatedPath(const char* pathname, bool FollowSymlink = false) const;
   fextl::string GetHostPath(fextl::string& Path, bool AliasedOnly) const;
 
@@ -161,6 +175,9 @@ private:
     const char* Path;
   };
   EmulatedFDPathResult GetEmulatedFDPath(int dirfd, const char* pathname, bool FollowSymlink, FDPathTmpData& TmpFilename) const;
+  std::optional<EmulatedFDPathResult> GetIndexedFDPath(const char* pathname, bool FollowSymlink, FDPathTmpData& TmpFilename) const;
+
+  void MapRootFSIndex();
 
   std::optional<std::string_view> GetSelf(const char* Pathname) const;
   bool IsSelfNoFollow(const char* Pathname, int flags) const;
@@ -188,6 +205,12 @@ private:
   FEX_CONFIG_OPT(Is64BitMode, IS64BIT_MODE);
   uint32_t CurrentPID {};
   int RootFSFD {AT_FDCWD};
+  // Only allocated when the rootfs is mounted read-only.
+  fextl::unique_ptr<RootFSPathCache> PathCache;
+  // Path index of the rootfs image, shared by FEXServer.
+  FEX::RootFSIndex::View RootFSIndex;
+  void* RootFSIndexMapping {};
+  size_t RootFSIndexSize {};
   int ProcFD {0};
   int64_t RootFSFDInode = 0;
   int64_t ProcFDInode = 0;
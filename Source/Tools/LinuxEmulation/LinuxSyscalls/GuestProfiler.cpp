@@ -0,0 +1,186 @@
+// SPDX-License-Identifier: MIT
+/*
+$info$
+tags: LinuxSyscalls|common
+desc: Samples guest RIPs on a per-thread CPU time timer and writes folded stacks
+$end_info$
+*/
+
+#include "ArchHelpers/MContext.h"
+#include "LinuxSyscalls/GuestProfiler.h"
+#include "LinuxSyscalls/SignalDelegator.h"
+#include "LinuxSyscalls/Syscalls.h"
+#include "LinuxSyscalls/ThreadManager.h"
+
+#include <FEXCore/Core/CodeCache.h>
+#include <FEXCore/Core/Context.h>
+#include <FEXCore/Debug/InternalThreadState.h>
+#include <FEXCore/HLE/SourcecodeResolver.h>
+#include <FEXCore/Utils/LogManager.h>
+#include <FEXCore/fextl/fmt.h>
+#include <FEXCore/fextl/map.h>
+#include <FEXHeaderUtils/Syscalls.h>
+
+#include <algorithm>
+#include <fcntl.h>
+#include <signal.h>
+#include <time.h>
+#include <unistd.h>
+
+// For older build environments
+#ifndef sigev_notify_thread_id
+#define sigev_notify_thread_id _sigev_un._tid
+#endif
+
+namespace FEX::HLE {
+GuestProfiler::GuestProfiler(FEXCore::Context::Context* CTX, std::string_view Directory, std::string_view ApplicationName, uint32_t Frequency)
+  : CTX {CTX}
+  , Directory {Directory}
+  , ApplicationName {ApplicationName}
+  , IntervalNS {1'000'000'000ULL / std::max(Frequency, 1U)} {}
+
+void GuestProfiler::RegisterThread(FEX::HLE::ThreadStateObject* Thread) {
+  sigevent Event {};
+  Event.sigev_notify = SIGEV_THREAD_ID;
+  Event.sigev_signo = SignalDelegator::SIGNAL_FOR_PAUSE;
+  Event.sigev_notify_thread_id = FHU::Syscalls::gettid();
+
+  // Thread CPU time so idle threads aren't sampled. Busy threads can still take a sample inside of a syscall.
+  if (timer_create(CLOCK_THREAD_CPUTIME_ID, &Event, &Thread->ProfileTimer) == -1) {
+    LogMan::Msg::EFmt("[GuestProfiler] Couldn't create sampling timer: {}", errno);
+    return;
+  }
+
+  const timespec Interval {
+    .tv_sec = static_cast<time_t>(IntervalNS / 1'000'000'000ULL),
+    .tv_nsec = static_cast<long>(IntervalNS % 1'000'000'000ULL),
+  };
+  const itimerspec Spec {
+    .it_interval = Interval,
+    .it_value = Interval,
+  };
+  timer_settime(Thread->ProfileTimer, 0, &Spec, nullptr);
+  Thread->HasProfileTimer = true;
+}
+
+void GuestProfiler::UninstallThread(FEX::HLE::ThreadStateObject* Thread) {
+  if (!Thread->HasProfileTimer) {
+    return;
+  }
+
+  timer_delete(Thread->ProfileTimer);
+  Thread->HasProfileTimer = false;
+}
+
+void GuestProfiler::ResetAfterFork(FEX::HLE::ThreadStateObject* LiveThread) {
+  ClearSamples();
+  Written.store(false, std::memory_order_relaxed);
+
+  // The parent's timer handle is meaningless in the child.
+  LiveThread->HasProfileTimer = false;
+  RegisterThread(LiveThread);
+}
+
+void GuestProfiler::ClearSamples() {
+  for (auto& Entry : Samples) {
+    Entry.Key.store(0, std::memory_order_relaxed);
+    Entry.Count.store(0, std::memory_order_relaxed);
+  }
+  DroppedSamples.store(0, std::memory_order_relaxed);
+}
+
+void GuestProfiler::RecordSample(FEXCore::Core::InternalThreadState* Thread, void* ucontext) {
+  const auto PC = ArchHelpers::Context::GetPc(ucontext);
+  const bool InJIT = CTX->IsAddressInCodeBuffer(Thread, PC);
+
+  // Outside of the JIT the thread is in the dispatcher, a syscall, or compiling. Attribute it to the last known RIP.
+  const uint64_t RIP = InJIT ? CTX->RestoreRIPFromHostPC(Thread, PC) : Thread->CurrentFrame->State.rip;
+  const uint64_t Key = (RIP << 1) | (InJIT ? 0 : 1);
+
+  const size_t Hash = (Key * 0x9E37'79B9'7F4A'7C15ULL) >> 48;
+  for (size_t i = 0; i < MaxProbe; ++i) {
+    auto& Entry = Samples[(Hash + i) & (NumEntries - 1)];
+    uint64_t EntryKey = Entry.Key.load(std::memory_order_relaxed);
+    if (EntryKey == 0 && Entry.Key.compare_exchange_strong(EntryKey, Key, std::memory_order_relaxed)) {
+      EntryKey = Key;
+    }
+
+    if (EntryKey == Key) {
+      Entry.Count.fetch_add(1, std::memory_order_relaxed);
+      return;
+    }
+  }
+
+  DroppedSamples.fetch_add(1, std::memory_order_relaxed);
+}
+
+void GuestProfiler::WriteProfile(FEXCore::Core::InternalThreadState* Thread) {
+  if (Written.exchange(true)) {
+    return;
+  }
+
+  // Collapse the samples down to one line per resolved frame.
+  fextl::map<fextl::string, uint64_t> Folded;
+  for (const auto& Entry : Samples) {
+    const auto Key = Entry.Key.load(std::memory_order_relaxed);
+    const auto Count = Entry.Count.load(std::memory_order_relaxed);
+    if (Key == 0 || Count == 0) {
+      continue;
+    }
+
+    const uint64_t RIP = Key >> 1;
+    const bool InFEX = Key & 1;
+
+    fextl::string Frame;
+    if (auto Section = FEX::HLE::_SyscallHandler->LookupExecutableFileSection(Thread, RIP)) {
+      const auto& Filename = Section->FileInfo.Filename;
+      const auto Module = Filename.substr(Filename.find_last_of('/') + 1);
+      const uintptr_t FileOffset = RIP - Section->FileStartVA;
+
+      const FEXCore::HLE::SourcecodeSymbolMapping* Sym {};
+      if (Section->FileInfo.SourcecodeMap) {
+        Sym = Section->FileInfo.SourcecodeMap->FindSymbolMapping(FileOffset);
+      }
+
+      if (Sym) {
+        Frame = fextl::fmt::format("{};{}", Module, Sym->Name);
+      } else {
+        Frame = fextl::fmt::format("{};+0x{:x}", Module, FileOffset);
+      }
+    } else {
+      Frame = fextl::fmt::format("[anon];0x{:x}", RIP);
+    }
+
+    if (InFEX) {
+      Frame += ";[FEX]";
+    }
+
+    Folded[Frame] += Count;
+  }
+
+  if (const auto Dropped = DroppedSamples.load(std::memory_order_relaxed)) {
+    Folded["[dropped]"] += Dropped;
+  }
+
+  if (Folded.empty()) {
+    return;
+  }
+
+  const auto Path = fextl::fmt::format("{}/{}-{}.folded", Directory, ApplicationName, ::getpid());
+  int FD = open(Path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+  if (FD == -1) {
+    LogMan::Msg::EFmt("[GuestProfiler] Couldn't open '{}' for writing", Path);
+    return;
+  }
+
+  for (const auto& [Frame, Count] : Folded) {
+    const auto Line = fextl::fmt::format("{} {}\n", Frame, Count);
+    if (write(FD, Line.data(), Line.size()) == -1) {
+      break;
+    }
+  }
+
+  close(FD);
+  LogMan::Msg::IFmt("[GuestProfiler] Wrote guest profile to '{}'", Path);
+}
+} // namespace FEX::HLE
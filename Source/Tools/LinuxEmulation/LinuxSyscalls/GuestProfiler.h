@@ -0,0 +1,77 @@
+// SPDX-License-Identifier: MIT
+/*
+$info$
+tags: LinuxSyscalls|common
+desc: Samples guest RIPs on a per-thread CPU time timer and writes folded stacks
+$end_info$
+*/
+#pragma once
+
+#include <FEXCore/Utils/AllocatorHooks.h>
+#include <FEXCore/fextl/string.h>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <string_view>
+
+namespace FEXCore::Context {
+class Context;
+}
+namespace FEXCore::Core {
+struct InternalThreadState;
+}
+
+namespace FEX::HLE {
+struct ThreadStateObject;
+
+/**
+ * @brief Low overhead guest RIP sampling profiler.
+ *
+ * Each guest thread gets a POSIX timer on its own CPU time clock, which delivers `SIGNAL_FOR_PAUSE` with `SI_TIMER`.
+ * The signal handler maps the interrupted host PC back to a guest RIP and bumps a counter in a lock-free table.
+ * Idle threads don't consume CPU time so they aren't sampled, but a sample can still land while a thread is in a syscall.
+ * The pause handler is installed with `SA_RESTART` while profiling, which covers restartable syscalls; the ones the kernel
+ * never restarts (nanosleep, poll, epoll_wait, etc) can still return EINTR to the guest.
+ *
+ * Symbol resolution is deferred until the profile is written, where samples are resolved through the
+ * executable file section tracking and written as `<Directory>/<Application>-<pid>.folded` for flamegraph tooling.
+ */
+class GuestProfiler final : public FEXCore::Allocator::FEXAllocOperators {
+public:
+  GuestProfiler(FEXCore::Context::Context* CTX, std::string_view Directory, std::string_view ApplicationName, uint32_t Frequency);
+
+  // Starts and stops the sampling timer for the calling thread.
+  void RegisterThread(FEX::HLE::ThreadStateObject* Thread);
+  void UninstallThread(FEX::HLE::ThreadStateObject* Thread);
+
+  // Timers and samples aren't inherited by the child process, restart from a clean table.
+  void ResetAfterFork(FEX::HLE::ThreadStateObject* LiveThread);
+
+  // Called from the SIGNAL_FOR_PAUSE handler. Must stay async-signal safe.
+  void RecordSample(FEXCore::Core::InternalThreadState* Thread, void* ucontext);
+
+  // Resolves the samples and writes the folded stack file. Only the first call writes.
+  void WriteProfile(FEXCore::Core::InternalThreadState* Thread);
+
+private:
+  FEXCore::Context::Context* CTX;
+  const fextl::string Directory;
+  const fextl::string ApplicationName;
+  const uint64_t IntervalNS;
+
+  // Key is the guest RIP shifted up by one, with the bottom bit set if the sample landed outside of JIT code.
+  struct SampleEntry {
+    std::atomic<uint64_t> Key {};
+    std::atomic<uint64_t> Count {};
+  };
+
+  constexpr static size_t NumEntries = 1U << 16;
+  constexpr static size_t MaxProbe = 32;
+  std::array<SampleEntry, NumEntries> Samples {};
+  std::atomic<uint64_t> DroppedSamples {};
+  std::atomic<bool> Written {};
+
+  void ClearSamples();
+};
+} // namespace FEX::HLE
@@ -2,13 +2,14 @@
 #include "LinuxSyscalls/LinuxAllocator.h"
 #include "LinuxSyscalls/Syscalls.h"
 
+#include "Common/PageRangeIndex.h"
+
 #include <FEXCore/Utils/MathUtils.h>
 #include <FEXCore/Utils/TypeDefines.h>
 #include <FEXHeaderUtils/Syscalls.h>
 #include <FEXCore/fextl/map.h>
 #include <FEXCore/fextl/memory.h>
 
-#include <bitset>
 #include <linux/mman.h>
 #include <unistd.h>
 #include <sys/user.h>
@@ -29,11 +30,9 @@ private:
 public:
   MemAllocator32Bit() {
     // First 16 pages are taken by the Linux kernel
-    for (size_t i = 0; i < 16; ++i) {
-      MappedPages.set(i);
-    }
+    MappedPages.SetUsed(0, BASE_KEY);
     // Take the top page as well
-    MappedPages.set(TOP_KEY);
+    MappedPages.SetUsed(TOP_KEY, 1);
     if (SearchDown) {
       LastScanLocation = TOP_KEY;
       LastKeyLocation = TOP_KEY;
@@ -56,25 +55,18 @@ public:
   // PageAddr is a page already shifted to page index
   // PagesLength is the number of pages
   void SetUsedPages(uint64_t PageAddr, size_t PagesLength) {
-    // Set the range as mapped
-    for (size_t i = 0; i < PagesLength; ++i) {
-      MappedPages.set(PageAddr + i);
-    }
+    MappedPages.SetUsed(PageAddr, PagesLength);
   }
 
   // PageAddr is a page already shifted to page index
   // PagesLength is the number of pages
   void SetFreePages(uint64_t PageAddr, size_t PagesLength) {
-    // Set the range as unused
-    for (size_t i = 0; i < PagesLength; ++i) {
-      MappedPages.reset(PageAddr + i);
-    }
+    MappedPages.SetFree(PageAddr, PagesLength);
   }
 
 private:
-  // Set that contains 4k mapped pages
-  // This is the full 32bit memory range
-  std::bitset<0x10'0000> MappedPages;
+  // Tracks 4k mapped pages of the full 32bit memory range
+  FEX::PageRangeIndex MappedPages;
   fextl::map<uint32_t, int> PageToShm {};
   uint64_t LastScanLocation {};
   uint64_t LastKeyLocation {};
@@ -87,49 +79,18 @@ private:
 };
 
 uint64_t MemAllocator32Bit::FindPageRange(uint64_t Start, size_t Pages) const {
-  // Linear range scan
-  while (Start != TOP_KEY) {
-    bool Free = true;
-    if ((Start + Pages) > TOP_KEY) {
-      return 0;
-    }
-    uint64_t Offset = 0;
-    for (; Offset < Pages; ++Offset) {
-      if (MappedPages.test(Start + Offset)) {
-        Free = false;
-        break;
-      }
-    }
-
-    if (Free) {
-      return Start;
-    }
-    Start += Offset + 1;
-  }
-
-  return 0;
+  // The reserved low pages and the top page are always marked used, so any range found is in bounds.
+  const uint64_t LowerPage = MappedPages.FindFirstFit(Start, Pages);
+  return LowerPage == FEX::PageRangeIndex::NoRange ? 0 : LowerPage;
 }
 
 uint64_t MemAllocator32Bit::FindPageRange_TopDown(uint64_t Start, size_t Pages) const {
-  // Linear range scan
-  while (Start >= BASE_KEY && Start <= TOP_KEY) {
-    bool Free = true;
-
-    uint64_t Offset = 0;
-    for (; Offset < Pages; ++Offset) {
-      if (MappedPages.test(Start - Offset)) {
-        Free = false;
-        break;
-      }
-    }
-
-    if (Free) {
-      return Start - Offset;
-    }
-    Start -= Offset + 1;
+  if (Start < BASE_KEY || Start > TOP_KEY) {
+    return 0;
   }
 
-  return 0;
+  const uint64_t LowerPage = MappedPages.FindLastFit(Start, Pages);
+  return LowerPage == FEX::PageRangeIndex::NoRange ? 0 : LowerPage;
 }
 
 void* MemAllocator32Bit::Mmap(void* addr, size_t length, int prot, int flags, int fd, off_t offset) {
@@ -204,7 +165,8 @@ restart: {
         ::munmap(MappedPtr, length);
       }
 
-      if (UpperPage == TOP_KEY) {
+      if (!SearchDown && UpperPage == TOP_KEY) {
+        // Hit the top while searching upwards, wrap around to the bottom
         BottomPage = BASE_KEY;
         Wrapped = true;
         goto restart;
@@ -284,20 +246,21 @@ int MemAllocator32Bit::Munmap(void* addr, size_t length) {
     return 0;
   }
 
+  const uintptr_t FirstPage = PageAddr;
   while (PageAddr != PageEnd) {
     // Always pass to munmap, it may be something allocated we aren't tracking
     int Result = ::munmap(reinterpret_cast<void*>(PageAddr << FEXCore::Utils::FEX_PAGE_SHIFT), FEXCore::Utils::FEX_PAGE_SIZE);
     if (Result != 0) {
-      return -errno;
-    }
-
-    if (MappedPages.test(PageAddr)) {
-      MappedPages.reset(PageAddr);
+      Result = -errno;
+      // Only the pages that were unmapped so far are free now
+      SetFreePages(FirstPage, PageAddr - FirstPage);
+      return Result;
     }
 
     ++PageAddr;
   }
 
+  SetFreePages(FirstPage, PagesLength);
   return 0;
 }
 
@@ -340,15 +303,8 @@ void* MemAllocator32Bit::Mremap(void* old_address, size_t old_size, size_t new_s
           return reinterpret_cast<void*>(-errno);
         }
       } else {
-        // Scan the region forward from our first region's endd to see if it can be extended
-        bool CanExtend {true};
-
-        for (size_t i = OldPagesLength; i < NewPagesLength; ++i) {
-          if (MappedPages[OldPageAddr + i]) {
-            CanExtend = false;
-            break;
-          }
-        }
+        // Check the region forward from our first region's end to see if it can be extended
+        const bool CanExtend = MappedPages.IsRangeFree(OldPageAddr + OldPagesLength, NewPagesLength - OldPagesLength);
 
         if (CanExtend) {
           void* MappedPtr = ::mremap(old_address, old_size, new_size, flags & ~MREMAP_MAYMOVE);
@@ -470,7 +426,7 @@ restart: {
     void* MappedPtr = ::shmat(shmid, reinterpret_cast<const void*>(LowerPage << FEXCore::Utils::FEX_PAGE_SHIFT), shmflg);
 
     if (MappedPtr == MAP_FAILED) {
-      if (UpperPage == TOP_KEY) {
+      if (!SearchDown && UpperPage == TOP_KEY) {
         BottomPage = LastKeyLocation;
         Wrapped = true;
         goto restart;
@@ -87,6 +87,13 @@ void SignalDelegator::HandleSignal(FEX::HLE::ThreadStateObject* Thread, int Sign
                       FHU::Syscalls::gettid());
   } else {
     SignalHandler& Handler = HostHandlers[Signal];
+
+    // Signals FEX doesn't handle itself, like the SIGURG/SIGPROF preemption signals of managed runtimes, can usually be
+    // handed straight to the guest handler.
+    if (Handler.Handlers.empty() && !Handler.FrontendHandler && TryDeliverGuestSignalFast(Thread, Signal, Info, UContext)) {
+      return;
+    }
+
     for (auto& HandlerFunc : Handler.Handlers) {
       if (HandlerFunc(Thread->Thread, Signal, Info, UContext)) {
         // If the host handler handled the fault then we can continue now
@@ -321,6 +328,18 @@ bool SignalDelegator::HandleDispatcherGuestSignal(FEXCore::Core::InternalThreadS
     // We are in jit, SRA must be spilled
     SpillSRA(Thread, ucontext, IgnoreMask);
 
+#ifdef ARCHITECTURE_arm64
+    // Inline syscalls store the address of their `svc` in the upper bits.
+    // If the kernel has already returned from it then the syscall has completed, so the guest must not execute it again.
+    // At or before the `svc` the guest RIP still points at the syscall instruction, which restarts it.
+    const uint64_t InlineSyscallPC = Frame->InSyscallInfo >> 16;
+    if (InlineSyscallPC != 0 && OldPC > InlineSyscallPC) {
+      constexpr uint64_t SyscallInstSize = 2;
+      Frame->State.gregs[FEXCore::X86State::REG_RAX] = ArchHelpers::Context::GetArmReg(ucontext, 0);
+      Frame->State.rip += SyscallInstSize;
+    }
+#endif
+
     ContextBackup->Flags |= ArchHelpers::Context::ContextFlags::CONTEXT_FLAG_INJIT;
 
     // We are leaving the syscall information behind. Make sure to store the previous state.
@@ -443,6 +462,12 @@ bool SignalDelegator::HandleSIGILL(FEXCore::Core::InternalThreadState* Thread, i
 }
 
 bool SignalDelegator::HandleSignalPause(FEXCore::Core::InternalThreadState* Thread, int Signal, void* info, void* ucontext) {
+  if (Profiler && static_cast<siginfo_t*>(info)->si_code == SI_TIMER) {
+    // Guest profiler sampling timer, doesn't interact with the pause state machine.
+    Profiler->RecordSample(Thread, ucontext);
+    return true;
+  }
+
   auto ThreadObject = FEX::HLE::ThreadManager::GetStateObjectFromFEXCoreThread(Thread);
   SignalEvent SignalReason = ThreadObject->SignalReason.load();
   auto Frame = Thread->CurrentFrame;
@@ -563,15 +588,8 @@ uint64_t SignalDelegator::GetNewSigMask(int Signal) const {
     NewMask |= (1ULL << (Signal - 1));
   }
 
-  // Walk our required signals and stop masking them if requested
-  for (size_t i = 0; i < MAX_SIGNALS; ++i) {
-    if (HostHandlers[i + 1].Required.load(std::memory_order_relaxed)) {
-      // Never mask our required signals
-      NewMask &= ~(1ULL << i);
-    }
-  }
-
-  return NewMask;
+  // Never mask our required signals
+  return NewMask & ~RequiredSignalsMask.load(std::memory_order_relaxed);
 }
 
 bool SignalDelegator::HandleFrontendSIGSEGV(FEXCore::Core::InternalThreadState* Thread, int Signal, void* Info, void* UContext) {
@@ -594,6 +612,31 @@ bool SignalDelegator::HandleFrontendSIGSEGV(FEXCore::Core::InternalThreadState*
   return false;
 }
 
+bool SignalDelegator::TryDeliverGuestSignalFast(FEX::HLE::ThreadStateObject* ThreadObject, int Signal, void* Info, void* UContext) {
+  auto Thread = ThreadObject->Thread;
+  auto SigInfo = static_cast<siginfo_t*>(Info);
+  SignalHandler& Handler = HostHandlers[Signal];
+  const auto GuestHandler = Handler.GuestAction.sigaction_handler.handler;
+
+  // Only the common case is handled here: an asynchronous signal outside of any signal-deferring section, that the guest
+  // has a handler for, doesn't have masked and that runs on the current stack.
+  // Deferral, pending signals, the altstack and default actions all take the full path in HandleGuestSignal.
+  if (!IsAsyncSignal(SigInfo, Signal) || Thread->CurrentFrame->State.DeferredSignalRefCount.Load() != 0 ||
+      (ThreadObject->SignalInfo.CurrentSignalMask.Val & (1ULL << (Signal - 1))) || GuestHandler == SIG_DFL || GuestHandler == SIG_IGN ||
+      (Handler.GuestAction.sa_flags & SA_ONSTACK) || !Handler.GuestHandler) {
+    return false;
+  }
+
+  ThreadObject->SignalInfo.PendingSignals &= ~(1ULL << (Signal - 1));
+
+  // Skips the siginfo copy and the indirect call through GuestHandler, which would only look the thread up again.
+  HandleDispatcherGuestSignal(Thread, Signal, SigInfo, UContext, &Handler.GuestAction, &ThreadObject->SignalInfo.GuestAltStack);
+
+  uint64_t NewMask = GetNewSigMask(Signal);
+  memcpy(&static_cast<ucontext_t*>(UContext)->uc_sigmask, &NewMask, sizeof(uint64_t));
+  return true;
+}
+
 void SignalDelegator::HandleGuestSignal(FEX::HLE::ThreadStateObject* ThreadObject, int Signal, void* Info, void* UContext) {
   auto Thread = ThreadObject->Thread;
   ucontext_t* _context = (ucontext_t*)UContext;
@@ -791,6 +834,12 @@ bool SignalDelegator::UpdateHostThunk(int Signal) {
   SignalHandler.HostAction.sa_flags = CheckAndAddFlags(SignalHandler.HostAction.sa_flags, SignalHandler.GuestAction.sa_flags,
                                                        SA_NOCLDSTOP | SA_NOCLDWAIT | SA_NODEFER | SA_RESTART);
 
+  // Profiler samples land on the pause signal, restart syscalls that it interrupts so the guest doesn't see spurious EINTR.
+  // Syscalls that the kernel never restarts (nanosleep, poll, epoll_wait, etc) still return EINTR.
+  if (Signal == SIGNAL_FOR_PAUSE && Profiler) {
+    SignalHandler.HostAction.sa_flags |= SA_RESTART;
+  }
+
 #ifdef ARCHITECTURE_x86_64
 #define SA_RESTORER 0x04000000
   SignalHandler.HostAction.sa_flags |= SA_RESTORER;
@@ -892,6 +941,10 @@ SignalDelegator::SignalDelegator(FEXCore::Context::Context* _CTX, const std::str
     UnalignedHandlerType = FEXCore::ArchHelpers::Arm64::UnalignedHandlerType::NonAtomic;
   }
 
+  if (!GuestProfile().empty()) {
+    Profiler = fextl::make_unique<GuestProfiler>(CTX, GuestProfile(), ApplicationName, GuestProfileFrequency());
+  }
+
   // Most signals default to termination
   // These ones are slightly different
   static constexpr std::array<std::pair<int, SignalDelegator::DefaultBehaviour>, 14> SignalDefaultBehaviours = {{
@@ -1009,6 +1062,10 @@ void SignalDelegator::RegisterTLSState(FEX::HLE::ThreadStateObject* Thread) {
 
   Thread->SignalInfo.Delegator = this;
 
+  if (Profiler) {
+    Profiler->RegisterThread(Thread);
+  }
+
   // Set up our signal alternative stack
   // This is per thread rather than per signal
   Thread->SignalInfo.AltStackPtr = FEXCore::Allocator::mmap(nullptr, SIGSTKSZ * 16, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
@@ -1042,6 +1099,10 @@ void SignalDelegator::RegisterTLSState(FEX::HLE::ThreadStateObject* Thread) {
 }
 
 void SignalDelegator::UninstallTLSState(FEX::HLE::ThreadStateObject* Thread) {
+  if (Profiler) {
+    Profiler->UninstallThread(Thread);
+  }
+
   FEXCore::Allocator::munmap(Thread->SignalInfo.AltStackPtr, SIGSTKSZ * 16);
 
   Thread->SignalInfo.AltStackPtr = nullptr;
@@ -1062,7 +1123,7 @@ void SignalDelegator::FrontendRegisterHostSignalHandler(int Signal, bool Require
   // Linux signal handlers are per-process rather than per thread
   // Multiple threads could be calling in to this
   std::lock_guard lk(HostDelegatorMutex);
-  HostHandlers[Signal].Required = Required;
+  SetRequired(Signal, Required);
   InstallHostThunk(Signal);
 }
 
@@ -1070,7 +1131,7 @@ void SignalDelegator::FrontendRegisterFrontendHostSignalHandler(int Signal, bool
   // Linux signal handlers are per-process rather than per thread
   // Multiple threads could be calling in to this
   std::lock_guard lk(HostDelegatorMutex);
-  HostHandlers[Signal].Required = Required;
+  SetRequired(Signal, Required);
   InstallHostThunk(Signal);
 }
 
@@ -1229,15 +1290,10 @@ uint64_t SignalDelegator::GuestSigProcMask(FEX::HLE::ThreadStateObject* Thread,
       return -EINVAL;
     }
 
-    uint64_t HostMask = Thread->SignalInfo.CurrentSignalMask.Val;
     // Now actually set the host mask
     // This will hide from the guest that we are not actually setting all of the masks it wants
-    for (size_t i = 0; i < MAX_SIGNALS; ++i) {
-      if (HostHandlers[i + 1].Required.load(std::memory_order_relaxed)) {
-        // If it is a required host signal then we can't mask it
-        HostMask &= ~(1ULL << i);
-      }
-    }
+    // If it is a required host signal then we can't mask it
+    uint64_t HostMask = Thread->SignalInfo.CurrentSignalMask.Val & ~RequiredSignalsMask.load(std::memory_order_relaxed);
 
     ::syscall(SYS_rt_sigprocmask, SIG_SETMASK, &HostMask, nullptr, 8);
   }
@@ -8,6 +8,7 @@ $end_info$
 
 #pragma once
 
+#include "LinuxSyscalls/GuestProfiler.h"
 #include "LinuxSyscalls/Types.h"
 #include "ArchHelpers/MContext.h"
 #include "VDSO_Emulation.h"
@@ -146,11 +147,25 @@ public:
 
   void SaveTelemetry();
 
+  // Writes the guest sampling profile if FEX_GUESTPROFILE is enabled.
+  void SaveGuestProfile(FEXCore::Core::InternalThreadState* Thread) {
+    if (Profiler) {
+      Profiler->WriteProfile(Thread);
+    }
+  }
+
+  void ResetGuestProfileAfterFork(FEX::HLE::ThreadStateObject* LiveThread) {
+    if (Profiler) {
+      Profiler->ResetAfterFork(LiveThread);
+    }
+  }
+
   void SpillSRA(FEXCore::Core::InternalThreadState* Thread, void* ucontext, uint32_t IgnoreMask);
 
 private:
   // Called from the thunk handler to handle the signal
   void HandleGuestSignal(FEX::HLE::ThreadStateObject* ThreadObject, int Signal, void* Info, void* UContext);
+  bool TryDeliverGuestSignalFast(FEX::HLE::ThreadStateObject* ThreadObject, int Signal, void* Info, void* UContext);
   bool HandleFrontendSIGSEGV(FEXCore::Core::InternalThreadState* Thread, int Signal, void* Info, void* UContext);
 
   /**
@@ -171,6 +186,10 @@ private:
   FEX_CONFIG_OPT(Is64BitMode, IS64BIT_MODE);
   const fextl::string ApplicationName;
   FEX_CONFIG_OPT(HalfBarrierTSOEnabled, HALFBARRIERTSOENABLED);
+  FEX_CONFIG_OPT(GuestProfile, GUESTPROFILE);
+  FEX_CONFIG_OPT(GuestProfileFrequency, GUESTPROFILEFREQUENCY);
+
+  fextl::unique_ptr<GuestProfiler> Profiler;
 
   FEXCore::ArchHelpers::Arm64::UnalignedHandlerType UnalignedHandlerType {FEXCore::ArchHelpers::Arm64::UnalignedHandlerType::HalfBarrier};
 
@@ -209,6 +228,18 @@ private:
   };
 
   std::array<SignalHandler, MAX_SIGNALS + 1> HostHandlers {};
+
+  // Mirror of every handler's Required flag.
+  // Signal delivery needs this on every guest signal, a single load is much cheaper than walking all of the handlers.
+  std::atomic<uint64_t> RequiredSignalsMask {};
+  void SetRequired(int Signal, bool Required) {
+    HostHandlers[Signal].Required = Required;
+    if (Required) {
+      RequiredSignalsMask.fetch_or(1ULL << (Signal - 1), std::memory_order_relaxed);
+    } else {
+      RequiredSignalsMask.fetch_and(~(1ULL << (Signal - 1)), std::memory_order_relaxed);
+    }
+  }
   bool InstallHostThunk(int Signal);
   bool UpdateHostThunk(int Signal);
 
@@ -43,6 +43,7 @@ $end_info$
 
 #include <algorithm>
 #include <alloca.h>
+#include <atomic>
 #include <charconv>
 #include <functional>
 #include <linux/audit.h>
@@ -826,6 +827,39 @@ uint32_t SyscallHandler::CalculateGuestKernelVersion() {
   return std::max(KernelVersion(5, 15), std::min(KernelVersion(6, 11), GetHostKernelVersion()));
 }
 
+namespace {
+  // Records the syscall's count and latency on every return path, only when stats are enabled.
+  class ScopedSyscallStats final {
+  public:
+    ScopedSyscallStats(FEXCore::Core::CpuStateFrame* Frame, FEXCore::SHMStats::SyscallStats* Entry)
+      : Stats {Frame->Thread->ThreadStats ? Entry : nullptr} {
+      if (this->Stats) {
+        ThreadObject = FEX::HLE::ThreadManager::GetStateObjectFromCPUState(Frame);
+        ThreadObject->SyscallHostTime = 0;
+        Begin = FEXCore::SHMStats::GetCycleCounter();
+      }
+    }
+
+    ~ScopedSyscallStats() {
+      if (!Stats) {
+        return;
+      }
+
+      // Multiple guest threads can be in the same syscall at once.
+      const auto Duration = FEXCore::SHMStats::GetCycleCounter() - Begin;
+      std::atomic_ref(Stats->Count).fetch_add(1, std::memory_order_relaxed);
+      std::atomic_ref(Stats->AccumulatedTime).fetch_add(Duration, std::memory_order_relaxed);
+      std::atomic_ref(Stats->AccumulatedHostTime).fetch_add(ThreadObject->SyscallHostTime, std::memory_order_relaxed);
+      std::atomic_ref(Stats->LatencyHistogram[FEXCore::SHMStats::GetLatencyBucket(Duration)]).fetch_add(1, std::memory_order_relaxed);
+    }
+
+  private:
+    FEXCore::SHMStats::SyscallStats* Stats;
+    FEX::HLE::ThreadStateObject* ThreadObject {};
+    uint64_t Begin {};
+  };
+} // namespace
+
 uint64_t SyscallHandler::HandleSyscall(FEXCore::Core::CpuStateFrame* Frame, FEXCore::HLE::SyscallArguments* Args) {
   // Grab the return address which will be inside the JIT.
   const uint64_t JITPC = reinterpret_cast<uint64_t>(__builtin_extract_return_addr(__builtin_return_address(0)));
@@ -840,6 +874,8 @@ uint64_t SyscallHandler::HandleSyscall(FEXCore::Core::CpuStateFrame* Frame, FEXC
     return -ENOSYS;
   }
 
+  ScopedSyscallStats SyscallStats {Frame, TM.GetSyscallStats(Args->Argument[0])};
+
   auto& Def = Definitions[Args->Argument[0]];
   uint64_t Result {};
   switch (Def.NumArgs) {
@@ -902,6 +938,7 @@ void SyscallHandler::LockBeforeFork(FEXCore::Core::InternalThreadState* Thread)
   TM.LockBeforeFork();
   Thread->CTX->LockBeforeFork(Thread);
   VMATracking.Mutex.lock();
+  FM.LockBeforeFork();
 }
 
 void SyscallHandler::UnlockAfterFork(FEXCore::Core::InternalThreadState* LiveThread, bool Child) {
@@ -910,7 +947,11 @@ void SyscallHandler::UnlockAfterFork(FEXCore::Core::InternalThreadState* LiveThr
     FM.SetProtectedCodeMapFD(-1);
 
     VMATracking.Mutex.StealAndDropActiveLocks();
+    FM.UnlockAfterFork(true);
+
+    SignalDelegation->ResetGuestProfileAfterFork(FEX::HLE::ThreadManager::GetStateObjectFromFEXCoreThread(LiveThread));
   } else {
+    FM.UnlockAfterFork(false);
     VMATracking.Mutex.unlock();
   }
 
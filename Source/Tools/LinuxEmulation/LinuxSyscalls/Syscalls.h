@@ -199,6 +199,7 @@ public:
   FEX_CONFIG_OPT(SMCChecks, SMCCHECKS);
   FEX_CONFIG_OPT(NeedsSeccomp, NEEDSSECCOMP);
   FEX_CONFIG_OPT(EnableCodeCaching, ENABLECODECACHINGWIP);
+  FEX_CONFIG_OPT(ProfileStats, PROFILESTATS);
 
   uint32_t GetHostKernelVersion() const {
     return HostKernelVersion;
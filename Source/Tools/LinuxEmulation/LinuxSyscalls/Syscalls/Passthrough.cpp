@@ -10,16 +10,47 @@ $end_info$
 #include "LinuxSyscalls/x64/Syscalls.h"
 #include "LinuxSyscalls/x32/Syscalls.h"
 
+#include <FEXCore/Debug/InternalThreadState.h>
 #include <FEXCore/IR/IR.h>
 
 #include <stdint.h>
 #include <sys/epoll.h>
 
 namespace FEX::HLE {
+namespace {
+  // Accumulates the time spent inside of the host syscall in to the thread's syscall stats.
+  // Must be constructed before any register variables are bound.
+  // Stats can't be toggled at runtime, so the untimed passthroughs registered without them don't carry a timer at all.
+  template<bool Timed>
+  class ScopedHostSyscallTimer final {
+  public:
+    ScopedHostSyscallTimer(FEXCore::Core::CpuStateFrame*) {}
+  };
+
+  template<>
+  class ScopedHostSyscallTimer<true> final {
+  public:
+    ScopedHostSyscallTimer(FEXCore::Core::CpuStateFrame* Frame)
+      : ThreadObject {Frame->Thread->ThreadStats ? FEX::HLE::ThreadManager::GetStateObjectFromCPUState(Frame) : nullptr}
+      , Begin {ThreadObject ? FEXCore::SHMStats::GetCycleCounter() : 0} {}
+
+    ~ScopedHostSyscallTimer() {
+      if (ThreadObject) {
+        ThreadObject->SyscallHostTime += FEXCore::SHMStats::GetCycleCounter() - Begin;
+      }
+    }
+
+  private:
+    FEX::HLE::ThreadStateObject* ThreadObject;
+    uint64_t Begin;
+  };
+} // namespace
+
 #ifdef ARCHITECTURE_arm64
-template<int syscall_num>
+template<int syscall_num, bool Timed>
 requires (syscall_num != -1)
 uint64_t SyscallPassthrough0(FEXCore::Core::CpuStateFrame* Frame) {
+  ScopedHostSyscallTimer<Timed> Timer {Frame};
   register uint64_t x0 asm("x0");
   register int x8 asm("x8") = syscall_num;
   __asm volatile(R"(
@@ -31,9 +62,10 @@ uint64_t SyscallPassthrough0(FEXCore::Core::CpuStateFrame* Frame) {
   return x0;
 }
 
-template<int syscall_num>
+template<int syscall_num, bool Timed>
 requires (syscall_num != -1)
 uint64_t SyscallPassthrough1(FEXCore::Core::CpuStateFrame* Frame, uint64_t arg1) {
+  ScopedHostSyscallTimer<Timed> Timer {Frame};
   register uint64_t x0 asm("x0") = arg1;
   register int x8 asm("x8") = syscall_num;
   __asm volatile(R"(
@@ -45,9 +77,10 @@ uint64_t SyscallPassthrough1(FEXCore::Core::CpuStateFrame* Frame, uint64_t arg1)
   return x0;
 }
 
-template<int syscall_num>
+template<int syscall_num, bool Timed>
 requires (syscall_num != -1)
 uint64_t SyscallPassthrough2(FEXCore::Core::CpuStateFrame* Frame, uint64_t arg1, uint64_t arg2) {
+  ScopedHostSyscallTimer<Timed> Timer {Frame};
   register uint64_t x0 asm("x0") = arg1;
   register uint64_t x1 asm("x1") = arg2;
   register int x8 asm("x8") = syscall_num;
@@ -60,9 +93,10 @@ uint64_t SyscallPassthrough2(FEXCore::Core::CpuStateFrame* Frame, uint64_t arg1,
   return x0;
 }
 
-template<int syscall_num>
+template<int syscall_num, bool Timed>
 requires (syscall_num != -1)
 uint64_t SyscallPassthrough3(FEXCore::Core::CpuStateFrame* Frame, uint64_t arg1, uint64_t arg2, uint64_t arg3) {
+  ScopedHostSyscallTimer<Timed> Timer {Frame};
   register uint64_t x0 asm("x0") = arg1;
   register uint64_t x1 asm("x1") = arg2;
   register uint64_t x2 asm("x2") = arg3;
@@ -76,9 +110,10 @@ uint64_t SyscallPassthrough3(FEXCore::Core::CpuStateFrame* Frame, uint64_t arg1,
   return x0;
 }
 
-template<int syscall_num>
+template<int syscall_num, bool Timed>
 requires (syscall_num != -1)
 uint64_t SyscallPassthrough4(FEXCore::Core::CpuStateFrame* Frame, uint64_t arg1, uint64_t arg2, uint64_t arg3, uint64_t arg4) {
+  ScopedHostSyscallTimer<Timed> Timer {Frame};
   register uint64_t x0 asm("x0") = arg1;
   register uint64_t x1 asm("x1") = arg2;
   register uint64_t x2 asm("x2") = arg3;
@@ -93,9 +128,10 @@ uint64_t SyscallPassthrough4(FEXCore::Core::CpuStateFrame* Frame, uint64_t arg1,
   return x0;
 }
 
-template<int syscall_num>
+template<int syscall_num, bool Timed>
 requires (syscall_num != -1)
 uint64_t SyscallPassthrough5(FEXCore::Core::CpuStateFrame* Frame, uint64_t arg1, uint64_t arg2, uint64_t arg3, uint64_t arg4, uint64_t arg5) {
+  ScopedHostSyscallTimer<Timed> Timer {Frame};
   register uint64_t x0 asm("x0") = arg1;
   register uint64_t x1 asm("x1") = arg2;
   register uint64_t x2 asm("x2") = arg3;
@@ -111,10 +147,11 @@ uint64_t SyscallPassthrough5(FEXCore::Core::CpuStateFrame* Frame, uint64_t arg1,
   return x0;
 }
 
-template<int syscall_num>
+template<int syscall_num, bool Timed>
 requires (syscall_num != -1)
 uint64_t SyscallPassthrough6(FEXCore::Core::CpuStateFrame* Frame, uint64_t arg1, uint64_t arg2, uint64_t arg3, uint64_t arg4, uint64_t arg5,
                              uint64_t arg6) {
+  ScopedHostSyscallTimer<Timed> Timer {Frame};
   register uint64_t x0 asm("x0") = arg1;
   register uint64_t x1 asm("x1") = arg2;
   register uint64_t x2 asm("x2") = arg3;
@@ -131,10 +168,11 @@ uint64_t SyscallPassthrough6(FEXCore::Core::CpuStateFrame* Frame, uint64_t arg1,
   return x0;
 }
 
-template<int syscall_num>
+template<int syscall_num, bool Timed>
 requires (syscall_num != -1)
 uint64_t SyscallPassthrough7(FEXCore::Core::CpuStateFrame* Frame, uint64_t arg1, uint64_t arg2, uint64_t arg3, uint64_t arg4, uint64_t arg5,
                              uint64_t arg6, uint64_t arg7) {
+  ScopedHostSyscallTimer<Timed> Timer {Frame};
   register uint64_t x0 asm("x0") = arg1;
   register uint64_t x1 asm("x1") = arg2;
   register uint64_t x2 asm("x2") = arg3;
@@ -152,209 +190,221 @@ uint64_t SyscallPassthrough7(FEXCore::Core::CpuStateFrame* Frame, uint64_t arg1,
   return x0;
 }
 #else
-template<int syscall_num>
+template<int syscall_num, bool Timed>
 requires (syscall_num != -1)
 uint64_t SyscallPassthrough0(FEXCore::Core::CpuStateFrame* Frame) {
+  ScopedHostSyscallTimer<Timed> Timer {Frame};
   uint64_t Result = ::syscall(syscall_num);
   SYSCALL_ERRNO();
 }
 
-template<int syscall_num>
+template<int syscall_num, bool Timed>
 requires (syscall_num != -1)
 uint64_t SyscallPassthrough1(FEXCore::Core::CpuStateFrame* Frame, uint64_t arg1) {
+  ScopedHostSyscallTimer<Timed> Timer {Frame};
   uint64_t Result = ::syscall(syscall_num, arg1);
   SYSCALL_ERRNO();
 }
 
-template<int syscall_num>
+template<int syscall_num, bool Timed>
 requires (syscall_num != -1)
 uint64_t SyscallPassthrough2(FEXCore::Core::CpuStateFrame* Frame, uint64_t arg1, uint64_t arg2) {
+  ScopedHostSyscallTimer<Timed> Timer {Frame};
   uint64_t Result = ::syscall(syscall_num, arg1, arg2);
   SYSCALL_ERRNO();
 }
 
-template<int syscall_num>
+template<int syscall_num, bool Timed>
 requires (syscall_num != -1)
 uint64_t SyscallPassthrough3(FEXCore::Core::CpuStateFrame* Frame, uint64_t arg1, uint64_t arg2, uint64_t arg3) {
+  ScopedHostSyscallTimer<Timed> Timer {Frame};
   uint64_t Result = ::syscall(syscall_num, arg1, arg2, arg3);
   SYSCALL_ERRNO();
 }
 
-template<int syscall_num>
+template<int syscall_num, bool Timed>
 requires (syscall_num != -1)
 uint64_t SyscallPassthrough4(FEXCore::Core::CpuStateFrame* Frame, uint64_t arg1, uint64_t arg2, uint64_t arg3, uint64_t arg4) {
+  ScopedHostSyscallTimer<Timed> Timer {Frame};
   uint64_t Result = ::syscall(syscall_num, arg1, arg2, arg3, arg4);
   SYSCALL_ERRNO();
 }
 
-template<int syscall_num>
+template<int syscall_num, bool Timed>
 requires (syscall_num != -1)
 uint64_t SyscallPassthrough5(FEXCore::Core::CpuStateFrame* Frame, uint64_t arg1, uint64_t arg2, uint64_t arg3, uint64_t arg4, uint64_t arg5) {
+  ScopedHostSyscallTimer<Timed> Timer {Frame};
   uint64_t Result = ::syscall(syscall_num, arg1, arg2, arg3, arg4, arg5);
   SYSCALL_ERRNO();
 }
 
-template<int syscall_num>
+template<int syscall_num, bool Timed>
 requires (syscall_num != -1)
 uint64_t SyscallPassthrough6(FEXCore::Core::CpuStateFrame* Frame, uint64_t arg1, uint64_t arg2, uint64_t arg3, uint64_t arg4, uint64_t arg5,
                              uint64_t arg6) {
+  ScopedHostSyscallTimer<Timed> Timer {Frame};
   uint64_t Result = ::syscall(syscall_num, arg1, arg2, arg3, arg4, arg5, arg6);
   SYSCALL_ERRNO();
 }
 
-template<int syscall_num>
+template<int syscall_num, bool Timed>
 requires (syscall_num != -1)
 uint64_t SyscallPassthrough7(FEXCore::Core::CpuStateFrame* Frame, uint64_t arg1, uint64_t arg2, uint64_t arg3, uint64_t arg4, uint64_t arg5,
                              uint64_t arg6, uint64_t arg7) {
+  ScopedHostSyscallTimer<Timed> Timer {Frame};
   uint64_t Result = ::syscall(syscall_num, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
   SYSCALL_ERRNO();
 }
 #endif
 
+// Picks the passthrough with the host syscall timer only when stats are enabled.
+#define SYSCALL_PASSTHROUGH(NumArgs, name) \
+  (Handler->ProfileStats() ? SyscallPassthrough##NumArgs<SYSCALL_DEF(name), true> : SyscallPassthrough##NumArgs<SYSCALL_DEF(name), false>)
+
 void RegisterCommon(FEX::HLE::SyscallHandler* Handler) {
   using namespace FEXCore::IR;
-  REGISTER_SYSCALL_IMPL(read, SyscallPassthrough3<SYSCALL_DEF(read)>);
-  REGISTER_SYSCALL_IMPL(write, SyscallPassthrough3<SYSCALL_DEF(write)>);
-  REGISTER_SYSCALL_IMPL(lseek, SyscallPassthrough3<SYSCALL_DEF(lseek)>);
-  REGISTER_SYSCALL_IMPL(sched_yield, SyscallPassthrough0<SYSCALL_DEF(sched_yield)>);
-  REGISTER_SYSCALL_IMPL(msync, SyscallPassthrough3<SYSCALL_DEF(msync)>);
-  REGISTER_SYSCALL_IMPL(mincore, SyscallPassthrough3<SYSCALL_DEF(mincore)>);
-  REGISTER_SYSCALL_IMPL(shmget, SyscallPassthrough3<SYSCALL_DEF(shmget)>);
-  REGISTER_SYSCALL_IMPL(shmctl, SyscallPassthrough3<SYSCALL_DEF(shmctl)>);
-  REGISTER_SYSCALL_IMPL(getpid, SyscallPassthrough0<SYSCALL_DEF(getpid)>);
-  REGISTER_SYSCALL_IMPL(socket, SyscallPassthrough3<SYSCALL_DEF(socket)>);
-  REGISTER_SYSCALL_IMPL(connect, SyscallPassthrough3<SYSCALL_DEF(connect)>);
-  REGISTER_SYSCALL_IMPL(sendto, SyscallPassthrough6<SYSCALL_DEF(sendto)>);
-  REGISTER_SYSCALL_IMPL(recvfrom, SyscallPassthrough6<SYSCALL_DEF(recvfrom)>);
-  REGISTER_SYSCALL_IMPL(shutdown, SyscallPassthrough2<SYSCALL_DEF(shutdown)>);
-  REGISTER_SYSCALL_IMPL(bind, SyscallPassthrough3<SYSCALL_DEF(bind)>);
-  REGISTER_SYSCALL_IMPL(listen, SyscallPassthrough2<SYSCALL_DEF(listen)>);
-  REGISTER_SYSCALL_IMPL(getsockname, SyscallPassthrough3<SYSCALL_DEF(getsockname)>);
-  REGISTER_SYSCALL_IMPL(getpeername, SyscallPassthrough3<SYSCALL_DEF(getpeername)>);
-  REGISTER_SYSCALL_IMPL(socketpair, SyscallPassthrough4<SYSCALL_DEF(socketpair)>);
-  REGISTER_SYSCALL_IMPL(kill, SyscallPassthrough2<SYSCALL_DEF(kill)>);
-  REGISTER_SYSCALL_IMPL(semget, SyscallPassthrough3<SYSCALL_DEF(semget)>);
-  REGISTER_SYSCALL_IMPL(msgget, SyscallPassthrough2<SYSCALL_DEF(msgget)>);
-  REGISTER_SYSCALL_IMPL(msgsnd, SyscallPassthrough4<SYSCALL_DEF(msgsnd)>);
-  REGISTER_SYSCALL_IMPL(msgrcv, SyscallPassthrough5<SYSCALL_DEF(msgrcv)>);
-  REGISTER_SYSCALL_IMPL(msgctl, SyscallPassthrough3<SYSCALL_DEF(msgctl)>);
-  REGISTER_SYSCALL_IMPL(flock, SyscallPassthrough2<SYSCALL_DEF(flock)>);
-  REGISTER_SYSCALL_IMPL(fsync, SyscallPassthrough1<SYSCALL_DEF(fsync)>);
-  REGISTER_SYSCALL_IMPL(fdatasync, SyscallPassthrough1<SYSCALL_DEF(fdatasync)>);
-  REGISTER_SYSCALL_IMPL(truncate, SyscallPassthrough2<SYSCALL_DEF(truncate)>);
-  REGISTER_SYSCALL_IMPL(getcwd, SyscallPassthrough2<SYSCALL_DEF(getcwd)>);
-  REGISTER_SYSCALL_IMPL(chdir, SyscallPassthrough1<SYSCALL_DEF(chdir)>);
-  REGISTER_SYSCALL_IMPL(fchdir, SyscallPassthrough1<SYSCALL_DEF(fchdir)>);
-  REGISTER_SYSCALL_IMPL(fchmod, SyscallPassthrough2<SYSCALL_DEF(fchmod)>);
-  REGISTER_SYSCALL_IMPL(fchown, SyscallPassthrough3<SYSCALL_DEF(fchown)>);
-  REGISTER_SYSCALL_IMPL(umask, SyscallPassthrough1<SYSCALL_DEF(umask)>);
-  REGISTER_SYSCALL_IMPL(getuid, SyscallPassthrough0<SYSCALL_DEF(getuid)>);
-  REGISTER_SYSCALL_IMPL(syslog, SyscallPassthrough3<SYSCALL_DEF(syslog)>);
-  REGISTER_SYSCALL_IMPL(getgid, SyscallPassthrough0<SYSCALL_DEF(getgid)>);
-  REGISTER_SYSCALL_IMPL(setuid, SyscallPassthrough1<SYSCALL_DEF(setuid)>);
-  REGISTER_SYSCALL_IMPL(setgid, SyscallPassthrough1<SYSCALL_DEF(setgid)>);
-  REGISTER_SYSCALL_IMPL(geteuid, SyscallPassthrough0<SYSCALL_DEF(geteuid)>);
-  REGISTER_SYSCALL_IMPL(getegid, SyscallPassthrough0<SYSCALL_DEF(getegid)>);
-  REGISTER_SYSCALL_IMPL(setpgid, SyscallPassthrough2<SYSCALL_DEF(setpgid)>);
-  REGISTER_SYSCALL_IMPL(getppid, SyscallPassthrough0<SYSCALL_DEF(getppid)>);
-  REGISTER_SYSCALL_IMPL(setsid, SyscallPassthrough0<SYSCALL_DEF(setsid)>);
-  REGISTER_SYSCALL_IMPL(setreuid, SyscallPassthrough2<SYSCALL_DEF(setreuid)>);
-  REGISTER_SYSCALL_IMPL(setregid, SyscallPassthrough2<SYSCALL_DEF(setregid)>);
-  REGISTER_SYSCALL_IMPL(getgroups, SyscallPassthrough2<SYSCALL_DEF(getgroups)>);
-  REGISTER_SYSCALL_IMPL(setgroups, SyscallPassthrough2<SYSCALL_DEF(setgroups)>);
-  REGISTER_SYSCALL_IMPL(setresuid, SyscallPassthrough3<SYSCALL_DEF(setresuid)>);
-  REGISTER_SYSCALL_IMPL(getresuid, SyscallPassthrough3<SYSCALL_DEF(getresuid)>);
-  REGISTER_SYSCALL_IMPL(setresgid, SyscallPassthrough3<SYSCALL_DEF(setresgid)>);
-  REGISTER_SYSCALL_IMPL(getresgid, SyscallPassthrough3<SYSCALL_DEF(getresgid)>);
-  REGISTER_SYSCALL_IMPL(getpgid, SyscallPassthrough1<SYSCALL_DEF(getpgid)>);
-  REGISTER_SYSCALL_IMPL(setfsuid, SyscallPassthrough1<SYSCALL_DEF(setfsuid)>);
-  REGISTER_SYSCALL_IMPL(setfsgid, SyscallPassthrough1<SYSCALL_DEF(setfsgid)>);
-  REGISTER_SYSCALL_IMPL(getsid, SyscallPassthrough1<SYSCALL_DEF(getsid)>);
-  REGISTER_SYSCALL_IMPL(capget, SyscallPassthrough2<SYSCALL_DEF(capget)>);
-  REGISTER_SYSCALL_IMPL(capset, SyscallPassthrough2<SYSCALL_DEF(capset)>);
-  REGISTER_SYSCALL_IMPL(getpriority, SyscallPassthrough2<SYSCALL_DEF(getpriority)>);
-  REGISTER_SYSCALL_IMPL(setpriority, SyscallPassthrough3<SYSCALL_DEF(setpriority)>);
-  REGISTER_SYSCALL_IMPL(sched_setparam, SyscallPassthrough2<SYSCALL_DEF(sched_setparam)>);
-  REGISTER_SYSCALL_IMPL(sched_getparam, SyscallPassthrough2<SYSCALL_DEF(sched_getparam)>);
-  REGISTER_SYSCALL_IMPL(sched_setscheduler, SyscallPassthrough3<SYSCALL_DEF(sched_setscheduler)>);
-  REGISTER_SYSCALL_IMPL(sched_getscheduler, SyscallPassthrough1<SYSCALL_DEF(sched_getscheduler)>);
-  REGISTER_SYSCALL_IMPL(sched_get_priority_max, SyscallPassthrough1<SYSCALL_DEF(sched_get_priority_max)>);
-  REGISTER_SYSCALL_IMPL(sched_get_priority_min, SyscallPassthrough1<SYSCALL_DEF(sched_get_priority_min)>);
-  REGISTER_SYSCALL_IMPL(mlock, SyscallPassthrough2<SYSCALL_DEF(mlock)>);
-  REGISTER_SYSCALL_IMPL(munlock, SyscallPassthrough2<SYSCALL_DEF(munlock)>);
-  REGISTER_SYSCALL_IMPL(pivot_root, SyscallPassthrough2<SYSCALL_DEF(pivot_root)>);
-  REGISTER_SYSCALL_IMPL(chroot, SyscallPassthrough1<SYSCALL_DEF(chroot)>);
-  REGISTER_SYSCALL_IMPL(sync, SyscallPassthrough0<SYSCALL_DEF(sync)>);
-  REGISTER_SYSCALL_IMPL(acct, SyscallPassthrough1<SYSCALL_DEF(acct)>);
-  REGISTER_SYSCALL_IMPL(mount, SyscallPassthrough5<SYSCALL_DEF(mount)>);
-  REGISTER_SYSCALL_IMPL(umount2, SyscallPassthrough2<SYSCALL_DEF(umount2)>);
-  REGISTER_SYSCALL_IMPL(swapon, SyscallPassthrough2<SYSCALL_DEF(swapon)>);
-  REGISTER_SYSCALL_IMPL(swapoff, SyscallPassthrough1<SYSCALL_DEF(swapoff)>);
-  REGISTER_SYSCALL_IMPL(gettid, SyscallPassthrough0<SYSCALL_DEF(gettid)>);
-  REGISTER_SYSCALL_IMPL(fsetxattr, SyscallPassthrough5<SYSCALL_DEF(fsetxattr)>);
-  REGISTER_SYSCALL_IMPL(fgetxattr, SyscallPassthrough4<SYSCALL_DEF(fgetxattr)>);
-  REGISTER_SYSCALL_IMPL(flistxattr, SyscallPassthrough3<SYSCALL_DEF(flistxattr)>);
-  REGISTER_SYSCALL_IMPL(fremovexattr, SyscallPassthrough2<SYSCALL_DEF(fremovexattr)>);
-  REGISTER_SYSCALL_IMPL(tkill, SyscallPassthrough2<SYSCALL_DEF(tkill)>);
-  REGISTER_SYSCALL_IMPL(sched_setaffinity, SyscallPassthrough3<SYSCALL_DEF(sched_setaffinity)>);
-  REGISTER_SYSCALL_IMPL(sched_getaffinity, SyscallPassthrough3<SYSCALL_DEF(sched_getaffinity)>);
-  REGISTER_SYSCALL_IMPL(io_setup, SyscallPassthrough2<SYSCALL_DEF(io_setup)>);
-  REGISTER_SYSCALL_IMPL(io_destroy, SyscallPassthrough1<SYSCALL_DEF(io_destroy)>);
-  REGISTER_SYSCALL_IMPL(io_submit, SyscallPassthrough3<SYSCALL_DEF(io_submit)>);
-  REGISTER_SYSCALL_IMPL(io_cancel, SyscallPassthrough3<SYSCALL_DEF(io_cancel)>);
-  REGISTER_SYSCALL_IMPL(remap_file_pages, SyscallPassthrough5<SYSCALL_DEF(remap_file_pages)>);
-  REGISTER_SYSCALL_IMPL(timer_getoverrun, SyscallPassthrough1<SYSCALL_DEF(timer_getoverrun)>);
-  REGISTER_SYSCALL_IMPL(timer_delete, SyscallPassthrough1<SYSCALL_DEF(timer_delete)>);
-  REGISTER_SYSCALL_IMPL(tgkill, SyscallPassthrough3<SYSCALL_DEF(tgkill)>);
-  REGISTER_SYSCALL_IMPL(mbind, SyscallPassthrough6<SYSCALL_DEF(mbind)>);
-  REGISTER_SYSCALL_IMPL(set_mempolicy, SyscallPassthrough3<SYSCALL_DEF(set_mempolicy)>);
-  REGISTER_SYSCALL_IMPL(get_mempolicy, SyscallPassthrough5<SYSCALL_DEF(get_mempolicy)>);
-  REGISTER_SYSCALL_IMPL(mq_unlink, SyscallPassthrough1<SYSCALL_DEF(mq_unlink)>);
-  REGISTER_SYSCALL_IMPL(add_key, SyscallPassthrough5<SYSCALL_DEF(add_key)>);
-  REGISTER_SYSCALL_IMPL(request_key, SyscallPassthrough4<SYSCALL_DEF(request_key)>);
-  REGISTER_SYSCALL_IMPL(keyctl, SyscallPassthrough5<SYSCALL_DEF(keyctl)>);
-  REGISTER_SYSCALL_IMPL(ioprio_set, SyscallPassthrough2<SYSCALL_DEF(ioprio_set)>);
-  REGISTER_SYSCALL_IMPL(ioprio_get, SyscallPassthrough3<SYSCALL_DEF(ioprio_get)>);
-  REGISTER_SYSCALL_IMPL(inotify_add_watch, SyscallPassthrough3<SYSCALL_DEF(inotify_add_watch)>);
-  REGISTER_SYSCALL_IMPL(inotify_rm_watch, SyscallPassthrough2<SYSCALL_DEF(inotify_rm_watch)>);
-  REGISTER_SYSCALL_IMPL(migrate_pages, SyscallPassthrough4<SYSCALL_DEF(migrate_pages)>);
-  REGISTER_SYSCALL_IMPL(mkdirat, SyscallPassthrough3<SYSCALL_DEF(mkdirat)>);
-  REGISTER_SYSCALL_IMPL(mknodat, SyscallPassthrough4<SYSCALL_DEF(mknodat)>);
-  REGISTER_SYSCALL_IMPL(fchownat, SyscallPassthrough5<SYSCALL_DEF(fchownat)>);
-  REGISTER_SYSCALL_IMPL(unlinkat, SyscallPassthrough3<SYSCALL_DEF(unlinkat)>);
-  REGISTER_SYSCALL_IMPL(renameat, SyscallPassthrough4<SYSCALL_DEF(renameat)>);
-  REGISTER_SYSCALL_IMPL(linkat, SyscallPassthrough5<SYSCALL_DEF(linkat)>);
-  REGISTER_SYSCALL_IMPL(symlinkat, SyscallPassthrough3<SYSCALL_DEF(symlinkat)>);
-  REGISTER_SYSCALL_IMPL(fchmodat, SyscallPassthrough3<SYSCALL_DEF(fchmodat)>);
-  REGISTER_SYSCALL_IMPL(unshare, SyscallPassthrough1<SYSCALL_DEF(unshare)>);
-  REGISTER_SYSCALL_IMPL(splice, SyscallPassthrough6<SYSCALL_DEF(splice)>);
-  REGISTER_SYSCALL_IMPL(tee, SyscallPassthrough4<SYSCALL_DEF(tee)>);
-  REGISTER_SYSCALL_IMPL(move_pages, SyscallPassthrough6<SYSCALL_DEF(move_pages)>);
-  REGISTER_SYSCALL_IMPL(timerfd_create, SyscallPassthrough2<SYSCALL_DEF(timerfd_create)>);
-  REGISTER_SYSCALL_IMPL(accept4, SyscallPassthrough4<SYSCALL_DEF(accept4)>);
-  REGISTER_SYSCALL_IMPL(eventfd2, SyscallPassthrough2<SYSCALL_DEF(eventfd2)>);
-  REGISTER_SYSCALL_IMPL(epoll_create1, SyscallPassthrough1<SYSCALL_DEF(epoll_create1)>);
-  REGISTER_SYSCALL_IMPL(inotify_init1, SyscallPassthrough1<SYSCALL_DEF(inotify_init1)>);
-  REGISTER_SYSCALL_IMPL(fanotify_init, SyscallPassthrough2<SYSCALL_DEF(fanotify_init)>);
-  REGISTER_SYSCALL_IMPL(fanotify_mark, SyscallPassthrough5<SYSCALL_DEF(fanotify_mark)>);
-  REGISTER_SYSCALL_IMPL(prlimit_64, SyscallPassthrough4<SYSCALL_DEF(prlimit_64)>);
-  REGISTER_SYSCALL_IMPL(name_to_handle_at, SyscallPassthrough5<SYSCALL_DEF(name_to_handle_at)>);
-  REGISTER_SYSCALL_IMPL(open_by_handle_at, SyscallPassthrough3<SYSCALL_DEF(open_by_handle_at)>);
-  REGISTER_SYSCALL_IMPL(syncfs, SyscallPassthrough1<SYSCALL_DEF(syncfs)>);
-  REGISTER_SYSCALL_IMPL(setns, SyscallPassthrough2<SYSCALL_DEF(setns)>);
-  REGISTER_SYSCALL_IMPL(getcpu, SyscallPassthrough3<SYSCALL_DEF(getcpu)>);
-  REGISTER_SYSCALL_IMPL(kcmp, SyscallPassthrough5<SYSCALL_DEF(kcmp)>);
-  REGISTER_SYSCALL_IMPL(sched_setattr, SyscallPassthrough3<SYSCALL_DEF(sched_setattr)>);
-  REGISTER_SYSCALL_IMPL(sched_getattr, SyscallPassthrough4<SYSCALL_DEF(sched_getattr)>);
-  REGISTER_SYSCALL_IMPL(renameat2, SyscallPassthrough5<SYSCALL_DEF(renameat2)>);
-  REGISTER_SYSCALL_IMPL(getrandom, SyscallPassthrough3<SYSCALL_DEF(getrandom)>);
-  REGISTER_SYSCALL_IMPL(memfd_create, SyscallPassthrough2<SYSCALL_DEF(memfd_create)>);
-  REGISTER_SYSCALL_IMPL(membarrier, SyscallPassthrough2<SYSCALL_DEF(membarrier)>);
-  REGISTER_SYSCALL_IMPL(mlock2, SyscallPassthrough3<SYSCALL_DEF(mlock2)>);
-  REGISTER_SYSCALL_IMPL(copy_file_range, SyscallPassthrough6<SYSCALL_DEF(copy_file_range)>);
-  REGISTER_SYSCALL_IMPL(pkey_mprotect, SyscallPassthrough4<SYSCALL_DEF(pkey_mprotect)>);
-  REGISTER_SYSCALL_IMPL(pkey_alloc, SyscallPassthrough2<SYSCALL_DEF(pkey_alloc)>);
-  REGISTER_SYSCALL_IMPL(pkey_free, SyscallPassthrough1<SYSCALL_DEF(pkey_free)>);
+  REGISTER_SYSCALL_IMPL(read, SYSCALL_PASSTHROUGH(3, read));
+  REGISTER_SYSCALL_IMPL(write, SYSCALL_PASSTHROUGH(3, write));
+  REGISTER_SYSCALL_IMPL(lseek, SYSCALL_PASSTHROUGH(3, lseek));
+  REGISTER_SYSCALL_IMPL(sched_yield, SYSCALL_PASSTHROUGH(0, sched_yield));
+  REGISTER_SYSCALL_IMPL(msync, SYSCALL_PASSTHROUGH(3, msync));
+  REGISTER_SYSCALL_IMPL(mincore, SYSCALL_PASSTHROUGH(3, mincore));
+  REGISTER_SYSCALL_IMPL(shmget, SYSCALL_PASSTHROUGH(3, shmget));
+  REGISTER_SYSCALL_IMPL(shmctl, SYSCALL_PASSTHROUGH(3, shmctl));
+  REGISTER_SYSCALL_IMPL(getpid, SYSCALL_PASSTHROUGH(0, getpid));
+  REGISTER_SYSCALL_IMPL(socket, SYSCALL_PASSTHROUGH(3, socket));
+  REGISTER_SYSCALL_IMPL(connect, SYSCALL_PASSTHROUGH(3, connect));
+  REGISTER_SYSCALL_IMPL(sendto, SYSCALL_PASSTHROUGH(6, sendto));
+  REGISTER_SYSCALL_IMPL(recvfrom, SYSCALL_PASSTHROUGH(6, recvfrom));
+  REGISTER_SYSCALL_IMPL(shutdown, SYSCALL_PASSTHROUGH(2, shutdown));
+  REGISTER_SYSCALL_IMPL(bind, SYSCALL_PASSTHROUGH(3, bind));
+  REGISTER_SYSCALL_IMPL(listen, SYSCALL_PASSTHROUGH(2, listen));
+  REGISTER_SYSCALL_IMPL(getsockname, SYSCALL_PASSTHROUGH(3, getsockname));
+  REGISTER_SYSCALL_IMPL(getpeername, SYSCALL_PASSTHROUGH(3, getpeername));
+  REGISTER_SYSCALL_IMPL(socketpair, SYSCALL_PASSTHROUGH(4, socketpair));
+  REGISTER_SYSCALL_IMPL(kill, SYSCALL_PASSTHROUGH(2, kill));
+  REGISTER_SYSCALL_IMPL(semget, SYSCALL_PASSTHROUGH(3, semget));
+  REGISTER_SYSCALL_IMPL(msgget, SYSCALL_PASSTHROUGH(2, msgget));
+  REGISTER_SYSCALL_IMPL(msgsnd, SYSCALL_PASSTHROUGH(4, msgsnd));
+  REGISTER_SYSCALL_IMPL(msgrcv, SYSCALL_PASSTHROUGH(5, msgrcv));
+  REGISTER_SYSCALL_IMPL(msgctl, SYSCALL_PASSTHROUGH(3, msgctl));
+  REGISTER_SYSCALL_IMPL(flock, SYSCALL_PASSTHROUGH(2, flock));
+  REGISTER_SYSCALL_IMPL(fsync, SYSCALL_PASSTHROUGH(1, fsync));
+  REGISTER_SYSCALL_IMPL(fdatasync, SYSCALL_PASSTHROUGH(1, fdatasync));
+  REGISTER_SYSCALL_IMPL(truncate, SYSCALL_PASSTHROUGH(2, truncate));
+  REGISTER_SYSCALL_IMPL(getcwd, SYSCALL_PASSTHROUGH(2, getcwd));
+  REGISTER_SYSCALL_IMPL(chdir, SYSCALL_PASSTHROUGH(1, chdir));
+  REGISTER_SYSCALL_IMPL(fchdir, SYSCALL_PASSTHROUGH(1, fchdir));
+  REGISTER_SYSCALL_IMPL(fchmod, SYSCALL_PASSTHROUGH(2, fchmod));
+  REGISTER_SYSCALL_IMPL(fchown, SYSCALL_PASSTHROUGH(3, fchown));
+  REGISTER_SYSCALL_IMPL(umask, SYSCALL_PASSTHROUGH(1, umask));
+  REGISTER_SYSCALL_IMPL(getuid, SYSCALL_PASSTHROUGH(0, getuid));
+  REGISTER_SYSCALL_IMPL(syslog, SYSCALL_PASSTHROUGH(3, syslog));
+  REGISTER_SYSCALL_IMPL(getgid, SYSCALL_PASSTHROUGH(0, getgid));
+  REGISTER_SYSCALL_IMPL(setuid, SYSCALL_PASSTHROUGH(1, setuid));
+  REGISTER_SYSCALL_IMPL(setgid, SYSCALL_PASSTHROUGH(1, setgid));
+  REGISTER_SYSCALL_IMPL(geteuid, SYSCALL_PASSTHROUGH(0, geteuid));
+  REGISTER_SYSCALL_IMPL(getegid, SYSCALL_PASSTHROUGH(0, getegid));
+  REGISTER_SYSCALL_IMPL(setpgid, SYSCALL_PASSTHROUGH(2, setpgid));
+  REGISTER_SYSCALL_IMPL(getppid, SYSCALL_PASSTHROUGH(0, getppid));
+  REGISTER_SYSCALL_IMPL(setsid, SYSCALL_PASSTHROUGH(0, setsid));
+  REGISTER_SYSCALL_IMPL(setreuid, SYSCALL_PASSTHROUGH(2, setreuid));
+  REGISTER_SYSCALL_IMPL(setregid, SYSCALL_PASSTHROUGH(2, setregid));
+  REGISTER_SYSCALL_IMPL(getgroups, SYSCALL_PASSTHROUGH(2, getgroups));
+  REGISTER_SYSCALL_IMPL(setgroups, SYSCALL_PASSTHROUGH(2, setgroups));
+  REGISTER_SYSCALL_IMPL(setresuid, SYSCALL_PASSTHROUGH(3, setresuid));
+  REGISTER_SYSCALL_IMPL(getresuid, SYSCALL_PASSTHROUGH(3, getresuid));
+  REGISTER_SYSCALL_IMPL(setresgid, SYSCALL_PASSTHROUGH(3, setresgid));
+  REGISTER_SYSCALL_IMPL(getresgid, SYSCALL_PASSTHROUGH(3, getresgid));
+  REGISTER_SYSCALL_IMPL(getpgid, SYSCALL_PASSTHROUGH(1, getpgid));
+  REGISTER_SYSCALL_IMPL(setfsuid, SYSCALL_PASSTHROUGH(1, setfsuid));
+  REGISTER_SYSCALL_IMPL(setfsgid, SYSCALL_PASSTHROUGH(1, setfsgid));
+  REGISTER_SYSCALL_IMPL(getsid, SYSCALL_PASSTHROUGH(1, getsid));
+  REGISTER_SYSCALL_IMPL(capget, SYSCALL_PASSTHROUGH(2, capget));
+  REGISTER_SYSCALL_IMPL(capset, SYSCALL_PASSTHROUGH(2, capset));
+  REGISTER_SYSCALL_IMPL(getpriority, SYSCALL_PASSTHROUGH(2, getpriority));
+  REGISTER_SYSCALL_IMPL(setpriority, SYSCALL_PASSTHROUGH(3, setpriority));
+  REGISTER_SYSCALL_IMPL(sched_setparam, SYSCALL_PASSTHROUGH(2, sched_setparam));
+  REGISTER_SYSCALL_IMPL(sched_getparam, SYSCALL_PASSTHROUGH(2, sched_getparam));
+  REGISTER_SYSCALL_IMPL(sched_setscheduler, SYSCALL_PASSTHROUGH(3, sched_setscheduler));
+  REGISTER_SYSCALL_IMPL(sched_getscheduler, SYSCALL_PASSTHROUGH(1, sched_getscheduler));
+  REGISTER_SYSCALL_IMPL(sched_get_priority_max, SYSCALL_PASSTHROUGH(1, sched_get_priority_max));
+  REGISTER_SYSCALL_IMPL(sched_get_priority_min, SYSCALL_PASSTHROUGH(1, sched_get_priority_min));
+  REGISTER_SYSCALL_IMPL(mlock, SYSCALL_PASSTHROUGH(2, mlock));
+  REGISTER_SYSCALL_IMPL(munlock, SYSCALL_PASSTHROUGH(2, munlock));
+  REGISTER_SYSCALL_IMPL(pivot_root, SYSCALL_PASSTHROUGH(2, pivot_root));
+  REGISTER_SYSCALL_IMPL(chroot, SYSCALL_PASSTHROUGH(1, chroot));
+  REGISTER_SYSCALL_IMPL(sync, SYSCALL_PASSTHROUGH(0, sync));
+  REGISTER_SYSCALL_IMPL(acct, SYSCALL_PASSTHROUGH(1, acct));
+  REGISTER_SYSCALL_IMPL(mount, SYSCALL_PASSTHROUGH(5, mount));
+  REGISTER_SYSCALL_IMPL(umount2, SYSCALL_PASSTHROUGH(2, umount2));
+  REGISTER_SYSCALL_IMPL(swapon, SYSCALL_PASSTHROUGH(2, swapon));
+  REGISTER_SYSCALL_IMPL(swapoff, SYSCALL_PASSTHROUGH(1, swapoff));
+  REGISTER_SYSCALL_IMPL(gettid, SYSCALL_PASSTHROUGH(0, gettid));
+  REGISTER_SYSCALL_IMPL(fsetxattr, SYSCALL_PASSTHROUGH(5, fsetxattr));
+  REGISTER_SYSCALL_IMPL(fgetxattr, SYSCALL_PASSTHROUGH(4, fgetxattr));
+  REGISTER_SYSCALL_IMPL(flistxattr, SYSCALL_PASSTHROUGH(3, flistxattr));
+  REGISTER_SYSCALL_IMPL(fremovexattr, SYSCALL_PASSTHROUGH(2, fremovexattr));
+  REGISTER_SYSCALL_IMPL(tkill, SYSCALL_PASSTHROUGH(2, tkill));
+  REGISTER_SYSCALL_IMPL(sched_setaffinity, SYSCALL_PASSTHROUGH(3, sched_setaffinity));
+  REGISTER_SYSCALL_IMPL(sched_getaffinity, SYSCALL_PASSTHROUGH(3, sched_getaffinity));
+  REGISTER_SYSCALL_IMPL(io_setup, SYSCALL_PASSTHROUGH(2, io_setup));
+  REGISTER_SYSCALL_IMPL(io_destroy, SYSCALL_PASSTHROUGH(1, io_destroy));
+  REGISTER_SYSCALL_IMPL(io_submit, SYSCALL_PASSTHROUGH(3, io_submit));
+  REGISTER_SYSCALL_IMPL(io_cancel, SYSCALL_PASSTHROUGH(3, io_cancel));
+  REGISTER_SYSCALL_IMPL(remap_file_pages, SYSCALL_PASSTHROUGH(5, remap_file_pages));
+  REGISTER_SYSCALL_IMPL(timer_getoverrun, SYSCALL_PASSTHROUGH(1, timer_getoverrun));
+  REGISTER_SYSCALL_IMPL(timer_delete, SYSCALL_PASSTHROUGH(1, timer_delete));
+  REGISTER_SYSCALL_IMPL(tgkill, SYSCALL_PASSTHROUGH(3, tgkill));
+  REGISTER_SYSCALL_IMPL(mbind, SYSCALL_PASSTHROUGH(6, mbind));
+  REGISTER_SYSCALL_IMPL(set_mempolicy, SYSCALL_PASSTHROUGH(3, set_mempolicy));
+  REGISTER_SYSCALL_IMPL(get_mempolicy, SYSCALL_PASSTHROUGH(5, get_mempolicy));
+  REGISTER_SYSCALL_IMPL(mq_unlink, SYSCALL_PASSTHROUGH(1, mq_unlink));
+  REGISTER_SYSCALL_IMPL(add_key, SYSCALL_PASSTHROUGH(5, add_key));
+  REGISTER_SYSCALL_IMPL(request_key, SYSCALL_PASSTHROUGH(4, request_key));
+  REGISTER_SYSCALL_IMPL(keyctl, SYSCALL_PASSTHROUGH(5, keyctl));
+  REGISTER_SYSCALL_IMPL(ioprio_set, SYSCALL_PASSTHROUGH(2, ioprio_set));
+  REGISTER_SYSCALL_IMPL(ioprio_get, SYSCALL_PASSTHROUGH(3, ioprio_get));
+  REGISTER_SYSCALL_IMPL(inotify_add_watch, SYSCALL_PASSTHROUGH(3, inotify_add_watch));
+  REGISTER_SYSCALL_IMPL(inotify_rm_watch, SYSCALL_PASSTHROUGH(2, inotify_rm_watch));
+  REGISTER_SYSCALL_IMPL(migrate_pages, SYSCALL_PASSTHROUGH(4, migrate_pages));
+  REGISTER_SYSCALL_IMPL(mkdirat, SYSCALL_PASSTHROUGH(3, mkdirat));
+  REGISTER_SYSCALL_IMPL(mknodat, SYSCALL_PASSTHROUGH(4, mknodat));
+  REGISTER_SYSCALL_IMPL(fchownat, SYSCALL_PASSTHROUGH(5, fchownat));
+  REGISTER_SYSCALL_IMPL(unlinkat, SYSCALL_PASSTHROUGH(3, unlinkat));
+  REGISTER_SYSCALL_IMPL(renameat, SYSCALL_PASSTHROUGH(4, renameat));
+  REGISTER_SYSCALL_IMPL(linkat, SYSCALL_PASSTHROUGH(5, linkat));
+  REGISTER_SYSCALL_IMPL(symlinkat, SYSCALL_PASSTHROUGH(3, symlinkat));
+  REGISTER_SYSCALL_IMPL(fchmodat, SYSCALL_PASSTHROUGH(3, fchmodat));
+  REGISTER_SYSCALL_IMPL(unshare, SYSCALL_PASSTHROUGH(1, unshare));
+  REGISTER_SYSCALL_IMPL(splice, SYSCALL_PASSTHROUGH(6, splice));
+  REGISTER_SYSCALL_IMPL(tee, SYSCALL_PASSTHROUGH(4, tee));
+  REGISTER_SYSCALL_IMPL(move_pages, SYSCALL_PASSTHROUGH(6, move_pages));
+  REGISTER_SYSCALL_IMPL(timerfd_create, SYSCALL_PASSTHROUGH(2, timerfd_create));
+  REGISTER_SYSCALL_IMPL(accept4, SYSCALL_PASSTHROUGH(4, accept4));
+  REGISTER_SYSCALL_IMPL(eventfd2, SYSCALL_PASSTHROUGH(2, eventfd2));
+  REGISTER_SYSCALL_IMPL(epoll_create1, SYSCALL_PASSTHROUGH(1, epoll_create1));
+  REGISTER_SYSCALL_IMPL(inotify_init1, SYSCALL_PASSTHROUGH(1, inotify_init1));
+  REGISTER_SYSCALL_IMPL(fanotify_init, SYSCALL_PASSTHROUGH(2, fanotify_init));
+  REGISTER_SYSCALL_IMPL(fanotify_mark, SYSCALL_PASSTHROUGH(5, fanotify_mark));
+  REGISTER_SYSCALL_IMPL(prlimit_64, SYSCALL_PASSTHROUGH(4, prlimit_64));
+  REGISTER_SYSCALL_IMPL(name_to_handle_at, SYSCALL_PASSTHROUGH(5, name_to_handle_at));
+  REGISTER_SYSCALL_IMPL(open_by_handle_at, SYSCALL_PASSTHROUGH(3, open_by_handle_at));
+  REGISTER_SYSCALL_IMPL(syncfs, SYSCALL_PASSTHROUGH(1, syncfs));
+  REGISTER_SYSCALL_IMPL(setns, SYSCALL_PASSTHROUGH(2, setns));
+  REGISTER_SYSCALL_IMPL(getcpu, SYSCALL_PASSTHROUGH(3, getcpu));
+  REGISTER_SYSCALL_IMPL(kcmp, SYSCALL_PASSTHROUGH(5, kcmp));
+  REGISTER_SYSCALL_IMPL(sched_setattr, SYSCALL_PASSTHROUGH(3, sched_setattr));
+  REGISTER_SYSCALL_IMPL(sched_getattr, SYSCALL_PASSTHROUGH(4, sched_getattr));
+  REGISTER_SYSCALL_IMPL(renameat2, SYSCALL_PASSTHROUGH(5, renameat2));
+  REGISTER_SYSCALL_IMPL(getrandom, SYSCALL_PASSTHROUGH(3, getrandom));
+  REGISTER_SYSCALL_IMPL(memfd_create, SYSCALL_PASSTHROUGH(2, memfd_create));
+  REGISTER_SYSCALL_IMPL(membarrier, SYSCALL_PASSTHROUGH(2, membarrier));
+  REGISTER_SYSCALL_IMPL(mlock2, SYSCALL_PASSTHROUGH(3, mlock2));
+  REGISTER_SYSCALL_IMPL(copy_file_range, SYSCALL_PASSTHROUGH(6, copy_file_range));
+  REGISTER_SYSCALL_IMPL(pkey_mprotect, SYSCALL_PASSTHROUGH(4, pkey_mprotect));
+  REGISTER_SYSCALL_IMPL(pkey_alloc, SYSCALL_PASSTHROUGH(2, pkey_alloc));
+  REGISTER_SYSCALL_IMPL(pkey_free, SYSCALL_PASSTHROUGH(1, pkey_free));
   // io_uring can't be emulated as it can pass `epoll_event` objects around.
   // These are 12-byte packed structs on x86/x86-64, but on other architectures are 16-byte.
   // This means the `data` member is at offset 4 on x86, but offset 8 on other architectures, corrupting the data.
@@ -363,41 +413,41 @@ void RegisterCommon(FEX::HLE::SyscallHandler* Handler) {
   REGISTER_SYSCALL_IMPL(io_uring_setup, UnimplementedSyscallSafe);
   REGISTER_SYSCALL_IMPL(io_uring_enter, UnimplementedSyscallSafe);
   REGISTER_SYSCALL_IMPL(io_uring_register, UnimplementedSyscallSafe);
-  REGISTER_SYSCALL_IMPL(open_tree, SyscallPassthrough3<SYSCALL_DEF(open_tree)>);
-  REGISTER_SYSCALL_IMPL(move_mount, SyscallPassthrough5<SYSCALL_DEF(move_mount)>);
-  REGISTER_SYSCALL_IMPL(fsopen, SyscallPassthrough3<SYSCALL_DEF(fsopen)>);
-  REGISTER_SYSCALL_IMPL(fsconfig, SyscallPassthrough5<SYSCALL_DEF(fsconfig)>);
-  REGISTER_SYSCALL_IMPL(fsmount, SyscallPassthrough3<SYSCALL_DEF(fsmount)>);
-  REGISTER_SYSCALL_IMPL(fspick, SyscallPassthrough3<SYSCALL_DEF(fspick)>);
-  REGISTER_SYSCALL_IMPL(pidfd_open, SyscallPassthrough2<SYSCALL_DEF(pidfd_open)>);
-  REGISTER_SYSCALL_IMPL(pidfd_getfd, SyscallPassthrough3<SYSCALL_DEF(pidfd_getfd)>);
-  REGISTER_SYSCALL_IMPL(mount_setattr, SyscallPassthrough5<SYSCALL_DEF(mount_setattr)>);
-  REGISTER_SYSCALL_IMPL(quotactl_fd, SyscallPassthrough4<SYSCALL_DEF(quotactl_fd)>);
-  REGISTER_SYSCALL_IMPL(landlock_create_ruleset, SyscallPassthrough3<SYSCALL_DEF(landlock_create_ruleset)>);
-  REGISTER_SYSCALL_IMPL(landlock_add_rule, SyscallPassthrough4<SYSCALL_DEF(landlock_add_rule)>);
-  REGISTER_SYSCALL_IMPL(landlock_restrict_self, SyscallPassthrough2<SYSCALL_DEF(landlock_restrict_self)>);
-  REGISTER_SYSCALL_IMPL(memfd_secret, SyscallPassthrough1<SYSCALL_DEF(memfd_secret)>);
-  REGISTER_SYSCALL_IMPL(process_mrelease, SyscallPassthrough2<SYSCALL_DEF(process_mrelease)>);
+  REGISTER_SYSCALL_IMPL(open_tree, SYSCALL_PASSTHROUGH(3, open_tree));
+  REGISTER_SYSCALL_IMPL(move_mount, SYSCALL_PASSTHROUGH(5, move_mount));
+  REGISTER_SYSCALL_IMPL(fsopen, SYSCALL_PASSTHROUGH(3, fsopen));
+  REGISTER_SYSCALL_IMPL(fsconfig, SYSCALL_PASSTHROUGH(5, fsconfig));
+  REGISTER_SYSCALL_IMPL(fsmount, SYSCALL_PASSTHROUGH(3, fsmount));
+  REGISTER_SYSCALL_IMPL(fspick, SYSCALL_PASSTHROUGH(3, fspick));
+  REGISTER_SYSCALL_IMPL(pidfd_open, SYSCALL_PASSTHROUGH(2, pidfd_open));
+  REGISTER_SYSCALL_IMPL(pidfd_getfd, SYSCALL_PASSTHROUGH(3, pidfd_getfd));
+  REGISTER_SYSCALL_IMPL(mount_setattr, SYSCALL_PASSTHROUGH(5, mount_setattr));
+  REGISTER_SYSCALL_IMPL(quotactl_fd, SYSCALL_PASSTHROUGH(4, quotactl_fd));
+  REGISTER_SYSCALL_IMPL(landlock_create_ruleset, SYSCALL_PASSTHROUGH(3, landlock_create_ruleset));
+  REGISTER_SYSCALL_IMPL(landlock_add_rule, SYSCALL_PASSTHROUGH(4, landlock_add_rule));
+  REGISTER_SYSCALL_IMPL(landlock_restrict_self, SYSCALL_PASSTHROUGH(2, landlock_restrict_self));
+  REGISTER_SYSCALL_IMPL(memfd_secret, SYSCALL_PASSTHROUGH(1, memfd_secret));
+  REGISTER_SYSCALL_IMPL(process_mrelease, SYSCALL_PASSTHROUGH(2, process_mrelease));
   if (Handler->IsHostKernelVersionAtLeast(5, 16, 0)) {
-    REGISTER_SYSCALL_IMPL(futex_waitv, SyscallPassthrough5<SYSCALL_DEF(futex_waitv)>);
+    REGISTER_SYSCALL_IMPL(futex_waitv, SYSCALL_PASSTHROUGH(5, futex_waitv));
   } else {
     REGISTER_SYSCALL_IMPL(futex_waitv, UnimplementedSyscallSafe);
   }
   if (Handler->IsHostKernelVersionAtLeast(5, 17, 0)) {
-    REGISTER_SYSCALL_IMPL(set_mempolicy_home_node, SyscallPassthrough4<SYSCALL_DEF(set_mempolicy_home_node)>);
+    REGISTER_SYSCALL_IMPL(set_mempolicy_home_node, SYSCALL_PASSTHROUGH(4, set_mempolicy_home_node));
   } else {
     REGISTER_SYSCALL_IMPL(set_mempolicy_home_node, UnimplementedSyscallSafe);
   }
 
   if (Handler->IsHostKernelVersionAtLeast(6, 8, 0)) {
-    REGISTER_SYSCALL_IMPL(futex_wake, SyscallPassthrough4<SYSCALL_DEF(futex_wake)>);
-    REGISTER_SYSCALL_IMPL(futex_wait, SyscallPassthrough6<SYSCALL_DEF(futex_wait)>);
-    REGISTER_SYSCALL_IMPL(futex_requeue, SyscallPassthrough4<SYSCALL_DEF(futex_requeue)>);
-    REGISTER_SYSCALL_IMPL(statmount, SyscallPassthrough4<SYSCALL_DEF(statmount)>);
-    REGISTER_SYSCALL_IMPL(listmount, SyscallPassthrough4<SYSCALL_DEF(listmount)>);
-    REGISTER_SYSCALL_IMPL(lsm_get_self_attr, SyscallPassthrough4<SYSCALL_DEF(lsm_get_self_attr)>);
-    REGISTER_SYSCALL_IMPL(lsm_set_self_attr, SyscallPassthrough4<SYSCALL_DEF(lsm_set_self_attr)>);
-    REGISTER_SYSCALL_IMPL(lsm_list_modules, SyscallPassthrough3<SYSCALL_DEF(lsm_list_modules)>);
+    REGISTER_SYSCALL_IMPL(futex_wake, SYSCALL_PASSTHROUGH(4, futex_wake));
+    REGISTER_SYSCALL_IMPL(futex_wait, SYSCALL_PASSTHROUGH(6, futex_wait));
+    REGISTER_SYSCALL_IMPL(futex_requeue, SYSCALL_PASSTHROUGH(4, futex_requeue));
+    REGISTER_SYSCALL_IMPL(statmount, SYSCALL_PASSTHROUGH(4, statmount));
+    REGISTER_SYSCALL_IMPL(listmount, SYSCALL_PASSTHROUGH(4, listmount));
+    REGISTER_SYSCALL_IMPL(lsm_get_self_attr, SYSCALL_PASSTHROUGH(4, lsm_get_self_attr));
+    REGISTER_SYSCALL_IMPL(lsm_set_self_attr, SYSCALL_PASSTHROUGH(4, lsm_set_self_attr));
+    REGISTER_SYSCALL_IMPL(lsm_list_modules, SYSCALL_PASSTHROUGH(3, lsm_list_modules));
   } else {
     REGISTER_SYSCALL_IMPL(futex_wake, UnimplementedSyscallSafe);
     REGISTER_SYSCALL_IMPL(futex_wait, UnimplementedSyscallSafe);
@@ -409,7 +459,7 @@ void RegisterCommon(FEX::HLE::SyscallHandler* Handler) {
     REGISTER_SYSCALL_IMPL(lsm_list_modules, UnimplementedSyscallSafe);
   }
   if (Handler->IsHostKernelVersionAtLeast(6, 10, 0)) {
-    REGISTER_SYSCALL_IMPL(mseal, SyscallPassthrough3<SYSCALL_DEF(mseal)>);
+    REGISTER_SYSCALL_IMPL(mseal, SYSCALL_PASSTHROUGH(3, mseal));
   } else {
     REGISTER_SYSCALL_IMPL(mseal, UnimplementedSyscallSafe);
   }
@@ -419,85 +469,85 @@ namespace x64 {
   void RegisterPassthrough(FEX::HLE::SyscallHandler* Handler) {
     using namespace FEXCore::IR;
     RegisterCommon(Handler);
-    REGISTER_SYSCALL_IMPL_X64(ftruncate, SyscallPassthrough2<SYSCALL_DEF(ftruncate)>);
-    REGISTER_SYSCALL_IMPL_X64(ioctl, SyscallPassthrough3<SYSCALL_DEF(ioctl)>);
-    REGISTER_SYSCALL_IMPL_X64(pread_64, SyscallPassthrough4<SYSCALL_DEF(pread_64)>);
-    REGISTER_SYSCALL_IMPL_X64(pwrite_64, SyscallPassthrough4<SYSCALL_DEF(pwrite_64)>);
-    REGISTER_SYSCALL_IMPL_X64(readv, SyscallPassthrough3<SYSCALL_DEF(readv)>);
-    REGISTER_SYSCALL_IMPL_X64(writev, SyscallPassthrough3<SYSCALL_DEF(writev)>);
-    REGISTER_SYSCALL_IMPL_X64(dup, SyscallPassthrough1<SYSCALL_DEF(dup)>);
-    REGISTER_SYSCALL_IMPL_X64(nanosleep, SyscallPassthrough2<SYSCALL_DEF(nanosleep)>);
-    REGISTER_SYSCALL_IMPL_X64(getitimer, SyscallPassthrough2<SYSCALL_DEF(getitimer)>);
-    REGISTER_SYSCALL_IMPL_X64(setitimer, SyscallPassthrough3<SYSCALL_DEF(setitimer)>);
-    REGISTER_SYSCALL_IMPL_X64(sendfile, SyscallPassthrough4<SYSCALL_DEF(sendfile)>);
-    REGISTER_SYSCALL_IMPL_X64(accept, SyscallPassthrough3<SYSCALL_DEF(accept)>);
-    REGISTER_SYSCALL_IMPL_X64(sendmsg, SyscallPassthrough3<SYSCALL_DEF(sendmsg)>);
-    REGISTER_SYSCALL_IMPL_X64(recvmsg, SyscallPassthrough3<SYSCALL_DEF(recvmsg)>);
-    REGISTER_SYSCALL_IMPL_X64(setsockopt, SyscallPassthrough5<SYSCALL_DEF(setsockopt)>);
-    REGISTER_SYSCALL_IMPL_X64(getsockopt, SyscallPassthrough5<SYSCALL_DEF(getsockopt)>);
-    REGISTER_SYSCALL_IMPL_X64(wait4, SyscallPassthrough4<SYSCALL_DEF(wait4)>);
-    REGISTER_SYSCALL_IMPL_X64(semop, SyscallPassthrough3<SYSCALL_DEF(semop)>);
-    REGISTER_SYSCALL_IMPL_X64(gettimeofday, SyscallPassthrough2<SYSCALL_DEF(gettimeofday)>);
-    REGISTER_SYSCALL_IMPL_X64(getrlimit, SyscallPassthrough2<SYSCALL_DEF(getrlimit)>);
-    REGISTER_SYSCALL_IMPL_X64(getrusage, SyscallPassthrough2<SYSCALL_DEF(getrusage)>);
-    REGISTER_SYSCALL_IMPL_X64(sysinfo, SyscallPassthrough1<SYSCALL_DEF(sysinfo)>);
-    REGISTER_SYSCALL_IMPL_X64(times, SyscallPassthrough1<SYSCALL_DEF(times)>);
-    REGISTER_SYSCALL_IMPL_X64(rt_sigqueueinfo, SyscallPassthrough3<SYSCALL_DEF(rt_sigqueueinfo)>);
-    REGISTER_SYSCALL_IMPL_X64(fstatfs, SyscallPassthrough2<SYSCALL_DEF(fstatfs)>);
-    REGISTER_SYSCALL_IMPL_X64(sched_rr_get_interval, SyscallPassthrough2<SYSCALL_DEF(sched_rr_get_interval)>);
-    REGISTER_SYSCALL_IMPL_X64(mlockall, SyscallPassthrough1<SYSCALL_DEF(mlockall)>);
-    REGISTER_SYSCALL_IMPL_X64(munlockall, SyscallPassthrough0<SYSCALL_DEF(munlockall)>);
-    REGISTER_SYSCALL_IMPL_X64(adjtimex, SyscallPassthrough1<SYSCALL_DEF(adjtimex)>);
-    REGISTER_SYSCALL_IMPL_X64(setrlimit, SyscallPassthrough2<SYSCALL_DEF(setrlimit)>);
-    REGISTER_SYSCALL_IMPL_X64(settimeofday, SyscallPassthrough2<SYSCALL_DEF(settimeofday)>);
-    REGISTER_SYSCALL_IMPL_X64(readahead, SyscallPassthrough3<SYSCALL_DEF(readahead)>);
-    REGISTER_SYSCALL_IMPL_X64(futex, SyscallPassthrough6<SYSCALL_DEF(futex)>);
-    REGISTER_SYSCALL_IMPL_X64(io_getevents, SyscallPassthrough5<SYSCALL_DEF(io_getevents)>);
-    REGISTER_SYSCALL_IMPL_X64(semtimedop, SyscallPassthrough4<SYSCALL_DEF(semtimedop)>);
-    REGISTER_SYSCALL_IMPL_X64(timer_create, SyscallPassthrough3<SYSCALL_DEF(timer_create)>);
-    REGISTER_SYSCALL_IMPL_X64(timer_settime, SyscallPassthrough4<SYSCALL_DEF(timer_settime)>);
-    REGISTER_SYSCALL_IMPL_X64(timer_gettime, SyscallPassthrough2<SYSCALL_DEF(timer_gettime)>);
-    REGISTER_SYSCALL_IMPL_X64(clock_settime, SyscallPassthrough2<SYSCALL_DEF(clock_settime)>);
-    REGISTER_SYSCALL_IMPL_X64(clock_gettime, SyscallPassthrough2<SYSCALL_DEF(clock_gettime)>);
-    REGISTER_SYSCALL_IMPL_X64(clock_getres, SyscallPassthrough2<SYSCALL_DEF(clock_getres)>);
-    REGISTER_SYSCALL_IMPL_X64(clock_nanosleep, SyscallPassthrough4<SYSCALL_DEF(clock_nanosleep)>);
-    REGISTER_SYSCALL_IMPL_X64(mq_open, SyscallPassthrough4<SYSCALL_DEF(mq_open)>);
-    REGISTER_SYSCALL_IMPL_X64(mq_timedsend, SyscallPassthrough5<SYSCALL_DEF(mq_timedsend)>);
-    REGISTER_SYSCALL_IMPL_X64(mq_timedreceive, SyscallPassthrough5<SYSCALL_DEF(mq_timedreceive)>);
-    REGISTER_SYSCALL_IMPL_X64(mq_notify, SyscallPassthrough2<SYSCALL_DEF(mq_notify)>);
-    REGISTER_SYSCALL_IMPL_X64(mq_getsetattr, SyscallPassthrough3<SYSCALL_DEF(mq_getsetattr)>);
-    REGISTER_SYSCALL_IMPL_X64(waitid, SyscallPassthrough5<SYSCALL_DEF(waitid)>);
-    REGISTER_SYSCALL_IMPL_X64(pselect6, SyscallPassthrough6<SYSCALL_DEF(pselect6)>);
-    REGISTER_SYSCALL_IMPL_X64(ppoll, SyscallPassthrough5<SYSCALL_DEF(ppoll)>);
-    REGISTER_SYSCALL_IMPL_X64(set_robust_list, SyscallPassthrough2<SYSCALL_DEF(set_robust_list)>);
-    REGISTER_SYSCALL_IMPL_X64(get_robust_list, SyscallPassthrough3<SYSCALL_DEF(get_robust_list)>);
-    REGISTER_SYSCALL_IMPL_X64(sync_file_range, SyscallPassthrough4<SYSCALL_DEF(sync_file_range)>);
-    REGISTER_SYSCALL_IMPL_X64(vmsplice, SyscallPassthrough4<SYSCALL_DEF(vmsplice)>);
-    REGISTER_SYSCALL_IMPL_X64(utimensat, SyscallPassthrough4<SYSCALL_DEF(utimensat)>);
-    REGISTER_SYSCALL_IMPL_X64(fallocate, SyscallPassthrough4<SYSCALL_DEF(fallocate)>);
-    REGISTER_SYSCALL_IMPL_X64(timerfd_settime, SyscallPassthrough4<SYSCALL_DEF(timerfd_settime)>);
-    REGISTER_SYSCALL_IMPL_X64(timerfd_gettime, SyscallPassthrough2<SYSCALL_DEF(timerfd_gettime)>);
-    REGISTER_SYSCALL_IMPL_X64(preadv, SyscallPassthrough5<SYSCALL_DEF(preadv)>);
-    REGISTER_SYSCALL_IMPL_X64(pwritev, SyscallPassthrough5<SYSCALL_DEF(pwritev)>);
-    REGISTER_SYSCALL_IMPL_X64(rt_tgsigqueueinfo, SyscallPassthrough4<SYSCALL_DEF(rt_tgsigqueueinfo)>);
-    REGISTER_SYSCALL_IMPL_X64(recvmmsg, SyscallPassthrough5<SYSCALL_DEF(recvmmsg)>);
-    REGISTER_SYSCALL_IMPL_X64(clock_adjtime, SyscallPassthrough2<SYSCALL_DEF(clock_adjtime)>);
-    REGISTER_SYSCALL_IMPL_X64(sendmmsg, SyscallPassthrough4<SYSCALL_DEF(sendmmsg)>);
-    REGISTER_SYSCALL_IMPL_X64(process_vm_readv, SyscallPassthrough6<SYSCALL_DEF(process_vm_readv)>);
-    REGISTER_SYSCALL_IMPL_X64(process_vm_writev, SyscallPassthrough6<SYSCALL_DEF(process_vm_writev)>);
-    REGISTER_SYSCALL_IMPL_X64(preadv2, SyscallPassthrough6<SYSCALL_DEF(preadv2)>);
-    REGISTER_SYSCALL_IMPL_X64(pwritev2, SyscallPassthrough6<SYSCALL_DEF(pwritev2)>);
-    REGISTER_SYSCALL_IMPL_X64(io_pgetevents, SyscallPassthrough6<SYSCALL_DEF(io_pgetevents)>);
-    REGISTER_SYSCALL_IMPL_X64(pidfd_send_signal, SyscallPassthrough4<SYSCALL_DEF(pidfd_send_signal)>);
-    REGISTER_SYSCALL_IMPL_X64(process_madvise, SyscallPassthrough5<SYSCALL_DEF(process_madvise)>);
-    REGISTER_SYSCALL_IMPL_X64(fadvise64, SyscallPassthrough4<SYSCALL_DEF(fadvise64)>);
+    REGISTER_SYSCALL_IMPL_X64(ftruncate, SYSCALL_PASSTHROUGH(2, ftruncate));
+    REGISTER_SYSCALL_IMPL_X64(ioctl, SYSCALL_PASSTHROUGH(3, ioctl));
+    REGISTER_SYSCALL_IMPL_X64(pread_64, SYSCALL_PASSTHROUGH(4, pread_64));
+    REGISTER_SYSCALL_IMPL_X64(pwrite_64, SYSCALL_PASSTHROUGH(4, pwrite_64));
+    REGISTER_SYSCALL_IMPL_X64(readv, SYSCALL_PASSTHROUGH(3, readv));
+    REGISTER_SYSCALL_IMPL_X64(writev, SYSCALL_PASSTHROUGH(3, writev));
+    REGISTER_SYSCALL_IMPL_X64(dup, SYSCALL_PASSTHROUGH(1, dup));
+    REGISTER_SYSCALL_IMPL_X64(nanosleep, SYSCALL_PASSTHROUGH(2, nanosleep));
+    REGISTER_SYSCALL_IMPL_X64(getitimer, SYSCALL_PASSTHROUGH(2, getitimer));
+    REGISTER_SYSCALL_IMPL_X64(setitimer, SYSCALL_PASSTHROUGH(3, setitimer));
+    REGISTER_SYSCALL_IMPL_X64(sendfile, SYSCALL_PASSTHROUGH(4, sendfile));
+    REGISTER_SYSCALL_IMPL_X64(accept, SYSCALL_PASSTHROUGH(3, accept));
+    REGISTER_SYSCALL_IMPL_X64(sendmsg, SYSCALL_PASSTHROUGH(3, sendmsg));
+    REGISTER_SYSCALL_IMPL_X64(recvmsg, SYSCALL_PASSTHROUGH(3, recvmsg));
+    REGISTER_SYSCALL_IMPL_X64(setsockopt, SYSCALL_PASSTHROUGH(5, setsockopt));
+    REGISTER_SYSCALL_IMPL_X64(getsockopt, SYSCALL_PASSTHROUGH(5, getsockopt));
+    REGISTER_SYSCALL_IMPL_X64(wait4, SYSCALL_PASSTHROUGH(4, wait4));
+    REGISTER_SYSCALL_IMPL_X64(semop, SYSCALL_PASSTHROUGH(3, semop));
+    REGISTER_SYSCALL_IMPL_X64(gettimeofday, SYSCALL_PASSTHROUGH(2, gettimeofday));
+    REGISTER_SYSCALL_IMPL_X64(getrlimit, SYSCALL_PASSTHROUGH(2, getrlimit));
+    REGISTER_SYSCALL_IMPL_X64(getrusage, SYSCALL_PASSTHROUGH(2, getrusage));
+    REGISTER_SYSCALL_IMPL_X64(sysinfo, SYSCALL_PASSTHROUGH(1, sysinfo));
+    REGISTER_SYSCALL_IMPL_X64(times, SYSCALL_PASSTHROUGH(1, times));
+    REGISTER_SYSCALL_IMPL_X64(rt_sigqueueinfo, SYSCALL_PASSTHROUGH(3, rt_sigqueueinfo));
+    REGISTER_SYSCALL_IMPL_X64(fstatfs, SYSCALL_PASSTHROUGH(2, fstatfs));
+    REGISTER_SYSCALL_IMPL_X64(sched_rr_get_interval, SYSCALL_PASSTHROUGH(2, sched_rr_get_interval));
+    REGISTER_SYSCALL_IMPL_X64(mlockall, SYSCALL_PASSTHROUGH(1, mlockall));
+    REGISTER_SYSCALL_IMPL_X64(munlockall, SYSCALL_PASSTHROUGH(0, munlockall));
+    REGISTER_SYSCALL_IMPL_X64(adjtimex, SYSCALL_PASSTHROUGH(1, adjtimex));
+    REGISTER_SYSCALL_IMPL_X64(setrlimit, SYSCALL_PASSTHROUGH(2, setrlimit));
+    REGISTER_SYSCALL_IMPL_X64(settimeofday, SYSCALL_PASSTHROUGH(2, settimeofday));
+    REGISTER_SYSCALL_IMPL_X64(readahead, SYSCALL_PASSTHROUGH(3, readahead));
+    REGISTER_SYSCALL_IMPL_X64(futex, SYSCALL_PASSTHROUGH(6, futex));
+    REGISTER_SYSCALL_IMPL_X64(io_getevents, SYSCALL_PASSTHROUGH(5, io_getevents));
+    REGISTER_SYSCALL_IMPL_X64(semtimedop, SYSCALL_PASSTHROUGH(4, semtimedop));
+    REGISTER_SYSCALL_IMPL_X64(timer_create, SYSCALL_PASSTHROUGH(3, timer_create));
+    REGISTER_SYSCALL_IMPL_X64(timer_settime, SYSCALL_PASSTHROUGH(4, timer_settime));
+    REGISTER_SYSCALL_IMPL_X64(timer_gettime, SYSCALL_PASSTHROUGH(2, timer_gettime));
+    REGISTER_SYSCALL_IMPL_X64(clock_settime, SYSCALL_PASSTHROUGH(2, clock_settime));
+    REGISTER_SYSCALL_IMPL_X64(clock_gettime, SYSCALL_PASSTHROUGH(2, clock_gettime));
+    REGISTER_SYSCALL_IMPL_X64(clock_getres, SYSCALL_PASSTHROUGH(2, clock_getres));
+    REGISTER_SYSCALL_IMPL_X64(clock_nanosleep, SYSCALL_PASSTHROUGH(4, clock_nanosleep));
+    REGISTER_SYSCALL_IMPL_X64(mq_open, SYSCALL_PASSTHROUGH(4, mq_open));
+    REGISTER_SYSCALL_IMPL_X64(mq_timedsend, SYSCALL_PASSTHROUGH(5, mq_timedsend));
+    REGISTER_SYSCALL_IMPL_X64(mq_timedreceive, SYSCALL_PASSTHROUGH(5, mq_timedreceive));
+    REGISTER_SYSCALL_IMPL_X64(mq_notify, SYSCALL_PASSTHROUGH(2, mq_notify));
+    REGISTER_SYSCALL_IMPL_X64(mq_getsetattr, SYSCALL_PASSTHROUGH(3, mq_getsetattr));
+    REGISTER_SYSCALL_IMPL_X64(waitid, SYSCALL_PASSTHROUGH(5, waitid));
+    REGISTER_SYSCALL_IMPL_X64(pselect6, SYSCALL_PASSTHROUGH(6, pselect6));
+    REGISTER_SYSCALL_IMPL_X64(ppoll, SYSCALL_PASSTHROUGH(5, ppoll));
+    REGISTER_SYSCALL_IMPL_X64(set_robust_list, SYSCALL_PASSTHROUGH(2, set_robust_list));
+    REGISTER_SYSCALL_IMPL_X64(get_robust_list, SYSCALL_PASSTHROUGH(3, get_robust_list));
+    REGISTER_SYSCALL_IMPL_X64(sync_file_range, SYSCALL_PASSTHROUGH(4, sync_file_range));
+    REGISTER_SYSCALL_IMPL_X64(vmsplice, SYSCALL_PASSTHROUGH(4, vmsplice));
+    REGISTER_SYSCALL_IMPL_X64(utimensat, SYSCALL_PASSTHROUGH(4, utimensat));
+    REGISTER_SYSCALL_IMPL_X64(fallocate, SYSCALL_PASSTHROUGH(4, fallocate));
+    REGISTER_SYSCALL_IMPL_X64(timerfd_settime, SYSCALL_PASSTHROUGH(4, timerfd_settime));
+    REGISTER_SYSCALL_IMPL_X64(timerfd_gettime, SYSCALL_PASSTHROUGH(2, timerfd_gettime));
+    REGISTER_SYSCALL_IMPL_X64(preadv, SYSCALL_PASSTHROUGH(5, preadv));
+    REGISTER_SYSCALL_IMPL_X64(pwritev, SYSCALL_PASSTHROUGH(5, pwritev));
+    REGISTER_SYSCALL_IMPL_X64(rt_tgsigqueueinfo, SYSCALL_PASSTHROUGH(4, rt_tgsigqueueinfo));
+    REGISTER_SYSCALL_IMPL_X64(recvmmsg, SYSCALL_PASSTHROUGH(5, recvmmsg));
+    REGISTER_SYSCALL_IMPL_X64(clock_adjtime, SYSCALL_PASSTHROUGH(2, clock_adjtime));
+    REGISTER_SYSCALL_IMPL_X64(sendmmsg, SYSCALL_PASSTHROUGH(4, sendmmsg));
+    REGISTER_SYSCALL_IMPL_X64(process_vm_readv, SYSCALL_PASSTHROUGH(6, process_vm_readv));
+    REGISTER_SYSCALL_IMPL_X64(process_vm_writev, SYSCALL_PASSTHROUGH(6, process_vm_writev));
+    REGISTER_SYSCALL_IMPL_X64(preadv2, SYSCALL_PASSTHROUGH(6, preadv2));
+    REGISTER_SYSCALL_IMPL_X64(pwritev2, SYSCALL_PASSTHROUGH(6, pwritev2));
+    REGISTER_SYSCALL_IMPL_X64(io_pgetevents, SYSCALL_PASSTHROUGH(6, io_pgetevents));
+    REGISTER_SYSCALL_IMPL_X64(pidfd_send_signal, SYSCALL_PASSTHROUGH(4, pidfd_send_signal));
+    REGISTER_SYSCALL_IMPL_X64(process_madvise, SYSCALL_PASSTHROUGH(5, process_madvise));
+    REGISTER_SYSCALL_IMPL_X64(fadvise64, SYSCALL_PASSTHROUGH(4, fadvise64));
     if (Handler->IsHostKernelVersionAtLeast(6, 5, 0)) {
-      REGISTER_SYSCALL_IMPL_X64(cachestat, SyscallPassthrough4<SYSCALL_DEF(cachestat)>);
+      REGISTER_SYSCALL_IMPL_X64(cachestat, SYSCALL_PASSTHROUGH(4, cachestat));
     } else {
       REGISTER_SYSCALL_IMPL_X64(cachestat, UnimplementedSyscallSafe);
     }
     if (Handler->IsHostKernelVersionAtLeast(6, 6, 0)) {
-      REGISTER_SYSCALL_IMPL_X64(fchmodat2, SyscallPassthrough4<SYSCALL_DEF(fchmodat2)>);
+      REGISTER_SYSCALL_IMPL_X64(fchmodat2, SYSCALL_PASSTHROUGH(4, fchmodat2));
     } else {
       REGISTER_SYSCALL_IMPL_X64(fchmodat2, UnimplementedSyscallSafe);
     }
@@ -508,41 +558,41 @@ namespace x32 {
   void RegisterPassthrough(FEX::HLE::SyscallHandler* Handler) {
     using namespace FEXCore::IR;
     RegisterCommon(Handler);
-    REGISTER_SYSCALL_IMPL_X32(getuid32, SyscallPassthrough0<SYSCALL_DEF(getuid)>);
-    REGISTER_SYSCALL_IMPL_X32(getgid32, SyscallPassthrough0<SYSCALL_DEF(getgid)>);
-    REGISTER_SYSCALL_IMPL_X32(geteuid32, SyscallPassthrough0<SYSCALL_DEF(geteuid)>);
-    REGISTER_SYSCALL_IMPL_X32(getegid32, SyscallPassthrough0<SYSCALL_DEF(getegid)>);
-    REGISTER_SYSCALL_IMPL_X32(setreuid32, SyscallPassthrough2<SYSCALL_DEF(setreuid)>);
-    REGISTER_SYSCALL_IMPL_X32(setregid32, SyscallPassthrough2<SYSCALL_DEF(setregid)>);
-    REGISTER_SYSCALL_IMPL_X32(getgroups32, SyscallPassthrough2<SYSCALL_DEF(getgroups)>);
-    REGISTER_SYSCALL_IMPL_X32(setgroups32, SyscallPassthrough2<SYSCALL_DEF(setgroups)>);
-    REGISTER_SYSCALL_IMPL_X32(fchown32, SyscallPassthrough3<SYSCALL_DEF(fchown)>);
-    REGISTER_SYSCALL_IMPL_X32(setresuid32, SyscallPassthrough3<SYSCALL_DEF(setresuid)>);
-    REGISTER_SYSCALL_IMPL_X32(getresuid32, SyscallPassthrough3<SYSCALL_DEF(getresuid)>);
-    REGISTER_SYSCALL_IMPL_X32(setresgid32, SyscallPassthrough3<SYSCALL_DEF(setresgid)>);
-    REGISTER_SYSCALL_IMPL_X32(getresgid32, SyscallPassthrough3<SYSCALL_DEF(getresgid)>);
-    REGISTER_SYSCALL_IMPL_X32(setuid32, SyscallPassthrough1<SYSCALL_DEF(setuid)>);
-    REGISTER_SYSCALL_IMPL_X32(setgid32, SyscallPassthrough1<SYSCALL_DEF(setgid)>);
-    REGISTER_SYSCALL_IMPL_X32(setfsuid32, SyscallPassthrough1<SYSCALL_DEF(setfsuid)>);
-    REGISTER_SYSCALL_IMPL_X32(setfsgid32, SyscallPassthrough1<SYSCALL_DEF(setfsgid)>);
-    REGISTER_SYSCALL_IMPL_X32(sendfile64, SyscallPassthrough4<SYSCALL_DEF(sendfile)>);
-    REGISTER_SYSCALL_IMPL_X32(clock_gettime64, SyscallPassthrough2<SYSCALL_DEF(clock_gettime)>);
-    REGISTER_SYSCALL_IMPL_X32(clock_settime64, SyscallPassthrough2<SYSCALL_DEF(clock_settime)>);
-    REGISTER_SYSCALL_IMPL_X32(clock_adjtime64, SyscallPassthrough2<SYSCALL_DEF(clock_adjtime)>);
-    REGISTER_SYSCALL_IMPL_X32(clock_getres_time64, SyscallPassthrough2<SYSCALL_DEF(clock_getres)>);
-    REGISTER_SYSCALL_IMPL_X32(clock_nanosleep_time64, SyscallPassthrough4<SYSCALL_DEF(clock_nanosleep)>);
-    REGISTER_SYSCALL_IMPL_X32(timer_gettime64, SyscallPassthrough2<SYSCALL_DEF(timer_gettime)>);
-    REGISTER_SYSCALL_IMPL_X32(timer_settime64, SyscallPassthrough4<SYSCALL_DEF(timer_settime)>);
-    REGISTER_SYSCALL_IMPL_X32(timerfd_gettime64, SyscallPassthrough2<SYSCALL_DEF(timerfd_gettime)>);
-    REGISTER_SYSCALL_IMPL_X32(timerfd_settime64, SyscallPassthrough4<SYSCALL_DEF(timerfd_settime)>);
-    REGISTER_SYSCALL_IMPL_X32(utimensat_time64, SyscallPassthrough4<SYSCALL_DEF(utimensat)>);
-    REGISTER_SYSCALL_IMPL_X32(ppoll_time64, SyscallPassthrough5<SYSCALL_DEF(ppoll)>);
-    REGISTER_SYSCALL_IMPL_X32(io_pgetevents_time64, SyscallPassthrough6<SYSCALL_DEF(io_pgetevents)>);
-    REGISTER_SYSCALL_IMPL_X32(mq_timedsend_time64, SyscallPassthrough5<SYSCALL_DEF(mq_timedsend)>);
-    REGISTER_SYSCALL_IMPL_X32(mq_timedreceive_time64, SyscallPassthrough5<SYSCALL_DEF(mq_timedreceive)>);
-    REGISTER_SYSCALL_IMPL_X32(semtimedop_time64, SyscallPassthrough4<SYSCALL_DEF(semtimedop)>);
-    REGISTER_SYSCALL_IMPL_X32(futex_time64, SyscallPassthrough6<SYSCALL_DEF(futex)>);
-    REGISTER_SYSCALL_IMPL_X32(sched_rr_get_interval_time64, SyscallPassthrough2<SYSCALL_DEF(sched_rr_get_interval)>);
+    REGISTER_SYSCALL_IMPL_X32(getuid32, SYSCALL_PASSTHROUGH(0, getuid));
+    REGISTER_SYSCALL_IMPL_X32(getgid32, SYSCALL_PASSTHROUGH(0, getgid));
+    REGISTER_SYSCALL_IMPL_X32(geteuid32, SYSCALL_PASSTHROUGH(0, geteuid));
+    REGISTER_SYSCALL_IMPL_X32(getegid32, SYSCALL_PASSTHROUGH(0, getegid));
+    REGISTER_SYSCALL_IMPL_X32(setreuid32, SYSCALL_PASSTHROUGH(2, setreuid));
+    REGISTER_SYSCALL_IMPL_X32(setregid32, SYSCALL_PASSTHROUGH(2, setregid));
+    REGISTER_SYSCALL_IMPL_X32(getgroups32, SYSCALL_PASSTHROUGH(2, getgroups));
+    REGISTER_SYSCALL_IMPL_X32(setgroups32, SYSCALL_PASSTHROUGH(2, setgroups));
+    REGISTER_SYSCALL_IMPL_X32(fchown32, SYSCALL_PASSTHROUGH(3, fchown));
+    REGISTER_SYSCALL_IMPL_X32(setresuid32, SYSCALL_PASSTHROUGH(3, setresuid));
+    REGISTER_SYSCALL_IMPL_X32(getresuid32, SYSCALL_PASSTHROUGH(3, getresuid));
+    REGISTER_SYSCALL_IMPL_X32(setresgid32, SYSCALL_PASSTHROUGH(3, setresgid));
+    REGISTER_SYSCALL_IMPL_X32(getresgid32, SYSCALL_PASSTHROUGH(3, getresgid));
+    REGISTER_SYSCALL_IMPL_X32(setuid32, SYSCALL_PASSTHROUGH(1, setuid));
+    REGISTER_SYSCALL_IMPL_X32(setgid32, SYSCALL_PASSTHROUGH(1, setgid));
+    REGISTER_SYSCALL_IMPL_X32(setfsuid32, SYSCALL_PASSTHROUGH(1, setfsuid));
+    REGISTER_SYSCALL_IMPL_X32(setfsgid32, SYSCALL_PASSTHROUGH(1, setfsgid));
+    REGISTER_SYSCALL_IMPL_X32(sendfile64, SYSCALL_PASSTHROUGH(4, sendfile));
+    REGISTER_SYSCALL_IMPL_X32(clock_gettime64, SYSCALL_PASSTHROUGH(2, clock_gettime));
+    REGISTER_SYSCALL_IMPL_X32(clock_settime64, SYSCALL_PASSTHROUGH(2, clock_settime));
+    REGISTER_SYSCALL_IMPL_X32(clock_adjtime64, SYSCALL_PASSTHROUGH(2, clock_adjtime));
+    REGISTER_SYSCALL_IMPL_X32(clock_getres_time64, SYSCALL_PASSTHROUGH(2, clock_getres));
+    REGISTER_SYSCALL_IMPL_X32(clock_nanosleep_time64, SYSCALL_PASSTHROUGH(4, clock_nanosleep));
+    REGISTER_SYSCALL_IMPL_X32(timer_gettime64, SYSCALL_PASSTHROUGH(2, timer_gettime));
+    REGISTER_SYSCALL_IMPL_X32(timer_settime64, SYSCALL_PASSTHROUGH(4, timer_settime));
+    REGISTER_SYSCALL_IMPL_X32(timerfd_gettime64, SYSCALL_PASSTHROUGH(2, timerfd_gettime));
+    REGISTER_SYSCALL_IMPL_X32(timerfd_settime64, SYSCALL_PASSTHROUGH(4, timerfd_settime));
+    REGISTER_SYSCALL_IMPL_X32(utimensat_time64, SYSCALL_PASSTHROUGH(4, utimensat));
+    REGISTER_SYSCALL_IMPL_X32(ppoll_time64, SYSCALL_PASSTHROUGH(5, ppoll));
+    REGISTER_SYSCALL_IMPL_X32(io_pgetevents_time64, SYSCALL_PASSTHROUGH(6, io_pgetevents));
+    REGISTER_SYSCALL_IMPL_X32(mq_timedsend_time64, SYSCALL_PASSTHROUGH(5, mq_timedsend));
+    REGISTER_SYSCALL_IMPL_X32(mq_timedreceive_time64, SYSCALL_PASSTHROUGH(5, mq_timedreceive));
+    REGISTER_SYSCALL_IMPL_X32(semtimedop_time64, SYSCALL_PASSTHROUGH(4, semtimedop));
+    REGISTER_SYSCALL_IMPL_X32(futex_time64, SYSCALL_PASSTHROUGH(6, futex));
+    REGISTER_SYSCALL_IMPL_X32(sched_rr_get_interval_time64, SYSCALL_PASSTHROUGH(2, sched_rr_get_interval));
   }
 } // namespace x32
 } // namespace FEX::HLE
@@ -573,6 +573,8 @@ void RegisterThread(FEX::HLE::SyscallHandler* Handler) {
 
     // Save telemetry if we're exiting.
     FEX::HLE::_SyscallHandler->GetSignalDelegator()->SaveTelemetry();
+    FEX::HLE::_SyscallHandler->GetSignalDelegator()->SaveGuestProfile(Frame->Thread);
+    Frame->Thread->CTX->WriteBlockExecutionCounts(Frame->Thread);
     FEX::HLE::_SyscallHandler->TM.CleanupForExit();
 
     syscall(SYSCALL_DEF(exit_group), status);
@@ -42,17 +42,34 @@ bool SyscallHandler::HandleSegfault(FEXCore::Core::InternalThreadState* Thread,
     return true;
   }
 
+  auto VMATracking = &_SyscallHandler->VMATracking;
+
+  // FEX never protected this page, so the fault belongs to the guest.
+  // Guest GCs that use mprotect for write barriers fault here constantly, forward those without taking the lock.
+  if (!VMATracking->ProtectedPages.MightBeProtected(FaultAddress)) {
+    return false;
+  }
+
+  // Guests that use guard pages fault on the same non-writable mapping repeatedly, reject those without taking the lock.
+  auto& FaultSnapshot = ThreadObject->FaultVMASnapshot;
+  if (VMATracking->IsSnapshotValid(FaultSnapshot, FaultAddress) && !FaultSnapshot.Prot.Writable) {
+    return false;
+  }
+
   {
     // Can't use the deferred signal lock in the SIGSEGV handler.
-    auto lk = FEXCore::MaskSignalsAndLockMutex<std::shared_lock>(_SyscallHandler->VMATracking.Mutex);
-
-    auto VMATracking = &_SyscallHandler->VMATracking;
+    auto lk = FEXCore::MaskSignalsAndLockMutex<std::shared_lock>(VMATracking->Mutex);
 
     // If the write spans two pages, they will be flushed one at a time (generating two faults)
     auto Entry = VMATracking->FindVMAEntry(FaultAddress);
 
     // If an untracked address, or the mapping wasn't writable, it can't be handled here
-    if (Entry == VMATracking->VMAs.end() || !Entry->second.Prot.Writable) {
+    if (Entry == VMATracking->VMAs.end()) {
+      return false;
+    }
+
+    FaultSnapshot = VMATracking->TakeSnapshot(Entry);
+    if (!Entry->second.Prot.Writable) {
       return false;
     }
 
@@ -154,12 +171,15 @@ void SyscallHandler::MarkGuestExecutableRange(FEXCore::Core::InternalThreadState
               const auto MirroredBase = std::max(VMAOffsetBase, OffsetBase);
               const auto MirroredSize = std::min(OffsetTop, VMAOffsetTop) - MirroredBase;
 
+              VMATracking.ProtectedPages.Mark(MirroredBase - VMAOffsetBase + VMABase, MirroredSize);
               auto rv = mprotect((void*)(MirroredBase - VMAOffsetBase + VMABase), MirroredSize, PROT_READ);
               LogMan::Throw::AFmt(rv == 0, "mprotect({}, {}) failed", MirroredBase, MirroredSize);
             }
           } while ((VMA = VMA->ResourceNextVMA));
 
         } else if (Mapping->second.Prot.Writable) {
+          // Must be marked before the protection is visible to other threads.
+          VMATracking.ProtectedPages.Mark(ProtectBase, ProtectSize);
           int rv = mprotect((void*)ProtectBase, ProtectSize, PROT_READ);
 
           LogMan::Throw::AFmt(rv == 0, "mprotect({}, {}) failed", ProtectBase, ProtectSize);
@@ -191,15 +211,24 @@ SyscallHandler::LookupExecutableFileSection(FEXCore::Core::InternalThreadState*
 }
 
 FEXCore::HLE::ExecutableRangeInfo SyscallHandler::QueryGuestExecutableRange(FEXCore::Core::InternalThreadState* Thread, uint64_t Address) {
-  auto lk = FEXCore::GuardSignalDeferringSection<std::shared_lock>(VMATracking.Mutex, Thread);
   auto ThreadObject = FEX::HLE::ThreadManager::GetStateObjectFromFEXCoreThread(Thread);
 
-  auto Entry = VMATracking.FindVMAEntry(Address);
-  if (Entry == VMATracking.VMAs.end() ||
-      (!Entry->second.Prot.Executable && (!(ThreadObject->persona & READ_IMPLIES_EXEC) || !Entry->second.Prot.Readable))) {
+  // Blocks are usually compiled from the same mapping back to back, only take the lock when the snapshot is stale.
+  auto& Snapshot = ThreadObject->CodeVMASnapshot;
+  if (!VMATracking.IsSnapshotValid(Snapshot, Address)) {
+    auto lk = FEXCore::GuardSignalDeferringSection<std::shared_lock>(VMATracking.Mutex, Thread);
+
+    auto Entry = VMATracking.FindVMAEntry(Address);
+    if (Entry == VMATracking.VMAs.end()) {
+      return {0, 0, false};
+    }
+    Snapshot = VMATracking.TakeSnapshot(Entry);
+  }
+
+  if (!Snapshot.Prot.Executable && (!(ThreadObject->persona & READ_IMPLIES_EXEC) || !Snapshot.Prot.Readable)) {
     return {0, 0, false};
   }
-  return {Entry->first, Entry->second.Length, Entry->second.Prot.Writable};
+  return {Snapshot.Base, Snapshot.Length, Snapshot.Prot.Writable};
 }
 
 static fextl::vector<Elf64_Phdr> ReadELFHeaders(int FD, std::span<std::byte> HeaderData = {}) {
@@ -333,6 +362,7 @@ uint64_t SyscallHandler::GuestMremap(bool Is64Bit, FEXCore::Core::InternalThread
 
   {
     auto lk = FEXCore::GuardSignalDeferringSection(VMATracking.Mutex, Thread);
+    FEX::ProtectedPageMap::RemapGuard RemapGuard {VMATracking.ProtectedPages};
     if (Is64Bit) {
       Result = reinterpret_cast<uint64_t>(::mremap(old_address, old_size, new_size, flags, new_address));
       if (Result == -1) {
@@ -601,6 +631,9 @@ void SyscallHandler::TrackMremap(FEXCore::Core::InternalThreadState* Thread, uin
 
   LOGMAN_THROW_A_FMT(OldVMA != VMATracking.VMAs.end(), "VMA Tracking corruption");
 
+  // The kernel carries the protection over to the new range, so FEX's write protection moves along with it.
+  const bool WasProtected = VMATracking.ProtectedPages.IsAnyMarked(OldAddress, OldSize ?: NewSize);
+
   if (OldSize == 0) {
     // Mirror existing mapping
     // must be a shared mapping
@@ -620,6 +653,10 @@ void SyscallHandler::TrackMremap(FEXCore::Core::InternalThreadState* Thread, uin
     // Make anonymous mapping
     VMATracking.TrackVMARange(CTX, OldResource, NewAddress, OldOffset, NewSize, OldFlags, OldProt);
   }
+
+  if (WasProtected) {
+    VMATracking.ProtectedPages.Mark(NewAddress, NewSize);
+  }
 }
 
 void SyscallHandler::TrackShmat(FEXCore::Core::InternalThreadState* Thread, int shmid, uint64_t shmaddr, int shmflg, uint64_t Length) {
@@ -8,6 +8,7 @@ $end_info$
 */
 
 #include "LinuxSyscalls/Syscalls.h"
+
 #include <sys/shm.h>
 
 namespace FEX::HLE::VMATracking {
@@ -168,6 +169,7 @@ VMATracking::VMACIterator VMATracking::FindVMAEntry(uint64_t GuestAddr) const {
 void VMATracking::TrackVMARange(FEXCore::Context::Context* CTX, MappedResource* MappedResource, uintptr_t Base, uintptr_t Offset,
                                 uintptr_t Length, VMAFlags Flags, VMAProt Prot) {
   Mutex.check_lock_owned_by_self_as_write();
+  Generation.fetch_add(1, std::memory_order_relaxed);
 
   DeleteVMARange(CTX, Base, Length, MappedResource);
 
@@ -197,6 +199,10 @@ void VMATracking::TrackVMARange(FEXCore::Context::Context* CTX, MappedResource*
 // freeing their associated MappedResource unless it is equal to PreservedMappedResource
 void VMATracking::DeleteVMARange(FEXCore::Context::Context* CTX, uintptr_t Base, uintptr_t Length, MappedResource* PreservedMappedResource) {
   Mutex.check_lock_owned_by_self_as_write();
+  Generation.fetch_add(1, std::memory_order_relaxed);
+
+  // The range has been unmapped or replaced, so none of its pages are protected anymore.
+  ProtectedPages.Clear(Base, Length);
 
   const auto Top = Base + Length;
 
@@ -280,6 +286,7 @@ void VMATracking::DeleteVMARange(FEXCore::Context::Context* CTX, uintptr_t Base,
 // Change flags of mappings in a range and split the mappings if needed
 void VMATracking::ChangeProtectionFlags(uintptr_t Base, uintptr_t Length, VMAProt NewProt) {
   Mutex.check_lock_owned_by_self_as_write();
+  Generation.fetch_add(1, std::memory_order_relaxed);
 
   // This needs to handle multiple split-merge strategies:
   // 1) Exact overlap - No Split, no Merge. Only protection tracking changes.
@@ -511,6 +518,8 @@ void VMATracking::ChangeProtectionFlags(uintptr_t Base, uintptr_t Length, VMAPro
 
 // This matches the peculiarities algorithm used in linux ksys_shmdt (linux kernel 5.16, ipc/shm.c)
 uintptr_t VMATracking::DeleteSHMRegion(FEXCore::Context::Context* CTX, uintptr_t Base) {
+  Mutex.check_lock_owned_by_self_as_write();
+  Generation.fetch_add(1, std::memory_order_relaxed);
 
   // Find first VMA at or after Base
   // Iterate until first SHM VMA, with matching offset, get length
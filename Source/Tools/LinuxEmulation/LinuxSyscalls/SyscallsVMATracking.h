@@ -1,15 +1,24 @@
 // SPDX-License-Identifier: MIT
 #pragma once
 
+#include <atomic>
 #include <cstdint>
 #include <tuple>
 
+#include <FEXCore/Core/CodeCache.h>
 #include <FEXCore/fextl/map.h>
 #include <FEXCore/fextl/memory.h>
+#include <FEXCore/fextl/vector.h>
 #include <FEXCore/Utils/SignalScopeGuards.h>
 
 #include <elf.h>
 
+#include "Common/ProtectedPageMap.h"
+
+namespace FEXCore::Context {
+class Context;
+}
+
 namespace FEX::HLE::VMATracking {
 ///// VMA (Virtual Memory Area) tracking /////
 
@@ -85,10 +94,25 @@ struct VMAEntry {
   VMAProt Prot;
 };
 
+// Copy of a single VMA for lookups that skip the Mutex.
+// Only valid while the VMATracking generation it was taken at is current.
+struct VMASnapshot {
+  uint64_t Generation {~0ULL};
+  uint64_t Base {};
+  uint64_t Length {};
+  VMAProt Prot {};
+};
+
 struct VMATracking {
   // Held while reading/writing this struct
   FEXCore::ForkableSharedMutex Mutex;
 
+  // Pages that MarkGuestExecutableRange protected.
+  ProtectedPageMap ProtectedPages;
+
+  // Bumped by every modification to the tracked ranges, before the modification is made.
+  std::atomic<uint64_t> Generation {};
+
   // Memory ranges indexed by page aligned starting address
   fextl::map<uint64_t, VMAEntry> VMAs;
 
@@ -99,6 +123,24 @@ struct VMATracking {
   // - Mutex must be at least shared_locked before calling
   VMACIterator FindVMAEntry(uint64_t GuestAddr) const;
 
+  // Returns true if `Snapshot` covers GuestAddr and no VMA has changed since it was taken.
+  // Lets hot lookups reuse a per-thread snapshot instead of contending with mmap/mprotect heavy threads.
+  // - Mutex doesn't need to be held
+  bool IsSnapshotValid(const VMASnapshot& Snapshot, uint64_t GuestAddr) const {
+    return Snapshot.Generation == Generation.load(std::memory_order_acquire) && (GuestAddr - Snapshot.Base) < Snapshot.Length;
+  }
+
+  // Takes a snapshot of the VMA entry.
+  // - Mutex must be at least shared_locked before calling
+  VMASnapshot TakeSnapshot(VMACIterator Entry) const {
+    return VMASnapshot {
+      .Generation = Generation.load(std::memory_order_relaxed),
+      .Base = Entry->first,
+      .Length = Entry->second.Length,
+      .Prot = Entry->second.Prot,
+    };
+  }
+
   // Adds a new VMA Range to be tracked, along with a `MappedResource` associated with that VMA range.
   // Primarily matches `mmap` semantics, but also used by `mremap`, and `shmat`, as they all can add new VMA ranges to be tracked.
   // - Mutex must be unique_locked before calling
@@ -5,9 +5,11 @@
 #include "LinuxSyscalls/Syscalls.h"
 #include "LinuxSyscalls/SignalDelegator.h"
 #include "LinuxSyscalls/Seccomp/SeccompEmulator.h"
+#include "Thunks.h"
 
 #include <FEXHeaderUtils/Syscalls.h>
 #include <FEXCore/Utils/Allocator.h>
+#include <FEXCore/Utils/MathUtils.h>
 #include <FEXCore/Utils/Profiler.h>
 #include <FEXCore/fextl/fmt.h>
 
@@ -22,6 +24,121 @@ namespace FEX::HLE {
 ThreadManager::StatAlloc::StatAlloc() {
   Initialize();
   SaveHeader(Is64BitMode() ? FEXCore::SHMStats::AppType::LINUX_64 : FEXCore::SHMStats::AppType::LINUX_32);
+  InitializeSyscallStats();
+  InitializeThunkStats();
+}
+
+void ThreadManager::StatAlloc::InitializeSyscallStats() {
+  if (!ProfileStats()) {
+    return;
+  }
+
+  int fd = shm_open(fextl::fmt::format("fex-{}-syscalls", ::getpid()).c_str(), O_CREAT | O_TRUNC | O_RDWR, USER_PERMS);
+  if (fd == -1) {
+    return;
+  }
+
+  // The syscall table never grows, so this region is sized once up front.
+  const uint32_t Syscalls = std::max<uint32_t>(FEX::HLE::x64::SYSCALL_x64_MAX, FEX::HLE::x32::SYSCALL_x86_MAX);
+  const size_t Size = FEXCore::AlignUp(sizeof(FEXCore::SHMStats::SyscallStatsHeader) + Syscalls * sizeof(FEXCore::SHMStats::SyscallStats),
+                                       FEXCore::Utils::FEX_PAGE_SIZE);
+
+  if (ftruncate(fd, Size) == -1) {
+    LogMan::Msg::EFmt("[StatAlloc] syscall ftruncate failed");
+    close(fd);
+    return;
+  }
+
+  auto Ptr = FEXCore::Allocator::mmap(nullptr, Size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+
+  if (Ptr == MAP_FAILED) {
+    LogMan::Msg::EFmt("[StatAlloc] syscall mmap shm failed");
+    return;
+  }
+
+  SyscallBase = Ptr;
+  SyscallRegionSize = Size;
+  NumSyscalls = Syscalls;
+  SyscallStats = reinterpret_cast<FEXCore::SHMStats::SyscallStats*>(reinterpret_cast<uint8_t*>(Ptr) +
+                                                                    sizeof(FEXCore::SHMStats::SyscallStatsHeader));
+
+  auto SyscallHead = reinterpret_cast<FEXCore::SHMStats::SyscallStatsHeader*>(Ptr);
+  SyscallHead->app_type = Is64BitMode() ? FEXCore::SHMStats::AppType::LINUX_64 : FEXCore::SHMStats::AppType::LINUX_32;
+  SyscallHead->SyscallStatsSize = sizeof(FEXCore::SHMStats::SyscallStats);
+  SyscallHead->NumSyscalls = Syscalls;
+  SyscallHead->CycleCounterFrequency = FEXCore::SHMStats::GetCycleCounterFrequency();
+  SyscallHead->NumLatencyBuckets = FEXCore::SHMStats::SYSCALL_LATENCY_BUCKETS;
+
+  // Version is written last so readers never observe a partially initialized header.
+  store_memory_barrier();
+  SyscallHead->Version = FEXCore::SHMStats::SYSCALL_STATS_VERSION;
+}
+
+void ThreadManager::StatAlloc::ReleaseSyscallStats() {
+  if (SyscallBase) {
+    FEXCore::Allocator::munmap(SyscallBase, SyscallRegionSize);
+  }
+
+  SyscallBase = nullptr;
+  SyscallRegionSize = 0;
+  SyscallStats = nullptr;
+  NumSyscalls = 0;
+}
+
+void ThreadManager::StatAlloc::InitializeThunkStats() {
+  if (!ProfileStats()) {
+    return;
+  }
+
+  int fd = shm_open(fextl::fmt::format("fex-{}-thunks", ::getpid()).c_str(), O_CREAT | O_TRUNC | O_RDWR, USER_PERMS);
+  if (fd == -1) {
+    return;
+  }
+
+  const size_t Size = FEXCore::AlignUp(sizeof(FEXCore::SHMStats::ThunkStatsHeader) + MAX_PROFILED_THUNKS * sizeof(FEXCore::SHMStats::ThunkStats),
+                                       FEXCore::Utils::FEX_PAGE_SIZE);
+
+  if (ftruncate(fd, Size) == -1) {
+    LogMan::Msg::EFmt("[StatAlloc] thunk ftruncate failed");
+    close(fd);
+    return;
+  }
+
+  auto Ptr = FEXCore::Allocator::mmap(nullptr, Size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+
+  if (Ptr == MAP_FAILED) {
+    LogMan::Msg::EFmt("[StatAlloc] thunk mmap shm failed");
+    return;
+  }
+
+  ThunkBase = Ptr;
+  ThunkRegionSize = Size;
+  NumThunks = MAX_PROFILED_THUNKS;
+  ThunkStats =
+    reinterpret_cast<FEXCore::SHMStats::ThunkStats*>(reinterpret_cast<uint8_t*>(Ptr) + sizeof(FEXCore::SHMStats::ThunkStatsHeader));
+
+  auto ThunkHead = reinterpret_cast<FEXCore::SHMStats::ThunkStatsHeader*>(Ptr);
+  ThunkHead->app_type = Is64BitMode() ? FEXCore::SHMStats::AppType::LINUX_64 : FEXCore::SHMStats::AppType::LINUX_32;
+  ThunkHead->ThunkStatsSize = sizeof(FEXCore::SHMStats::ThunkStats);
+  ThunkHead->NumThunks = MAX_PROFILED_THUNKS;
+  ThunkHead->CycleCounterFrequency = FEXCore::SHMStats::GetCycleCounterFrequency();
+
+  // Version is written last so readers never observe a partially initialized header.
+  store_memory_barrier();
+  ThunkHead->Version = FEXCore::SHMStats::THUNK_STATS_VERSION;
+}
+
+void ThreadManager::StatAlloc::ReleaseThunkStats() {
+  if (ThunkBase) {
+    FEXCore::Allocator::munmap(ThunkBase, ThunkRegionSize);
+  }
+
+  ThunkBase = nullptr;
+  ThunkRegionSize = 0;
+  ThunkStats = nullptr;
+  NumThunks = 0;
 }
 
 void ThreadManager::StatAlloc::Initialize() {
@@ -119,6 +236,8 @@ void ThreadManager::StatAlloc::DeallocateSlot(FEXCore::SHMStats::ThreadStats* Al
 
 void ThreadManager::StatAlloc::CleanupForExit() {
   shm_unlink(fextl::fmt::format("fex-{}-stats", ::getpid()).c_str());
+  shm_unlink(fextl::fmt::format("fex-{}-syscalls", ::getpid()).c_str());
+  shm_unlink(fextl::fmt::format("fex-{}-thunks", ::getpid()).c_str());
 }
 
 void ThreadManager::StatAlloc::LockBeforeFork() {
@@ -152,8 +271,13 @@ void ThreadManager::StatAlloc::UnlockAfterFork(FEXCore::Core::InternalThreadStat
 
   Thread->ThreadStats = nullptr;
 
+  ReleaseSyscallStats();
+  ReleaseThunkStats();
+
   Initialize();
   SaveHeader(Is64BitMode() ? FEXCore::SHMStats::AppType::LINUX_64 : FEXCore::SHMStats::AppType::LINUX_32);
+  InitializeSyscallStats();
+  InitializeThunkStats();
 
   // Update this thread's ThreadStats object
   auto ThreadObject = FEX::HLE::ThreadManager::GetStateObjectFromFEXCoreThread(Thread);
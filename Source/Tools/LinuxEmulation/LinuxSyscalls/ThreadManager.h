@@ -10,6 +10,7 @@ $end_info$
 
 #include "Common/SHMStats.h"
 
+#include "LinuxSyscalls/SyscallsVMATracking.h"
 #include "LinuxSyscalls/Types.h"
 #include "LinuxSyscalls/x32/IoctlEmulation.h"
 
@@ -29,6 +30,7 @@ $end_info$
 #include <mutex>
 #include <optional>
 #include <sys/stat.h>
+#include <time.h>
 
 #include <bits/types/sigset_t.h>
 #include <linux/seccomp.h>
@@ -92,6 +94,14 @@ struct ThreadStateObject : public FEXCore::Allocator::FEXAllocOperators {
   // personality emulation.
   uint32_t persona {};
 
+  // Cycles spent in host syscalls while handling the current guest syscall, only tracked with ProfileStats.
+  uint64_t SyscallHostTime {};
+
+  // Last VMAs looked up by the frontend and the SIGSEGV handler, validated against VMATracking::Generation.
+  // Kept separate so faults on guard pages don't evict the code mapping being compiled.
+  VMATracking::VMASnapshot CodeVMASnapshot {};
+  VMATracking::VMASnapshot FaultVMASnapshot {};
+
   FEXCore::Core::NonMovableUniquePtr<FEXCore::Threads::Thread> ExecutionThread;
 
   // Thread signaling information
@@ -109,6 +119,10 @@ struct ThreadStateObject : public FEXCore::Allocator::FEXAllocOperators {
 
   int StatusCode {};
 
+  // Guest profiler sampling timer, only valid if HasProfileTimer is set.
+  timer_t ProfileTimer {};
+  bool HasProfileTimer {};
+
   struct CallRetStackInfo {
     uint64_t AllocationBase;
     uint64_t AllocationEnd;
@@ -152,8 +166,26 @@ public:
     FEXCore::SHMStats::ThreadStats* AllocateSlot(uint32_t TID);
     void DeallocateSlot(FEXCore::SHMStats::ThreadStats* AllocatedSlot);
 
+    FEXCore::SHMStats::SyscallStats* GetSyscallStats(uint64_t Syscall) const {
+      if (!SyscallStats || Syscall >= NumSyscalls) {
+        return nullptr;
+      }
+      return &SyscallStats[Syscall];
+    }
+
+    FEXCore::SHMStats::ThunkStats* GetThunkStats(uint32_t Index) const {
+      if (!ThunkStats || Index >= NumThunks) {
+        return nullptr;
+      }
+      return &ThunkStats[Index];
+    }
+
   private:
     void Initialize();
+    void InitializeSyscallStats();
+    void ReleaseSyscallStats();
+    void InitializeThunkStats();
+    void ReleaseThunkStats();
 
     uint32_t FrontendAllocateSlots(uint32_t NewSize) override;
     FEX_CONFIG_OPT(ProfileStats, PROFILESTATS);
@@ -161,12 +193,34 @@ public:
 
     constexpr static int USER_PERMS = S_IRWXU | S_IRWXG | S_IRWXO;
     FEXCore::ForkableUniqueMutex StatMutex;
+
+    // Fixed size region for per-syscall stats, one entry per guest syscall number.
+    void* SyscallBase {};
+    size_t SyscallRegionSize {};
+    FEXCore::SHMStats::SyscallStats* SyscallStats {};
+    uint32_t NumSyscalls {};
+
+    // Fixed size region for per-thunk stats, see ThunkHandler for how entries are assigned.
+    void* ThunkBase {};
+    size_t ThunkRegionSize {};
+    FEXCore::SHMStats::ThunkStats* ThunkStats {};
+    uint32_t NumThunks {};
   };
 
   void CleanupForExit() {
     Stat.CleanupForExit();
   }
 
+  ///< Returns the stats entry of the guest syscall, nullptr if stats are disabled.
+  FEXCore::SHMStats::SyscallStats* GetSyscallStats(uint64_t Syscall) const {
+    return Stat.GetSyscallStats(Syscall);
+  }
+
+  ///< Returns the stats entry at the given index, nullptr if stats are disabled.
+  FEXCore::SHMStats::ThunkStats* GetThunkStats(uint32_t Index) const {
+    return Stat.GetThunkStats(Index);
+  }
+
   /**
    * @brief Sets the calling thread's signal mask to the one provided
    *
@@ -80,6 +80,43 @@ void x64SyscallHandler::RegisterSyscallHandlers() {
 #endif
 }
 
+FEXCore::HLE::SyscallABI x64SyscallHandler::GetSyscallABI(uint64_t Syscall) {
+  constexpr FEXCore::HLE::SyscallABI NotInline {0, false, -1};
+#if defined(ARCHITECTURE_arm64) && !defined(DEBUG_STRACE)
+  // Inline syscalls never see the seccomp filters, and cached code may be loaded by a process that installs some later.
+  if (NeedsSeccomp || EnableCodeCaching) {
+    return NotInline;
+  }
+
+  // Inline syscalls bypass HandleSyscall, which would leave holes in the syscall stats.
+  if (ProfileStats) {
+    return NotInline;
+  }
+
+  // Only syscalls that are plain passthroughs on x86-64, whose arguments need no translation and that don't touch
+  // state FEX tracks (memory mappings, signal masks, file descriptors FEX redirects) are allowed here.
+  switch (Syscall) {
+  case SYSCALL_x64_read: return {3, true, SYSCALL_DEF(read)};
+  case SYSCALL_x64_write: return {3, true, SYSCALL_DEF(write)};
+  case SYSCALL_x64_readv: return {3, true, SYSCALL_DEF(readv)};
+  case SYSCALL_x64_writev: return {3, true, SYSCALL_DEF(writev)};
+  case SYSCALL_x64_lseek: return {3, true, SYSCALL_DEF(lseek)};
+  case SYSCALL_x64_sched_yield: return {0, true, SYSCALL_DEF(sched_yield)};
+  case SYSCALL_x64_getpid: return {0, true, SYSCALL_DEF(getpid)};
+  case SYSCALL_x64_gettid: return {0, true, SYSCALL_DEF(gettid)};
+  case SYSCALL_x64_getppid: return {0, true, SYSCALL_DEF(getppid)};
+  case SYSCALL_x64_getuid: return {0, true, SYSCALL_DEF(getuid)};
+  case SYSCALL_x64_geteuid: return {0, true, SYSCALL_DEF(geteuid)};
+  case SYSCALL_x64_getgid: return {0, true, SYSCALL_DEF(getgid)};
+  case SYSCALL_x64_getegid: return {0, true, SYSCALL_DEF(getegid)};
+  case SYSCALL_x64_futex: return {6, true, SYSCALL_DEF(futex)};
+  case SYSCALL_x64_clock_gettime: return {2, true, SYSCALL_DEF(clock_gettime)};
+  default: break;
+  }
+#endif
+  return NotInline;
+}
+
 fextl::unique_ptr<FEX::HLE::SyscallHandler>
 CreateHandler(FEXCore::Context::Context* ctx, FEX::HLE::SignalDelegator* _SignalDelegation, FEX::HLE::ThunkHandler* ThunkHandler) {
   return fextl::make_unique<x64SyscallHandler>(ctx, _SignalDelegation, ThunkHandler);
@@ -42,6 +42,7 @@ public:
     return FEX::HLE::SyscallHandler::GuestMunmap(true, Thread, addr, length);
   }
 
+  FEXCore::HLE::SyscallABI GetSyscallABI(uint64_t Syscall) override;
 
   void RegisterSyscall_64(int SyscallNumber,
 #ifdef DEBUG_STRACE
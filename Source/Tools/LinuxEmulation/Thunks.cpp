@@ -7,6 +7,7 @@ $end_info$
 */
 
 #include "Thunks.h"
+#include "Common/AppendOnlyHashTable.h"
 #include "LinuxSyscalls/Syscalls.h"
 #include "LinuxSyscalls/ThreadManager.h"
 
@@ -17,17 +18,25 @@ $end_info$
 #include <FEXCore/Debug/InternalThreadState.h>
 #include <FEXCore/Utils/LogManager.h>
 #include <FEXCore/Utils/CompilerDefs.h>
+#include <FEXCore/Utils/SHMStats.h>
+#include <FEXCore/fextl/deque.h>
+#include <FEXCore/fextl/memory.h>
 #include <FEXCore/fextl/set.h>
 #include <FEXCore/fextl/string.h>
 #include <FEXCore/fextl/unordered_map.h>
+#include <FEXCore/fextl/vector.h>
 
+#include <array>
+#include <atomic>
 #include <cstdint>
+#include <cstring>
 #include <dlfcn.h>
 
 #include <malloc.h>
 #include <mutex>
 #include <shared_mutex>
 #include <stdint.h>
+#include <type_traits>
 #include <utility>
 
 #ifdef ENABLE_JEMALLOC_GLIBC
@@ -104,6 +113,64 @@ struct GuestcallInfoHash {
   }
 };
 
+/*
+  Profiling of thunked functions, only used with ProfileStats enabled.
+
+  The JIT calls thunked functions directly, so each profiled function is
+  assigned one of MAX_PROFILED_THUNKS entry points that is handed out by
+  LookupThunk instead. The entry points forward all argument registers, so
+  they work for both the packed argument ABI and the register ABI.
+*/
+using RegisterABIThunkedFunction = uint64_t(uint64_t, uint64_t, uint64_t, uint64_t, uint64_t, uint64_t);
+
+struct ProfiledThunkSlot {
+  FEXCore::ThunkedFunction* Fn;
+  bool RegisterABI;
+  FEXCore::IR::SHA256Sum Sum;
+  char Library[32];
+};
+
+static ProfiledThunkSlot ProfiledThunkSlots[MAX_PROFILED_THUNKS];
+
+// Cycles this thread spent running guest callbacks, used to exclude them from the host time of the calling thunk
+static thread_local uint64_t GuestCallbackCycles {};
+
+template<uint32_t Index>
+static uint64_t ProfiledThunkEntry(uint64_t Arg0, uint64_t Arg1, uint64_t Arg2, uint64_t Arg3, uint64_t Arg4, uint64_t Arg5) {
+  const auto& Slot = ProfiledThunkSlots[Index];
+  const auto CallbackCyclesBegin = GuestCallbackCycles;
+  const auto Begin = FEXCore::SHMStats::GetCycleCounter();
+
+  uint64_t Result {};
+  if (Slot.RegisterABI) {
+    Result = reinterpret_cast<RegisterABIThunkedFunction*>(Slot.Fn)(Arg0, Arg1, Arg2, Arg3, Arg4, Arg5);
+  } else {
+    Slot.Fn(reinterpret_cast<void*>(Arg0));
+  }
+
+  const auto Duration = FEXCore::SHMStats::GetCycleCounter() - Begin - (GuestCallbackCycles - CallbackCyclesBegin);
+
+  // Looked up on every call since the stats region is recreated on fork
+  if (auto Stats = FEX::HLE::_SyscallHandler->TM.GetThunkStats(Index)) {
+    if (std::atomic_ref(Stats->Count).load(std::memory_order_relaxed) == 0) {
+      // Publish the entry before its first count. Concurrent first calls write the same data.
+      memcpy(Stats->Sum, Slot.Sum.data, sizeof(Stats->Sum));
+      memcpy(Stats->Library, Slot.Library, sizeof(Stats->Library));
+    }
+    std::atomic_ref(Stats->AccumulatedHostTime).fetch_add(Duration, std::memory_order_relaxed);
+    std::atomic_ref(Stats->Count).fetch_add(1, std::memory_order_release);
+  }
+
+  return Result;
+}
+
+template<uint32_t... Indices>
+static constexpr std::array<RegisterABIThunkedFunction*, sizeof...(Indices)> MakeProfiledThunkEntries(std::integer_sequence<uint32_t, Indices...>) {
+  return {&ProfiledThunkEntry<Indices>...};
+}
+
+static constexpr auto ProfiledThunkEntries = MakeProfiledThunkEntries(std::make_integer_sequence<uint32_t, MAX_PROFILED_THUNKS> {});
+
 namespace ThunkFunctions {
   void LoadLib(void* ArgsV);
   void IsLibLoaded(void* ArgsRV);
@@ -113,13 +180,16 @@ namespace ThunkFunctions {
 } // namespace ThunkFunctions
 
 struct ThunkHandler_impl final : public FEX::HLE::ThunkHandler {
+  ThunkHandler_impl();
+
+  // Serializes all modifications. Lookups in Thunks and GuestcallToHostTrampoline don't need it.
   std::shared_mutex ThunksMutex;
 
   // Can't be a string_view. We need to keep a copy of the library name in-case string_view pointer goes away.
   // Ideally we track when a library has been unloaded and remove it from this set before the memory backing goes away.
   fextl::set<fextl::string> Libs;
 
-  fextl::unordered_map<GuestcallInfo, HostToGuestTrampolinePtr*, GuestcallInfoHash> GuestcallToHostTrampoline;
+  FEX::AppendOnlyHashTable<GuestcallInfo, HostToGuestTrampolinePtr*, GuestcallInfoHash> GuestcallToHostTrampoline;
 
   uint8_t* HostTrampolineInstanceDataPtr;
   size_t HostTrampolineInstanceDataAvailable = 0;
@@ -132,34 +202,51 @@ struct ThunkHandler_impl final : public FEX::HLE::ThunkHandler {
       ERROR_AND_DIE_FMT("Thunked library attempted to invoke guest callback asynchronously");
     }
 
-    auto CTX = static_cast<FEXCore::Context::Context*>(ThreadObject->Thread->CTX);
+    auto Thread = ThreadObject->Thread;
+    auto CTX = static_cast<FEXCore::Context::Context*>(Thread->CTX);
     auto ThunkHandler = reinterpret_cast<ThunkHandler_impl*>(FEX::HLE::_SyscallHandler->GetThunkHandler());
+    auto& GRegs = Thread->CurrentFrame->State.gregs;
 
     if (ThunkHandler->Is64BitMode()) {
-      ThreadObject->Thread->CurrentFrame->State.gregs[FEXCore::X86State::REG_RDI] = (uintptr_t)arg0;
-      ThreadObject->Thread->CurrentFrame->State.gregs[FEXCore::X86State::REG_RSI] = (uintptr_t)arg1;
+      GRegs[FEXCore::X86State::REG_RDI] = (uintptr_t)arg0;
+      GRegs[FEXCore::X86State::REG_RSI] = (uintptr_t)arg1;
     } else {
       if ((reinterpret_cast<uintptr_t>(arg1) >> 32) != 0) {
         ERROR_AND_DIE_FMT("Tried to call guest function with arguments packed to a 64-bit address");
       }
-      ThreadObject->Thread->CurrentFrame->State.gregs[FEXCore::X86State::REG_RCX] = (uintptr_t)arg0;
-      ThreadObject->Thread->CurrentFrame->State.gregs[FEXCore::X86State::REG_RDX] = (uintptr_t)arg1;
+      GRegs[FEXCore::X86State::REG_RCX] = (uintptr_t)arg0;
+      GRegs[FEXCore::X86State::REG_RDX] = (uintptr_t)arg1;
+    }
+
+    if (!ThunkHandler->ProfileStats()) {
+      CTX->HandleCallback(Thread, (uintptr_t)callback);
+      return;
     }
 
-    CTX->HandleCallback(ThreadObject->Thread, (uintptr_t)callback);
+    // Overwrite rather than accumulate so callbacks nested in this one aren't subtracted twice from the calling thunk
+    const auto CallbackCycles = GuestCallbackCycles;
+    const auto Begin = FEXCore::SHMStats::GetCycleCounter();
+    CTX->HandleCallback(Thread, (uintptr_t)callback);
+    GuestCallbackCycles = CallbackCycles + FEXCore::SHMStats::GetCycleCounter() - Begin;
   }
 
   FEXCore::ThunkedFunction* LookupThunk(const FEXCore::IR::SHA256Sum& sha256) override {
+    auto Entry = Thunks.Find(sha256);
 
-    std::shared_lock lk(ThunksMutex);
-
-    auto it = Thunks.find(sha256);
-
-    if (it != Thunks.end()) {
-      return it->second;
-    } else {
+    if (!Entry) {
       return nullptr;
     }
+
+    if (!ProfileStats()) {
+      return Entry->Fn;
+    }
+
+    return GetProfiledThunk(sha256, *Entry);
+  }
+
+  bool IsRegisterABIThunk(const FEXCore::IR::SHA256Sum& sha256) override {
+    auto Entry = Thunks.Find(sha256);
+    return Entry && Entry->RegisterABI;
   }
 
   void RegisterTLSState(FEX::HLE::ThreadStateObject* _ThreadObject) override {
@@ -167,14 +254,31 @@ struct ThunkHandler_impl final : public FEX::HLE::ThunkHandler {
   }
 
   void AppendThunkDefinitions(std::span<const FEXCore::IR::ThunkDefinition> Definitions) override {
+    std::lock_guard lk(ThunksMutex);
     for (auto& Definition : Definitions) {
-      Thunks.emplace(Definition.Sum, Definition.ThunkFunction);
+      AddThunk(Definition.Sum, {.Fn = Definition.ThunkFunction});
     }
   }
 
   void LoadLib(std::string_view Name);
 
 private:
+  struct ThunkEntry {
+    FEXCore::ThunkedFunction* Fn;
+    // Takes its arguments in registers rather than through a packed argument struct
+    bool RegisterABI;
+    // Library the thunk was loaded from, pointing into Libs. nullptr for thunks built into FEX.
+    const fextl::string* Library;
+  };
+
+  // Must be called with ThunksMutex held
+  void AddThunk(const FEXCore::IR::SHA256Sum& sha256, const ThunkEntry& Entry) {
+    Thunks.Insert(sha256, &ThunkEntries.emplace_back(Entry));
+  }
+
+  // Returns the profiling entry point for the given thunk, or its function itself if no entry point is available
+  FEXCore::ThunkedFunction* GetProfiledThunk(const FEXCore::IR::SHA256Sum& sha256, const ThunkEntry& Entry);
+
   // Bits in a SHA256 sum are already randomly distributed, so truncation yields a suitable hash function
   struct TruncatingSHA256Hash {
     size_t operator()(const FEXCore::IR::SHA256Sum& SHA256Sum) const noexcept {
@@ -182,7 +286,27 @@ private:
     }
   };
 
-  fextl::unordered_map<FEXCore::IR::SHA256Sum, FEXCore::ThunkedFunction*, TruncatingSHA256Hash> Thunks = {
+  // Entries are never modified after publishing them, so lock-free readers can't observe partial updates
+  fextl::deque<ThunkEntry> ThunkEntries;
+  FEX::AppendOnlyHashTable<FEXCore::IR::SHA256Sum, const ThunkEntry*, TruncatingSHA256Hash> Thunks;
+
+  // Profiling entry points handed out so far, guarded by ProfiledThunksMutex
+  std::mutex ProfiledThunksMutex;
+  fextl::unordered_map<FEXCore::IR::SHA256Sum, FEXCore::ThunkedFunction*, TruncatingSHA256Hash> ProfiledThunks;
+  uint32_t NumProfiledThunks {};
+
+  FEX_CONFIG_OPT(Is64BitMode, IS64BIT_MODE);
+  FEX_CONFIG_OPT(ThunkHostLibsPath, THUNKHOSTLIBS);
+  FEX_CONFIG_OPT(ProfileStats, PROFILESTATS);
+};
+
+ThunkHandler_impl::ThunkHandler_impl() {
+  struct BuiltinThunk {
+    FEXCore::IR::SHA256Sum Sum;
+    FEXCore::ThunkedFunction* Fn;
+  };
+
+  static constexpr BuiltinThunk BuiltinThunks[] = {
     {// sha256(fex:loadlib)
      {0x27, 0x7e, 0xb7, 0x69, 0x5b, 0xe9, 0xab, 0x12, 0x6e, 0xf7, 0x85, 0x9d, 0x4b, 0xc9, 0xa2, 0x44,
       0x46, 0xcf, 0xbd, 0xb5, 0x87, 0x43, 0xef, 0x28, 0xa2, 0x65, 0xba, 0xfc, 0x89, 0x0f, 0x77, 0x80},
@@ -205,9 +329,35 @@ private:
      &ThunkFunctions::AllocateHostTrampolineForGuestFunction},
   };
 
-  FEX_CONFIG_OPT(Is64BitMode, IS64BIT_MODE);
-  FEX_CONFIG_OPT(ThunkHostLibsPath, THUNKHOSTLIBS);
-};
+  std::lock_guard lk(ThunksMutex);
+  for (auto& [Sum, Fn] : BuiltinThunks) {
+    AddThunk(Sum, {.Fn = Fn});
+  }
+}
+
+FEXCore::ThunkedFunction*
+ThunkHandler_impl::GetProfiledThunk(const FEXCore::IR::SHA256Sum& sha256, const ThunkEntry& Entry) {
+  std::lock_guard lk(ProfiledThunksMutex);
+
+  auto it = ProfiledThunks.find(sha256);
+  if (it != ProfiledThunks.end()) {
+    return it->second;
+  }
+
+  if (NumProfiledThunks == MAX_PROFILED_THUNKS || !FEX::HLE::_SyscallHandler->TM.GetThunkStats(0)) {
+    return Entry.Fn;
+  }
+
+  auto& Slot = ProfiledThunkSlots[NumProfiledThunks];
+  Slot.Fn = Entry.Fn;
+  Slot.RegisterABI = Entry.RegisterABI;
+  Slot.Sum = sha256;
+  strncpy(Slot.Library, Entry.Library ? Entry.Library->c_str() : "fex", sizeof(Slot.Library) - 1);
+
+  auto EntryPoint = reinterpret_cast<FEXCore::ThunkedFunction*>(ProfiledThunkEntries[NumProfiledThunks++]);
+  ProfiledThunks.emplace(sha256, EntryPoint);
+  return EntryPoint;
+}
 
 void ThunkHandler_impl::LoadLib(std::string_view Name) {
   auto SOName = ThunkHostLibsPath();
@@ -228,10 +378,13 @@ void ThunkHandler_impl::LoadLib(std::string_view Name) {
   auto InitSym = "fexthunks_exports_" + fextl::string {Name};
   std::replace(InitSym.begin(), InitSym.end(), '-', '_');
 
+  // Must match ExportEntry in ThunkLibs/include/common/Host.h
   struct ExportEntry {
     uint8_t* sha256;
     FEXCore::ThunkedFunction* Fn;
+    uint32_t Flags;
   };
+  constexpr uint32_t EXPORT_FLAG_REGISTER_ABI = 1U << 0;
 
   ExportEntry* (*InitFN)();
   (void*&)InitFN = dlsym(Handle, InitSym.c_str());
@@ -250,11 +403,12 @@ void ThunkHandler_impl::LoadLib(std::string_view Name) {
   {
     std::lock_guard lk(ThunksMutex);
 
-    Libs.insert(fextl::string {Name});
+    const auto Lib = &*Libs.insert(fextl::string {Name}).first;
 
     int i;
     for (i = 0; Exports[i].sha256; i++) {
-      Thunks[*reinterpret_cast<FEXCore::IR::SHA256Sum*>(Exports[i].sha256)] = Exports[i].Fn;
+      const auto& Sum = *reinterpret_cast<FEXCore::IR::SHA256Sum*>(Exports[i].sha256);
+      AddThunk(Sum, {.Fn = Exports[i].Fn, .RegisterABI = (Exports[i].Flags & EXPORT_FLAG_REGISTER_ABI) != 0, .Library = Lib});
     }
 
     LogMan::Msg::DFmt("Loaded {} syms", i);
@@ -292,24 +446,16 @@ MakeHostTrampolineForGuestFunction(void* HostPacker, uintptr_t GuestTarget, uint
 
   const GuestcallInfo gci = {GuestUnpacker, GuestTarget};
 
-  // Try first with shared_lock
-  {
-    std::shared_lock lk(ThunkHandler->ThunksMutex);
-
-    auto found = ThunkHandler->GuestcallToHostTrampoline.find(gci);
-    if (found != ThunkHandler->GuestcallToHostTrampoline.end()) {
-      return found->second;
-    }
+  // Try first without locking
+  if (auto Found = ThunkHandler->GuestcallToHostTrampoline.Find(gci)) {
+    return Found;
   }
 
   std::lock_guard lk(ThunkHandler->ThunksMutex);
 
   // Retry lookup with full lock before making a new trampoline to avoid double trampolines
-  {
-    auto found = ThunkHandler->GuestcallToHostTrampoline.find(gci);
-    if (found != ThunkHandler->GuestcallToHostTrampoline.end()) {
-      return found->second;
-    }
+  if (auto Found = ThunkHandler->GuestcallToHostTrampoline.Find(gci)) {
+    return Found;
   }
 
   LogMan::Msg::DFmt("Thunks: Adding host trampoline for guest function {:#x} via unpacker {:#x}", GuestTarget, GuestUnpacker);
@@ -332,7 +478,7 @@ MakeHostTrampolineForGuestFunction(void* HostPacker, uintptr_t GuestTarget, uint
   GetInstanceInfo(HostTrampoline) = TrampolineInstanceInfo {
     .HostPacker = HostPacker, .CallCallback = (uintptr_t)&ThunkHandler_impl::CallCallback, .GuestUnpacker = GuestUnpacker, .GuestTarget = GuestTarget};
 
-  ThunkHandler->GuestcallToHostTrampoline[gci] = HostTrampoline;
+  ThunkHandler->GuestcallToHostTrampoline.Insert(gci, HostTrampoline);
   return HostTrampoline;
 }
 
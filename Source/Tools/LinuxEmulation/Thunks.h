@@ -5,11 +5,16 @@
 #include <FEXCore/fextl/memory.h>
 #include <FEXCore/IR/IR.h>
 
+#include <cstdint>
 #include <span>
 
 namespace FEX::HLE {
 struct ThreadStateObject;
 
+// Number of thunked functions that can be tracked with ProfileStats enabled.
+// Functions looked up after all entries are in use run without profiling.
+constexpr uint32_t MAX_PROFILED_THUNKS = 1024;
+
 class ThunkHandler : public FEXCore::ThunkHandler {
 public:
   virtual void RegisterTLSState(FEX::HLE::ThreadStateObject* ThreadObject) = 0;
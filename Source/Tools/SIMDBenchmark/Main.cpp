@@ -0,0 +1,333 @@
+// SPDX-License-Identifier: MIT
+#include "DummyHandlers.h"
+#include "InstCountCI.h"
+#include "Common/HostFeatures.h"
+#include "FEXCore/Core/Context.h"
+#include "FEXCore/Core/X86Enums.h"
+#include "FEXCore/Debug/InternalThreadState.h"
+#include <FEXCore/Config/Config.h>
+#include <FEXCore/Utils/Allocator.h>
+#include <FEXCore/Utils/File.h>
+#include <FEXCore/Utils/LogManager.h>
+#include <FEXCore/Utils/SignalScopeGuards.h>
+#include <FEXCore/fextl/fmt.h>
+#include <FEXCore/fextl/string.h>
+#include <FEXCore/fextl/unordered_map.h>
+
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cstring>
+#include <sys/mman.h>
+#include <unistd.h>
+
+// Runs the vector instructions of an InstructionCountCI test binary in a JIT'd loop and reports
+// how many host instructions and how much time one execution of each costs.
+//
+// Each instruction is unrolled in to a loop that is counted down in r15 and exits through HLT:
+// .Loop:
+//   <Instruction> * Unroll
+//   dec r15d
+//   jnz .Loop
+//   hlt
+//
+// The cost of an empty loop is measured first and subtracted from every result.
+// Under the vixl simulator the times are the simulator's, the host instruction counts are still exact.
+namespace SIMDBench {
+using FEX::InstCountCI::TestInfo;
+
+struct Result {
+  // Negative if the JIT doesn't print block statistics.
+  double HostInstructionsPerOp;
+  double NanosecondsPerOp;
+};
+
+class Benchmark final {
+public:
+  Benchmark() {
+    CodeStart = reinterpret_cast<uint8_t*>(
+      FEXCore::Allocator::mmap(nullptr, MAX_CODE_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+    if (reinterpret_cast<uint64_t>(CodeStart) == ~0ULL) {
+      LogMan::Msg::AFmt("Couldn't allocate benchmark region!");
+      CodeStart = nullptr;
+    }
+  }
+
+  ~Benchmark() {
+    if (CodeStart) {
+      FEXCore::Allocator::VirtualFree(CodeStart, MAX_CODE_SIZE);
+    }
+  }
+
+  bool ParseMessage(const char* Message);
+
+  void CalculateLoopOverhead(FEXCore::Context::Context* CTX, FEXCore::Core::InternalThreadState* Thread) {
+    LoopOverhead = Run(CTX, Thread, nullptr, 0, 0);
+  }
+
+  Result Measure(FEXCore::Context::Context* CTX, FEXCore::Core::InternalThreadState* Thread, const TestInfo* Test) {
+    auto Stats = Run(CTX, Thread, Test->Code, Test->CodeSize, Unroll);
+    const double Ops = static_cast<double>(Iterations) * Unroll;
+
+    return {
+      .HostInstructionsPerOp = (Stats.HostInstructions && LoopOverhead.HostInstructions) ?
+                                 static_cast<double>(Stats.HostInstructions - LoopOverhead.HostInstructions) / Unroll :
+                                 -1.0,
+      .NanosecondsPerOp = std::max(Stats.Nanoseconds - LoopOverhead.Nanoseconds, 0.0) / Ops,
+    };
+  }
+
+  uint32_t Iterations {100'000};
+private:
+  struct LoopStats {
+    uint64_t HostInstructions;
+    double Nanoseconds;
+  };
+
+  LoopStats Run(FEXCore::Context::Context* CTX, FEXCore::Core::InternalThreadState* Thread, const uint8_t* Code, size_t CodeSize,
+                uint32_t Count) {
+    {
+      auto CodeInvalidationlk = FEXCore::GuardSignalDeferringSection(CTX->GetCodeInvalidationMutex(), Thread);
+      CTX->InvalidateCodeBuffersCodeRange(reinterpret_cast<uint64_t>(CodeStart), MAX_CODE_SIZE);
+      CTX->InvalidateThreadCachedCodeRange(Thread, reinterpret_cast<uint64_t>(CodeStart), MAX_CODE_SIZE);
+    }
+
+    HostInstructions.clear();
+    WriteLoop(Code, CodeSize, Count);
+
+    auto Frame = Thread->CurrentFrame;
+    auto Execute = [&](uint32_t LoopIterations) {
+      Frame->State.rip = reinterpret_cast<uint64_t>(CodeStart);
+      Frame->State.gregs[FEXCore::X86State::REG_R15] = LoopIterations;
+      CTX->ExecuteThread(Thread);
+    };
+
+    // The first pass compiles the loop so that it isn't part of the measurement.
+    Execute(1);
+
+    const auto Begin = std::chrono::steady_clock::now();
+    Execute(Iterations);
+    const auto Nanoseconds = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - Begin).count();
+
+    auto it = HostInstructions.find(reinterpret_cast<uint64_t>(CodeStart));
+    return {
+      .HostInstructions = it != HostInstructions.end() ? it->second : 0,
+      .Nanoseconds = Nanoseconds,
+    };
+  }
+
+  void WriteLoop(const uint8_t* Code, size_t CodeSize, uint32_t Count) {
+    uint8_t* Ptr = CodeStart;
+    for (uint32_t i = 0; i < Count; ++i) {
+      memcpy(Ptr, Code, CodeSize);
+      Ptr += CodeSize;
+    }
+
+    // dec r15d
+    constexpr uint8_t DecR15[] = {0x41, 0xFF, 0xCF};
+    memcpy(Ptr, DecR15, sizeof(DecR15));
+    Ptr += sizeof(DecR15);
+
+    // jnz .Loop
+    const int32_t Displacement = -static_cast<int32_t>((Ptr + 6) - CodeStart);
+    *Ptr++ = 0x0F;
+    *Ptr++ = 0x85;
+    memcpy(Ptr, &Displacement, sizeof(Displacement));
+    Ptr += sizeof(Displacement);
+
+    // hlt
+    *Ptr++ = 0xF4;
+  }
+
+  constexpr static uint32_t Unroll = 16;
+  constexpr static size_t MAX_CODE_SIZE = 4096;
+
+  uint8_t* CodeStart {};
+  uint64_t CurrentRIPParse {};
+  fextl::unordered_map<uint64_t, uint64_t> HostInstructions;
+  LoopStats LoopOverhead {};
+};
+
+bool Benchmark::ParseMessage(const char* Message) {
+  const std::string_view MessageView {Message};
+  if (auto RIP = FEX::InstCountCI::ParseStatsMessage(MessageView, FEX::InstCountCI::RIPMessage, 16)) {
+    CurrentRIPParse = *RIP;
+    return false;
+  }
+
+  if (auto Count = FEX::InstCountCI::ParseStatsMessage(MessageView, FEX::InstCountCI::HostCodeMessage)) {
+    HostInstructions[CurrentRIPParse] = *Count;
+    return false;
+  }
+
+  // Hide the rest of the block statistics.
+  return !FEX::InstCountCI::IsStatsMessage(MessageView);
+}
+
+// Only single instructions that work on vector registers can run in the loop.
+// Memory operands would need a mapping behind them, and r15 is the loop counter.
+static bool IsBenchmarkable(const TestInfo* Test) {
+  const std::string_view Inst {Test->TestInst};
+  if (Test->x86InstCount != 1 || Inst.find("mm") == Inst.npos) {
+    return false;
+  }
+
+  return Inst.find('[') == Inst.npos && Inst.find("maskmov") == Inst.npos && Inst.find("r15") == Inst.npos;
+}
+
+static Benchmark* Bench {};
+static FEX::InstCountCI::TestFile Tests {};
+
+static void RunTests(FEXCore::Context::Context* CTX, FEXCore::Core::InternalThreadState* Thread, const char* ReportPath) {
+  Bench->CalculateLoopOverhead(CTX, Thread);
+
+  fextl::string Report = "{\n";
+  const TestInfo* CurrentTest = Tests.TestsStart;
+  for (size_t i = 0; i < Tests.Header->NumTests; ++i) {
+    if (IsBenchmarkable(CurrentTest)) {
+      const auto Stats = Bench->Measure(CTX, Thread, CurrentTest);
+
+      if (Stats.HostInstructionsPerOp >= 0.0) {
+        LogMan::Msg::IFmt("{:<64} {:>8.2f} inst/op {:>10.3f} ns/op", CurrentTest->TestInst, Stats.HostInstructionsPerOp,
+                          Stats.NanosecondsPerOp);
+      } else {
+        LogMan::Msg::IFmt("{:<64} {:>10.3f} ns/op", CurrentTest->TestInst, Stats.NanosecondsPerOp);
+      }
+
+      Report += fextl::fmt::format("\t\"{}\": {{\n", CurrentTest->TestInst);
+      if (Stats.HostInstructionsPerOp >= 0.0) {
+        Report += fextl::fmt::format("\t\t\"HostInstructionsPerOp\": {:.2f},\n", Stats.HostInstructionsPerOp);
+      }
+      Report += fextl::fmt::format("\t\t\"NanosecondsPerOp\": {:.3f}\n", Stats.NanosecondsPerOp);
+      Report += "\t},\n";
+    }
+
+    // Go to the next test.
+    CurrentTest = CurrentTest->Next();
+  }
+
+  // Print a null member
+  Report += "\t\"\": \"\"\n}\n";
+
+  if (!ReportPath) {
+    return;
+  }
+
+  unlink(ReportPath);
+  FEXCore::File::File FD(ReportPath, FEXCore::File::FileModes::WRITE | FEXCore::File::FileModes::CREATE | FEXCore::File::FileModes::TRUNCATE);
+  if (!FD.IsValid()) {
+    LogMan::Msg::EFmt("Couldn't open {} for writing the benchmark report", ReportPath);
+    return;
+  }
+  FD.Write(Report);
+}
+} // namespace SIMDBench
+
+void MsgHandler(LogMan::DebugLevels Level, const char* Message) {
+  if (Level == LogMan::INFO && !SIMDBench::Bench->ParseMessage(Message)) {
+    return;
+  }
+
+  fextl::fmt::print("{} {}\n", LogMan::DebugLevelStr(Level), Message);
+}
+
+void AssertHandler(const char* Message) {
+  fextl::fmt::print("A {}\n", Message);
+
+  // make sure buffers are flushed
+  fflush(nullptr);
+}
+
+int main(int argc, char** argv, char** const envp) {
+  FEXCore::Allocator::GLIBCScopedFault GLIBFaultScope;
+
+  // Initialize early as the message handlers use it.
+  SIMDBench::Benchmark Bench {};
+  SIMDBench::Bench = &Bench;
+
+  LogMan::Throw::InstallHandler(AssertHandler);
+  LogMan::Msg::InstallHandler(MsgHandler);
+  FEXCore::Config::Initialize();
+  FEXCore::Config::Load();
+
+  if (argc < 2) {
+    LogMan::Msg::EFmt("Usage: {} <Test binary> [Report.json] [Iterations]", argv[0]);
+    return 1;
+  }
+
+  if (!FEX::InstCountCI::LoadTests(argv[1], SIMDBench::Tests)) {
+    LogMan::Msg::EFmt("Couldn't load tests from {}", argv[1]);
+    return 1;
+  }
+
+  if (argc >= 4) {
+    std::from_chars(argv[3], argv[3] + strlen(argv[3]), Bench.Iterations);
+  }
+
+  if (SIMDBench::Tests.Header->Bitness != 64) {
+    // The loop counter lives in r15.
+    LogMan::Msg::IFmt("Skipping 32-bit tests");
+    return 0;
+  }
+
+  // Only print the block statistics, the instruction counts are parsed out of them.
+  FEXCore::Config::Set(FEXCore::Config::CONFIG_DISASSEMBLE, fextl::fmt::format("{}", static_cast<uint64_t>(FEXCore::Config::Disassemble::STATS)));
+  FEXCore::Config::Set(FEXCore::Config::CONFIG_IS64BIT_MODE, "1");
+  // Disable telemetry, it can affect instruction counts.
+  FEXCore::Config::Set(FEXCore::Config::CONFIG_DISABLETELEMETRY, "1");
+  FEXCore::Config::Set(FEXCore::Config::CONFIG_TSOENABLED, "0");
+
+  // Features the host doesn't have can't be enabled here, so only the disabled features of the test are applied.
+  // The remaining tests run with whatever the host supports.
+  uint64_t HostFeatureControl {};
+  const auto Disabled = SIMDBench::Tests.Header->DisabledHostFeatures;
+  constexpr std::pair<uint64_t, FEXCore::Config::HostFeatures> DisableFeatures[] = {
+    {FEX::InstCountCI::FEATURE_SVE128, FEXCore::Config::HostFeatures::DISABLESVE},
+    {FEX::InstCountCI::FEATURE_CLZERO, FEXCore::Config::HostFeatures::DISABLECLZERO},
+    {FEX::InstCountCI::FEATURE_RNG, FEXCore::Config::HostFeatures::DISABLERNG},
+    {FEX::InstCountCI::FEATURE_FCMA, FEXCore::Config::HostFeatures::DISABLEFCMA},
+    {FEX::InstCountCI::FEATURE_CSSC, FEXCore::Config::HostFeatures::DISABLECSSC},
+    {FEX::InstCountCI::FEATURE_AFP, FEXCore::Config::HostFeatures::DISABLEAFP},
+    {FEX::InstCountCI::FEATURE_RPRES, FEXCore::Config::HostFeatures::DISABLERPRES},
+    {FEX::InstCountCI::FEATURE_FLAGM, FEXCore::Config::HostFeatures::DISABLEFLAGM},
+    {FEX::InstCountCI::FEATURE_FLAGM2, FEXCore::Config::HostFeatures::DISABLEFLAGM2},
+    {FEX::InstCountCI::FEATURE_CRYPTO, FEXCore::Config::HostFeatures::DISABLECRYPTO},
+    {FEX::InstCountCI::FEATURE_SVEBITPERM, FEXCore::Config::HostFeatures::DISABLESVEBITPERM},
+    {FEX::InstCountCI::FEATURE_LRCPC, FEXCore::Config::HostFeatures::DISABLELRCPC},
+    {FEX::InstCountCI::FEATURE_LRCPC2, FEXCore::Config::HostFeatures::DISABLELRCPC2},
+    {FEX::InstCountCI::FEATURE_FRINTTS, FEXCore::Config::HostFeatures::DISABLEFRINTTS},
+  };
+  for (const auto& [Feature, Control] : DisableFeatures) {
+    if (Disabled & Feature) {
+      HostFeatureControl |= static_cast<uint64_t>(Control);
+    }
+  }
+  FEXCore::Config::Set(FEXCore::Config::CONFIG_HOSTFEATURES, fextl::fmt::format("{}", HostFeatureControl));
+
+  // Create FEXCore context.
+  auto CTX = FEXCore::Context::Context::CreateNewContext(FEX::FetchHostFeatures());
+
+  // HLT leaves the dispatcher instead of raising a signal, which ends each run of the loop.
+  CTX->EnableExitOnHLT();
+
+  auto SignalDelegation = FEX::DummyHandlers::CreateSignalDelegator();
+  auto SyscallHandler = FEX::DummyHandlers::CreateSyscallHandler();
+
+  CTX->SetSignalDelegator(SignalDelegation.get());
+  CTX->SetSyscallHandler(SyscallHandler.get());
+  if (!CTX->InitCore()) {
+    return -1;
+  }
+  auto ParentThread = CTX->CreateThread(0, 0);
+
+  // GDT data
+  FEXCore::Core::CPUState::gdt_segment gdt[32] {};
+
+  FEX::InstCountCI::SetupCodeSegment(ParentThread->CurrentFrame, &gdt[0], true);
+
+  SIMDBench::RunTests(CTX.get(), ParentThread, argc >= 3 ? argv[2] : nullptr);
+  CTX->DestroyThread(ParentThread);
+
+  FEX::InstCountCI::UnloadTests(SIMDBench::Tests);
+  return 0;
+}
@@ -75,6 +75,8 @@ enum class CallbackStrategy {
 struct Annotations {
   bool custom_host_impl = false;
   bool custom_guest_entrypoint = false;
+  bool register_abi = false;
+  bool batchable = false;
 
   bool returns_guest_pointer = false;
 
@@ -97,6 +99,10 @@ static Annotations GetAnnotations(clang::ASTContext& context, clang::CXXRecordDe
       ret.callback_strategy = CallbackStrategy::Stub;
     } else if (annotation == "fexgen::custom_guest_entrypoint") {
       ret.custom_guest_entrypoint = true;
+    } else if (annotation == "fexgen::register_abi") {
+      ret.register_abi = true;
+    } else if (annotation == "fexgen::batchable") {
+      ret.batchable = true;
     } else {
       throw report_error(base.getSourceRange().getBegin(), "Unknown annotation");
     }
@@ -194,7 +200,10 @@ static ParameterAnnotations GetParameterAnnotations(clang::ASTContext& context,
 
   for (const clang::CXXBaseSpecifier& base : decl->bases()) {
     auto annotation = base.getType().getAsString();
-    if (annotation == "fexgen::ptr_passthrough") {
+    auto template_annotation = llvm::dyn_cast_or_null<clang::ClassTemplateSpecializationDecl>(base.getType()->getAsCXXRecordDecl());
+    if (template_annotation && template_annotation->getQualifiedNameAsString() == "fexgen::array_size_param") {
+      ret.array_size_param = template_annotation->getTemplateArgs()[0].getAsIntegral().getZExtValue();
+    } else if (annotation == "fexgen::ptr_passthrough") {
       ret.is_passthrough = true;
     } else if (annotation == "fexgen::assume_compatible_data_layout") {
       ret.assume_compatible = true;
@@ -376,6 +385,14 @@ void AnalysisAction::ParseInterface(clang::ASTContext& context) {
             if (data.param_annotations[param_idx].is_passthrough && !data.custom_host_impl) {
               throw report_error(param_loc, "Passthrough annotation requires custom host implementation");
             }
+            if (auto count_idx = data.param_annotations[param_idx].array_size_param) {
+              if (!param_type->isPointerType() || data.param_annotations[param_idx].is_passthrough) {
+                throw report_error(param_loc, "Array size annotation requires a non-passthrough pointer parameter");
+              }
+              if (*count_idx >= emitted_function->param_size() || !emitted_function->getParamDecl(*count_idx)->getType()->isIntegerType()) {
+                throw report_error(param_loc, "Array size annotation must refer to an integer parameter");
+              }
+            }
             // Skip pointers-to-structs passed through to the host in guest_layout.
             // This avoids pulling in member types that can't be processed.
             if (data.param_annotations[param_idx].is_passthrough && param_type->isPointerType() &&
@@ -488,6 +505,74 @@ void AnalysisAction::ParseInterface(clang::ASTContext& context) {
             }
           }
 
+          if (annotations.register_abi) {
+            // Integers and pointers to void or builtin types have the same representation on guest and host
+            auto is_plain_register_type = [&](clang::QualType type) {
+              if (type->isIntegerType()) {
+                return context.getTypeSize(type) <= 64;
+              }
+              if (!type->isPointerType()) {
+                return false;
+              }
+              auto pointee_type = type->getPointeeType();
+              return pointee_type->isVoidType() || pointee_type->isBuiltinType();
+            };
+            auto is_register_param_type = [&](clang::QualType type, unsigned param_idx) {
+              const auto& param_annotations = data.param_annotations[param_idx];
+              if (type->isPointerType() && param_annotations.is_passthrough) {
+                return false;
+              }
+              return is_plain_register_type(type) || (type->isPointerType() && param_annotations.assume_compatible);
+            };
+            // Return values can't be annotated, so only plain types are allowed
+            auto is_register_return_type = [&](clang::QualType type) {
+              return type->isVoidType() || is_plain_register_type(type);
+            };
+
+            if (data.is_variadic || data.custom_host_impl || !data.callbacks.empty()) {
+              throw report_error(template_arg_loc, "Register ABI is not supported for variadic functions, callbacks, or custom host "
+                                                   "implementations");
+            }
+            if (emitted_function->param_size() > 6) {
+              throw report_error(template_arg_loc, "Register ABI requires at most six parameters");
+            }
+            for (unsigned param_idx = 0; param_idx < emitted_function->param_size(); ++param_idx) {
+              if (!is_register_param_type(emitted_function->getParamDecl(param_idx)->getType(), param_idx)) {
+                throw report_error(emitted_function->getParamDecl(param_idx)->getBeginLoc(), "Unsupported parameter type for register ABI")
+                  .addNote(report_error(template_arg_loc, "used in annotation here", clang::DiagnosticsEngine::Note));
+              }
+            }
+            if (!is_register_return_type(return_type)) {
+              throw report_error(emitted_function->getReturnTypeSourceRange().getBegin(), "Unsupported return type for register ABI")
+                .addNote(report_error(template_arg_loc, "used in annotation here", clang::DiagnosticsEngine::Note));
+            }
+            data.register_abi = true;
+          }
+
+          if (annotations.batchable) {
+            if (!return_type->isVoidType()) {
+              throw report_error(template_arg_loc, "Batchable functions must return void");
+            }
+            if (data.is_variadic || !data.callbacks.empty() || data.register_abi) {
+              throw report_error(template_arg_loc, "Batchable functions may not be variadic, take callbacks, or use the register ABI");
+            }
+            for (unsigned param_idx = 0; param_idx < emitted_function->param_size(); ++param_idx) {
+              auto param_type = emitted_function->getParamDecl(param_idx)->getType();
+              if (!param_type->isPointerType()) {
+                continue;
+              }
+              // Opaque handles are fine since their pointee is never read by the guest
+              auto pointee_type = context.getCanonicalType(param_type->getPointeeType().getTypePtr());
+              if (types.contains(pointee_type) && LookupType(context, pointee_type).pointers_only) {
+                continue;
+              }
+              throw report_error(emitted_function->getParamDecl(param_idx)->getBeginLoc(), "Batchable functions may only take pointers "
+                                                                                            "to opaque types")
+                .addNote(report_error(template_arg_loc, "used in annotation here", clang::DiagnosticsEngine::Note));
+            }
+            data.batchable = true;
+          }
+
           thunked_api.push_back(ThunkedAPIFunction {(const FunctionParams&)data, data.function_name, data.return_type,
                                                     namespace_info.host_loader.empty() ? "dlsym_default" : namespace_info.host_loader,
                                                     data.is_variadic || annotations.custom_guest_entrypoint, data.is_variadic, std::nullopt});
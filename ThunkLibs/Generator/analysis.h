@@ -25,6 +25,9 @@ struct ParameterAnnotations {
   bool is_passthrough = false;
   bool assume_compatible = false;
 
+  // Index of the parameter holding the element count if this is a pointer to an array
+  std::optional<unsigned> array_size_param;
+
   bool operator==(const ParameterAnnotations&) const = default;
 };
 
@@ -49,6 +52,14 @@ struct ThunkedFunction : FunctionParams {
   // This is implied e.g. for thunks generated for variadic functions
   bool custom_host_impl = false;
 
+  // If true, 64-bit guests pass arguments in registers directly to the
+  // host function instead of through a packed argument struct
+  bool register_abi = false;
+
+  // If true, the guest records calls in a per-thread buffer that is flushed
+  // to the host on the next non-batchable call
+  bool batchable = false;
+
   std::string GetOriginalFunctionName() const {
     const std::string suffix = "_internal";
     assert(function_name.length() > suffix.size());
@@ -5,6 +5,7 @@
 #include <clang/Frontend/CompilerInstance.h>
 #include <clang/Basic/DiagnosticOptions.h>
 
+#include <algorithm>
 #include <fstream>
 #include <numeric>
 #include <iostream>
@@ -403,6 +404,16 @@ void GenerateThunkLibsAction::OnAnalysisComplete(clang::ASTContext& context) {
     return sha256;
   };
 
+  // Register ABI thunks use a separate hash so that guest and host libraries built with different ABIs never match up
+  auto uses_register_abi = [this](const ThunkedFunction& thunk) {
+    return thunk.register_abi && guest_abi.pointer_size == 8;
+  };
+  auto get_thunk_sha256 = [&](const ThunkedFunction& thunk) {
+    return get_sha256(thunk.function_name + (uses_register_abi(thunk) ? "@register_abi" : ""), true);
+  };
+
+  const bool has_batchable = std::any_of(thunks.begin(), thunks.end(), [](const ThunkedFunction& thunk) { return thunk.batchable; });
+
   auto get_callback_name = [](std::string_view function_name, unsigned param_index) -> std::string {
     return fmt::format("{}CBFN{}", function_name, param_index);
   };
@@ -415,11 +426,33 @@ void GenerateThunkLibsAction::OnAnalysisComplete(clang::ASTContext& context) {
     file << "extern \"C\" {\n";
     for (auto& thunk : thunks) {
       const auto& function_name = thunk.function_name;
-      auto sha256 = get_sha256(function_name, true);
+      auto sha256 = get_thunk_sha256(thunk);
       fmt::print(file, "MAKE_THUNK({}, {}, \"{:#02x}\")\n", libname, function_name, fmt::join(sha256, ", "));
     }
+    if (has_batchable) {
+      fmt::print(file, "MAKE_THUNK({}, fexbatch_flush, \"{:#02x}\")\n", libname, fmt::join(get_sha256("fexbatch_flush", true), ", "));
+    }
     file << "}\n";
 
+    // Per-thread buffer for deferred calls to batchable functions
+    if (has_batchable) {
+      file << "static thread_local FEXBatchBuffer fexbatch_buffer {FEXBatchFlush};\n";
+      file << "void FEXBatchFlush() {\n";
+      file << "  const uint32_t Begin = fexbatch_buffer.Begin;\n";
+      file << "  const uint32_t End = fexbatch_buffer.Used;\n";
+      file << "  if (Begin == End) {\n";
+      file << "    return;\n";
+      file << "  }\n";
+      // Guest callbacks invoked by the batched calls may batch and flush again, so mark the records as in flight before calling the host
+      file << "  fexbatch_buffer.Begin = End;\n";
+      file << "  FEXBatchFlushArgs args = {reinterpret_cast<uintptr_t>(&fexbatch_buffer.Data[Begin]), End - Begin};\n";
+      file << "  fexthunks_" << libname << "_fexbatch_flush(&args);\n";
+      file << "  fexbatch_buffer.Begin = fexbatch_buffer.Used = Begin;\n";
+      file << "}\n";
+    } else {
+      file << "void FEXBatchFlush() {}\n";
+    }
+
     // Guest->Host transition points for invoking runtime host-function pointers based on their signature
     std::vector<std::vector<unsigned char>> sha256s;
     for (auto type_it = thunked_funcptrs.begin(); type_it != thunked_funcptrs.end(); ++type_it) {
@@ -443,6 +476,7 @@ void GenerateThunkLibsAction::OnAnalysisComplete(clang::ASTContext& context) {
 
     // Thunks-internal packing functions
     file << "extern \"C\" {\n";
+    unsigned batch_index = 0;
     for (auto& data : thunks) {
       const auto& function_name = data.function_name;
       bool is_void = data.return_type->isVoidType();
@@ -453,6 +487,20 @@ void GenerateThunkLibsAction::OnAnalysisComplete(clang::ASTContext& context) {
       }
       // Using trailing return type as it makes handling function pointer returns much easier
       file << ") -> " << data.return_type.getAsString() << " {\n";
+      if (uses_register_abi(data)) {
+        // Arguments are already in the right registers, so just forward them to the thunk
+        if (has_batchable) {
+          file << "  FEXBatchFlush();\n";
+        }
+        file << "  return reinterpret_cast<decltype(&fexfn_pack_" << function_name << ")>(fexthunks_" << libname << "_" << function_name
+             << ")(";
+        for (std::size_t idx = 0; idx < data.param_types.size(); ++idx) {
+          file << (idx == 0 ? "" : ", ") << "a_" << idx;
+        }
+        file << ");\n";
+        file << "}\n";
+        continue;
+      }
       file << "  struct __attribute__((packed)) {\n";
       for (std::size_t idx = 0; idx < data.param_types.size(); ++idx) {
         auto& type = data.param_types[idx];
@@ -477,6 +525,16 @@ void GenerateThunkLibsAction::OnAnalysisComplete(clang::ASTContext& context) {
           fmt::print(file, "AllocateHostTrampolineForGuestFunction(a_{});\n", idx);
         }
       }
+      if (data.batchable) {
+        file << "  if (!FEXBatchAppend(fexbatch_buffer, " << batch_index++ << ", args)) {\n";
+        file << "    fexthunks_" << libname << "_" << function_name << "(&args);\n";
+        file << "  }\n";
+        file << "}\n";
+        continue;
+      }
+      if (has_batchable) {
+        file << "  FEXBatchFlush();\n";
+      }
       file << "  fexthunks_" << libname << "_" << function_name << "(&args);\n";
       if (!is_void) {
         file << "  return args.rv;\n";
@@ -601,6 +659,35 @@ void GenerateThunkLibsAction::OnAnalysisComplete(clang::ASTContext& context) {
         }
       }
 
+      // Register ABI entrypoints take the guest argument registers as-is.
+      // Guest and host share the LP64 data model, so integers only need truncating to their declared size.
+      if (uses_register_abi(thunk)) {
+        file << "static uint64_t fexfn_regabi_" << libname << "_" << function_name << "(";
+        for (std::size_t idx = 0; idx < thunk.param_types.size(); ++idx) {
+          file << (idx == 0 ? "" : ", ") << "uint64_t a_" << idx;
+        }
+        file << ") {\n";
+
+        auto format_param = [&](std::size_t idx) {
+          auto& type = thunk.param_types[idx];
+          auto type_name = get_type_name(context, type.getTypePtr());
+          if (type->isPointerType()) {
+            return fmt::format("reinterpret_cast<{}>(a_{})", type_name, idx);
+          }
+          return fmt::format("static_cast<{}>(static_cast<uint{}_t>(a_{}))", type_name, context.getTypeSize(type), idx);
+        };
+        auto call = fmt::format("fexldr_ptr_{}_{}({})", libname, function_name, format_function_args(thunk, format_param));
+        if (thunk.return_type->isVoidType()) {
+          fmt::print(file, "  {};\n  return 0;\n", call);
+        } else if (thunk.return_type->isPointerType()) {
+          fmt::print(file, "  return reinterpret_cast<uint64_t>({});\n", call);
+        } else {
+          fmt::print(file, "  return static_cast<uint64_t>({});\n", call);
+        }
+        file << "}\n";
+        continue;
+      }
+
       // Packed argument structs used in fexfn_unpack_*
       auto GeneratePackedArgs = [&](const auto& function_name, const ThunkedFunction& thunk) -> std::string {
         std::string struct_name = "fexfn_packed_args_" + libname + "_" + function_name;
@@ -671,6 +758,11 @@ void GenerateThunkLibsAction::OnAnalysisComplete(clang::ASTContext& context) {
             param_type->getPointeeType()->isBuiltinType() /* TODO: handle size_t. Actually, properly check for data layout compatibility */) {
           // Fully compatible
           fmt::print(file, "  host_layout<{}> a_{} {{ args->a_{} }};\n", get_type_name(context, param_type.getTypePtr()), param_idx, param_idx);
+        } else if (pointee_compat == TypeCompatibility::Repackable && thunk.param_annotations[param_idx].array_size_param) {
+          // Repack all array elements at once into scratch memory
+          auto guest_size = guest_abi.at(param_type->getPointeeType().getUnqualifiedType().getAsString()).get_if_simple_or_struct()->size_bits / 8;
+          fmt::print(file, "  auto a_{} = make_repack_array_wrapper<{}>(args->a_{}, args->a_{}.data, {});\n", param_idx,
+                     get_type_name_with_nonconst_pointee(param_type), param_idx, *thunk.param_annotations[param_idx].array_size_param, guest_size);
         } else if (pointee_compat == TypeCompatibility::Repackable) {
           // TODO: Require opt-in for this to be emitted since it's single-element only; otherwise, pointers-to-arrays arguments will cause stack trampling
           fmt::print(file, "  auto a_{} = make_repack_wrapper<{}>(args->a_{});\n", param_idx,
@@ -725,15 +817,40 @@ void GenerateThunkLibsAction::OnAnalysisComplete(clang::ASTContext& context) {
     }
     file << "}\n";
 
+    // Unpacking functions of batchable functions, in the order assigned by the guest
+    if (has_batchable) {
+      file << "static void (*const fexbatch_unpackers[])(void*) = {\n";
+      for (auto& thunk : thunks) {
+        if (thunk.batchable) {
+          fmt::print(file, "  (void(*)(void *))&fexfn_unpack_{}_{},\n", libname, thunk.function_name);
+        }
+      }
+      file << "};\n";
+      fmt::print(file, "static void fexfn_unpack_{}_fexbatch_flush(void* argsv) {{\n", libname);
+      file << "  fexfn_run_batched_calls(argsv, fexbatch_unpackers);\n";
+      file << "}\n";
+    }
+
     // Endpoints for Guest->Host invocation of API functions
     file << "static ExportEntry exports[] = {\n";
     for (auto& thunk : thunks) {
       const auto& function_name = thunk.function_name;
-      auto sha256 = get_sha256(function_name, true);
+      auto sha256 = get_thunk_sha256(thunk);
+      if (uses_register_abi(thunk)) {
+        fmt::print(file, "  {{(uint8_t*)\"\\x{:02x}\", (void(*)(void *))&fexfn_regabi_{}_{}, EXPORT_FLAG_REGISTER_ABI}}, // {}:{}\n",
+                   fmt::join(sha256, "\\x"), libname, function_name, libname, function_name);
+        continue;
+      }
       fmt::print(file, "  {{(uint8_t*)\"\\x{:02x}\", (void(*)(void *))&fexfn_unpack_{}_{}}}, // {}:{}\n", fmt::join(sha256, "\\x"), libname,
                  function_name, libname, function_name);
     }
 
+    if (has_batchable) {
+      auto sha256 = get_sha256("fexbatch_flush", true);
+      fmt::print(file, "  {{(uint8_t*)\"\\x{:02x}\", &fexfn_unpack_{}_fexbatch_flush}}, // {}:fexbatch_flush\n", fmt::join(sha256, "\\x"), libname,
+                 libname);
+    }
+
     // Endpoints for Guest->Host invocation of runtime host-function pointers
     // NOTE: The function parameters may differ slightly between guest and host,
     //       e.g. due to differing sizes or due to data layout differences.
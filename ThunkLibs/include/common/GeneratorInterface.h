@@ -3,6 +3,22 @@ struct returns_guest_pointer {};
 struct custom_host_impl {};
 struct custom_guest_entrypoint {};
 
+// Function annotation to pass arguments in the guest argument registers
+// straight to the host function instead of through a packed argument struct
+// on the guest stack.
+// Only applies to 64-bit guests; 32-bit guests keep using the packed ABI.
+// Requires at most six integer or pointer parameters and an integer, pointer
+// or void return type. Pointees must be builtin types or have compatible data layout.
+struct register_abi {};
+
+// Function annotation to defer calls to a per-thread buffer on the guest side.
+// Buffered calls are executed on the host in a single transition, at the latest
+// on the next non-batchable call into the same library.
+// Requires a void return type and parameters that don't point to guest memory
+// (pointers to opaque types are allowed), since pointees may change before the
+// call is executed.
+struct batchable {};
+
 struct generate_guest_symtable {};
 struct indirect_guest_calls {};
 
@@ -45,6 +61,12 @@ struct opaque_type : type_annotation_base {};
 // The type passed to Host will be guest_layout<pointee_type>*.
 struct ptr_passthrough {};
 
+// Function parameter annotation.
+// The pointer refers to an array with as many elements as given by the integer parameter at index CountParam.
+// Elements with incompatible data layout are repacked in bulk into per-thread scratch memory.
+template<int CountParam>
+struct array_size_param {};
+
 // Type / Function parameter annotation.
 // Assume objects of the given type are compatible across architectures,
 // even if the generator can't automatically prove this. For pointers, this refers to the pointee type.
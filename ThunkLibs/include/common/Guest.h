@@ -1,5 +1,6 @@
 #pragma once
 #include <stdint.h>
+#include <string.h>
 #include <type_traits>
 
 #include "PackedArguments.h"
@@ -103,6 +104,67 @@ inline bool IsLibLoaded(const char* libname) {
   return argsrv.rv;
 }
 
+// Calls to functions annotated with fexgen::batchable are deferred to a per-thread
+// buffer and executed on the host in a single transition. The buffer is flushed on
+// the next non-batchable call into the same library, before returning from a guest
+// callback, when it runs full, and on thread exit.
+//
+// Each record is a FEXBatchRecord header followed by the packed arguments of the call.
+struct FEXBatchRecord {
+  uint32_t Index; // Position of the function in the library's list of batchable functions
+  uint32_t Size;  // Size of the record including this header, padded to 8 bytes
+};
+
+struct FEXBatchFlushArgs {
+  uint64_t Data;
+  uint64_t Size;
+};
+
+struct FEXBatchBuffer {
+  static constexpr uint32_t Capacity = 16 * 1024;
+
+  // Set by the generated guest code of the owning thunk library.
+  // This header is shared by all thunk libraries, so it can't refer to any library's flush function by name.
+  void (*Flush)();
+
+  // Records in [Begin, Used) are pending. Records before Begin are being run on the host by an outer flush,
+  // calls batched by guest callbacks during that flush are appended after them.
+  uint32_t Begin;
+  uint32_t Used;
+  alignas(8) uint8_t Data[Capacity];
+
+  ~FEXBatchBuffer() {
+    Flush();
+  }
+};
+
+// Flushes the calling thread's batch buffer of the thunk library this header is compiled into.
+// Defined by the library's generated guest code, hidden so that every thunk library resolves it to its own definition.
+__attribute__((visibility("hidden"))) void FEXBatchFlush();
+
+// Returns false if the record doesn't fit even after flushing, the caller must then make the call directly.
+// This only happens for calls batched by a guest callback while the host runs a batch that filled the buffer.
+template<typename PackedArgs>
+[[nodiscard]]
+inline bool FEXBatchAppend(FEXBatchBuffer& Buffer, uint32_t Index, const PackedArgs& Args) {
+  constexpr uint32_t RecordSize = (sizeof(FEXBatchRecord) + sizeof(PackedArgs) + 7) & ~7U;
+  static_assert(RecordSize <= FEXBatchBuffer::Capacity);
+
+  if (Buffer.Used + RecordSize > FEXBatchBuffer::Capacity) {
+    Buffer.Flush();
+    if (Buffer.Used + RecordSize > FEXBatchBuffer::Capacity) {
+      return false;
+    }
+  }
+
+  auto Record = reinterpret_cast<FEXBatchRecord*>(&Buffer.Data[Buffer.Used]);
+  Record->Index = Index;
+  Record->Size = RecordSize;
+  memcpy(Record + 1, &Args, sizeof(PackedArgs));
+  Buffer.Used += RecordSize;
+  return true;
+}
+
 // Helper template that packs the given arguments and invokes a thunk at the
 // address stored in the `r11` guest register. The signature of the thunk must
 // be specified at compile-time via the Thunk template parameter.
@@ -148,6 +210,7 @@ inline Result CallHostFunction(Args... args) {
     // Return value not explicitly initialized since an initializer would fail to compile for the void case
   };
 
+  FEXBatchFlush();
   Thunk(reinterpret_cast<void*>(&packed_args));
 
   if constexpr (!std::is_void_v<Result>) {
@@ -196,6 +259,9 @@ struct CallbackUnpack<Result(Args...)> {
     auto callback = reinterpret_cast<fn_t*>(cb);
     auto args = reinterpret_cast<PackedArguments<Result, Args...>*>(argsv);
     Invoke(callback, *args);
+
+    // The host resumes right after this, so calls batched by the callback must run first
+    FEXBatchFlush();
   }
 };
 
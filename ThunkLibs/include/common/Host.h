@@ -46,11 +46,43 @@ static typename function_traits<decltype(Fn)>::result_t fexfn_type_erased_unpack
   return Fn(reinterpret_cast<args_t>(argsv));
 }
 
+// Export flag for thunks generated with fexgen::register_abi.
+// fn takes the six guest argument registers as uint64_t and returns the result in a uint64_t instead of a packed argument struct.
+constexpr uint32_t EXPORT_FLAG_REGISTER_ABI = 1U << 0;
+
 struct ExportEntry {
   uint8_t* sha256;
   void (*fn)(void*);
+  uint32_t flags;
+};
+
+// Layout of deferred calls recorded by the guest for fexgen::batchable functions, see common/Guest.h
+struct FEXBatchRecord {
+  uint32_t Index;
+  uint32_t Size;
 };
 
+// Runs all calls in a guest batch buffer in order of recording
+template<std::size_t N>
+inline void fexfn_run_batched_calls(void* argsv, void (*const (&unpackers)[N])(void*)) {
+  struct {
+    uint64_t Data;
+    uint64_t Size;
+  } args;
+  memcpy(&args, argsv, sizeof(args));
+
+  auto data = reinterpret_cast<uint8_t*>(args.Data);
+  for (uint64_t offset = 0; offset < args.Size;) {
+    auto record = reinterpret_cast<FEXBatchRecord*>(data + offset);
+    if (record->Index >= N || record->Size <= sizeof(FEXBatchRecord)) {
+      fprintf(stderr, "FATAL: Invalid record in batched thunk calls\n");
+      std::abort();
+    }
+    unpackers[record->Index](record + 1);
+    offset += record->Size;
+  }
+}
+
 typedef void fex_call_callback_t(uintptr_t callback, void* arg0, void* arg1);
 
 #define EXPORTS(name)                       \
@@ -382,6 +414,138 @@ static repack_wrapper<T, GuestT> make_repack_wrapper(guest_layout<GuestT>& orig_
   return {orig_arg};
 }
 
+// Per-thread scratch memory for repacked arguments.
+// Wrappers release their allocations in reverse order of construction, so
+// the arena is managed as a stack. Requests that don't fit are served from
+// the heap instead.
+class thunk_scratch_arena {
+public:
+  static constexpr std::size_t capacity = 64 * 1024;
+
+  static thunk_scratch_arena& get() {
+    static thread_local thunk_scratch_arena arena;
+    return arena;
+  }
+
+  // Stores the previous top of the arena in restore_point, which must be passed to release
+  void* allocate(std::size_t size, std::size_t align, std::size_t& restore_point) {
+    restore_point = used;
+    const std::size_t offset = (used + align - 1) & ~(align - 1);
+    if (offset + size > capacity) {
+      auto ptr = std::aligned_alloc(align, (size + align - 1) & ~(align - 1));
+      if (!ptr) {
+        fprintf(stderr, "FATAL: Failed to allocate %zu bytes for repacked thunk arguments\n", size);
+        std::abort();
+      }
+      return ptr;
+    }
+    used = offset + size;
+    return data + offset;
+  }
+
+  void release(void* ptr, std::size_t restore_point) {
+    if (ptr < data || ptr >= data + capacity) {
+      std::free(ptr);
+      return;
+    }
+    used = restore_point;
+  }
+
+private:
+  alignas(16) uint8_t data[capacity];
+  std::size_t used = 0;
+};
+
+// Equivalent of repack_wrapper for pointers to arrays of known size.
+// All elements are repacked into scratch memory up-front, and exit-repacked
+// on scope exit. If the element type has compatible data layout, the guest
+// array is passed through without any copies.
+// Guest elements are addressed using the guest type size, since guest_layout
+// doesn't include tail padding.
+template<typename T, typename GuestT>
+struct repack_array_wrapper {
+  static_assert(std::is_pointer_v<T>);
+
+  using PointeeT = std::remove_cv_t<std::remove_pointer_t<T>>;
+  static constexpr bool is_compatible = has_compatible_data_layout<T> && std::is_same_v<T, GuestT>;
+
+  guest_layout<GuestT>& orig_arg;
+  std::size_t count;
+  std::size_t guest_stride;
+  host_layout<PointeeT>* data = nullptr;
+  std::size_t restore_point;
+
+  auto& guest_element(std::size_t index) {
+    using GuestElementT = std::remove_reference_t<decltype(*orig_arg.get_pointer())>;
+    return *reinterpret_cast<GuestElementT*>(reinterpret_cast<uintptr_t>(orig_arg.get_pointer()) + index * guest_stride);
+  }
+
+  repack_array_wrapper(guest_layout<GuestT>& orig_arg_, std::size_t count_, std::size_t guest_stride_)
+    : orig_arg(orig_arg_)
+    , count(count_)
+    , guest_stride(guest_stride_) {
+    if constexpr (!is_compatible) {
+      if (!orig_arg.get_pointer() || !count) {
+        return;
+      }
+
+      data = static_cast<host_layout<PointeeT>*>(
+        thunk_scratch_arena::get().allocate(sizeof(host_layout<PointeeT>) * count, alignof(host_layout<PointeeT>), restore_point));
+      for (std::size_t i = 0; i < count; ++i) {
+        new (&data[i]) host_layout<PointeeT> {guest_element(i)};
+        if constexpr (std::is_class_v<PointeeT>) {
+          fex_apply_custom_repacking_entry(data[i], guest_element(i));
+        }
+      }
+    }
+  }
+
+  repack_array_wrapper(const repack_array_wrapper&) = delete;
+
+  ~repack_array_wrapper() {
+    if constexpr (!is_compatible) {
+      if (!data) {
+        return;
+      }
+
+      for (std::size_t i = 0; i < count; ++i) {
+        if constexpr (std::is_class_v<PointeeT>) {
+          // NOTE: Like repack_wrapper, automatic exit repacking is skipped for const pointees
+          if (!fex_apply_custom_repacking_exit(guest_element(i), data[i])) {
+            if constexpr (!std::is_const_v<std::remove_pointer_t<T>>) {
+              guest_element(i) = to_guest(data[i]);
+            }
+          }
+        }
+        data[i].~host_layout<PointeeT>();
+      }
+      thunk_scratch_arena::get().release(data, restore_point);
+    }
+  }
+
+  operator PointeeT*() {
+    if constexpr (is_compatible) {
+      return reinterpret_cast<PointeeT*>(uintptr_t {orig_arg.data});
+    } else {
+      static_assert(sizeof(PointeeT) == sizeof(host_layout<PointeeT>));
+      static_assert(alignof(PointeeT) == alignof(host_layout<PointeeT>));
+      return data ? &data->data : nullptr;
+    }
+  }
+};
+
+template<typename T, typename GuestT, typename CountT>
+static repack_array_wrapper<T, GuestT> make_repack_array_wrapper(guest_layout<GuestT>& orig_arg, CountT count, std::size_t guest_stride) {
+  static_assert(std::is_integral_v<CountT>, "Array size parameters must be integers");
+  if constexpr (std::is_signed_v<CountT>) {
+    if (count < 0) {
+      fprintf(stderr, "FATAL: Negative array size %lld passed to thunk\n", static_cast<long long>(count));
+      std::abort();
+    }
+  }
+  return {orig_arg, static_cast<std::size_t>(count), guest_stride};
+}
+
 template<typename T>
 T& unwrap_host(host_layout<T>& val) {
   return val.data;
@@ -392,6 +556,11 @@ T* unwrap_host(repack_wrapper<T*, T2>& val) {
   return val;
 }
 
+template<typename T, typename T2>
+T* unwrap_host(repack_array_wrapper<T*, T2>& val) {
+  return val;
+}
+
 template<typename T>
 struct host_to_guest_convertible {
   const host_layout<T>& from;
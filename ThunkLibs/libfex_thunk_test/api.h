@@ -53,6 +53,10 @@ uint32_t QueryOffsetOf(ReorderingType*, int index);
 // Uses assume_compatible_data_layout to skip repacking
 uint32_t GetReorderingTypeMemberWithoutRepacking(const ReorderingType*, int index);
 
+// Uses array_size_param to repack all count elements
+void ModifyReorderingTypeArray(ReorderingType* data, int count);
+uint64_t SumReorderingTypeArray(const ReorderingType* data, int count);
+
 /// Interfaces used to test assisted struct repacking
 
 // We enable custom repacking on the "data" member, with repacking code that
@@ -76,6 +80,40 @@ enum DivType : uint32_t {};
 int FunctionWithDivergentSignature(DivType, DivType, DivType, DivType);
 
 
+/// Interfaces used to test the register_abi annotation
+
+uint32_t GetDoubledValueRegisterABI(uint32_t);
+
+// Sums up all arguments, checking that each of them is narrowed to its declared size
+int64_t SumRegisterABIArgs(int8_t, uint16_t, int32_t, int64_t, const uint32_t*, bool);
+
+void StoreRegisterABIValue(uint32_t* dst, uint32_t value);
+
+
+/// Interfaces used to test the batchable annotation
+
+// Appends a value to a per-thread log; batchable
+void AppendBatchedValue(uint32_t);
+// Overwrites the data of an OpaqueType; batchable
+void SetOpaqueTypeDataBatched(OpaqueType*, uint32_t data);
+
+uint32_t GetBatchedValueCount();
+// Order-dependent hash of all logged values
+uint64_t GetBatchedValueChecksum();
+void ResetBatchedValues();
+
+
+/// Interfaces used to benchmark thunk call overhead
+
+void DoNothing();
+
+// Calls the given guest function once and returns its result
+uint32_t InvokeCallback(uint32_t (*)(uint32_t), uint32_t);
+
+// Calls the given guest function with the values 0 to count-1 and returns the sum of the results
+uint32_t InvokeCallbackRepeatedly(uint32_t (*)(uint32_t), uint32_t count);
+
+
 /// Interfaces used to test Vulkan-like APIs
 
 // Equivalent of VkStructureType
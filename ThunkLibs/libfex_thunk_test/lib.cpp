@@ -54,6 +54,21 @@ void ModifyReorderingTypeMembers(ReorderingType* data) {
   data->b += 2;
 }
 
+void ModifyReorderingTypeArray(ReorderingType* data, int count) {
+  for (int i = 0; i < count; ++i) {
+    ModifyReorderingTypeMembers(&data[i]);
+  }
+}
+
+uint64_t SumReorderingTypeArray(const ReorderingType* data, int count) {
+  // Weighs the members differently so swapped members change the result
+  uint64_t sum = 0;
+  for (int i = 0; i < count; ++i) {
+    sum += data[i].a + 2 * uint64_t {data[i].b};
+  }
+  return sum;
+}
+
 int RanCustomRepack(CustomRepackedType* data) {
   return data->custom_repack_invoked;
 }
@@ -62,6 +77,57 @@ int FunctionWithDivergentSignature(DivType a, DivType b, DivType c, DivType d) {
   return ((uint8_t)a << 24) | ((uint8_t)b << 16) | ((uint8_t)c << 8) | (uint8_t)d;
 }
 
+uint32_t GetDoubledValueRegisterABI(uint32_t input) {
+  return 2 * input;
+}
+
+int64_t SumRegisterABIArgs(int8_t a, uint16_t b, int32_t c, int64_t d, const uint32_t* e, bool f) {
+  return a + b + c + d + *e + (f ? 1 : 0);
+}
+
+void StoreRegisterABIValue(uint32_t* dst, uint32_t value) {
+  *dst = value;
+}
+
+static thread_local uint32_t BatchedValueCount;
+static thread_local uint64_t BatchedValueChecksum;
+
+void AppendBatchedValue(uint32_t value) {
+  ++BatchedValueCount;
+  BatchedValueChecksum = BatchedValueChecksum * 31 + value;
+}
+
+void SetOpaqueTypeDataBatched(OpaqueType* value, uint32_t data) {
+  value->data = data;
+}
+
+uint32_t GetBatchedValueCount() {
+  return BatchedValueCount;
+}
+
+uint64_t GetBatchedValueChecksum() {
+  return BatchedValueChecksum;
+}
+
+void ResetBatchedValues() {
+  BatchedValueCount = 0;
+  BatchedValueChecksum = 0;
+}
+
+void DoNothing() {}
+
+uint32_t InvokeCallback(uint32_t (*callback)(uint32_t), uint32_t value) {
+  return callback(value);
+}
+
+uint32_t InvokeCallbackRepeatedly(uint32_t (*callback)(uint32_t), uint32_t count) {
+  uint32_t ret = 0;
+  for (uint32_t i = 0; i != count; ++i) {
+    ret += callback(i);
+  }
+  return ret;
+}
+
 int ReadData1(TestStruct1* data, int depth) {
   auto* base = (TestBaseStruct*)data;
   for (int i = 0; i != depth; ++i) {
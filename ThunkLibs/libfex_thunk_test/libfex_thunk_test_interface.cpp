@@ -40,6 +40,14 @@ template<>
 struct fex_gen_param<GetReorderingTypeMemberWithoutRepacking, 0, const ReorderingType*> : fexgen::assume_compatible_data_layout {};
 template<>
 struct fex_gen_config<ModifyReorderingTypeMembers> {};
+template<>
+struct fex_gen_config<ModifyReorderingTypeArray> {};
+template<>
+struct fex_gen_param<ModifyReorderingTypeArray, 0, ReorderingType*> : fexgen::array_size_param<1> {};
+template<>
+struct fex_gen_config<SumReorderingTypeArray> {};
+template<>
+struct fex_gen_param<SumReorderingTypeArray, 0, const ReorderingType*> : fexgen::array_size_param<1> {};
 
 template<>
 struct fex_gen_config<QueryOffsetOf> : fexgen::custom_host_impl {};
@@ -54,6 +62,31 @@ struct fex_gen_config<RanCustomRepack> {};
 template<>
 struct fex_gen_config<FunctionWithDivergentSignature> {};
 
+template<>
+struct fex_gen_config<GetDoubledValueRegisterABI> : fexgen::register_abi {};
+template<>
+struct fex_gen_config<SumRegisterABIArgs> : fexgen::register_abi {};
+template<>
+struct fex_gen_config<StoreRegisterABIValue> : fexgen::register_abi {};
+
+template<>
+struct fex_gen_config<AppendBatchedValue> : fexgen::batchable {};
+template<>
+struct fex_gen_config<SetOpaqueTypeDataBatched> : fexgen::batchable {};
+template<>
+struct fex_gen_config<GetBatchedValueCount> {};
+template<>
+struct fex_gen_config<GetBatchedValueChecksum> {};
+template<>
+struct fex_gen_config<ResetBatchedValues> {};
+
+template<>
+struct fex_gen_config<DoNothing> {};
+template<>
+struct fex_gen_config<InvokeCallback> {};
+template<>
+struct fex_gen_config<InvokeCallbackRepeatedly> {};
+
 template<>
 struct fex_gen_config<&TestBaseStruct::Next> : fexgen::custom_repack {};
 template<>
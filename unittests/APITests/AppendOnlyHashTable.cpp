@@ -0,0 +1,117 @@
+// SPDX-License-Identifier: MIT
+#include <catch2/catch_test_macros.hpp>
+#include <Common/AppendOnlyHashTable.h>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace {
+// Puts every key in the same probe sequence, to cover collisions.
+struct CollidingHash {
+  size_t operator()(uint64_t) const noexcept {
+    return 0;
+  }
+};
+
+struct IdentityHash {
+  size_t operator()(uint64_t Key) const noexcept {
+    return Key;
+  }
+};
+
+// Initial capacity of the table, growth is triggered at 3/4 of it.
+constexpr size_t InitialCapacity = 64;
+
+std::array<uint64_t, 4 * InitialCapacity> Values;
+} // namespace
+
+TEST_CASE("AppendOnlyHashTable - empty") {
+  FEX::AppendOnlyHashTable<uint64_t, const uint64_t*, IdentityHash> Table;
+  CHECK(Table.Find(0) == nullptr);
+  CHECK(Table.Find(1234) == nullptr);
+}
+
+TEST_CASE("AppendOnlyHashTable - growth past the initial capacity") {
+  FEX::AppendOnlyHashTable<uint64_t, const uint64_t*, IdentityHash> Table;
+
+  for (size_t i = 0; i < Values.size(); ++i) {
+    Table.Insert(i, &Values[i]);
+    // Entries from before every growth must remain visible.
+    REQUIRE(Table.Find(0) == &Values[0]);
+    REQUIRE(Table.Find(i) == &Values[i]);
+  }
+
+  for (size_t i = 0; i < Values.size(); ++i) {
+    CHECK(Table.Find(i) == &Values[i]);
+  }
+  CHECK(Table.Find(Values.size()) == nullptr);
+}
+
+TEST_CASE("AppendOnlyHashTable - collisions") {
+  FEX::AppendOnlyHashTable<uint64_t, const uint64_t*, CollidingHash> Table;
+
+  for (size_t i = 0; i < InitialCapacity; ++i) {
+    Table.Insert(i, &Values[i]);
+  }
+
+  for (size_t i = 0; i < InitialCapacity; ++i) {
+    CHECK(Table.Find(i) == &Values[i]);
+  }
+  CHECK(Table.Find(InitialCapacity) == nullptr);
+}
+
+TEST_CASE("AppendOnlyHashTable - overwriting an existing key") {
+  FEX::AppendOnlyHashTable<uint64_t, const uint64_t*, CollidingHash> Table;
+  Table.Insert(1, &Values[0]);
+  Table.Insert(2, &Values[1]);
+
+  Table.Insert(1, &Values[2]);
+  CHECK(Table.Find(1) == &Values[2]);
+  CHECK(Table.Find(2) == &Values[1]);
+
+  // Overwriting reuses the slot of the key.
+  for (size_t i = 0; i < 4 * InitialCapacity; ++i) {
+    Table.Insert(2, &Values[i]);
+  }
+  CHECK(Table.Find(1) == &Values[2]);
+  CHECK(Table.Find(2) == &Values[4 * InitialCapacity - 1]);
+}
+
+TEST_CASE("AppendOnlyHashTable - concurrent readers during inserts") {
+  FEX::AppendOnlyHashTable<uint64_t, const uint64_t*, IdentityHash> Table;
+  constexpr size_t NumReaders = 4;
+
+  // Readers check that every key reported as published can be found, while the writer keeps growing the table.
+  std::atomic<size_t> Published {};
+  std::atomic<bool> Failed {};
+  std::vector<std::thread> Readers;
+  for (size_t i = 0; i < NumReaders; ++i) {
+    Readers.emplace_back([&]() {
+      size_t Count {};
+      do {
+        Count = Published.load(std::memory_order_acquire);
+        for (size_t Key = 0; Key < Count; ++Key) {
+          if (Table.Find(Key) != &Values[Key]) {
+            Failed = true;
+          }
+        }
+        if (Table.Find(Values.size()) != nullptr) {
+          Failed = true;
+        }
+      } while (Count != Values.size());
+    });
+  }
+
+  for (size_t i = 0; i < Values.size(); ++i) {
+    Table.Insert(i, &Values[i]);
+    Published.store(i + 1, std::memory_order_release);
+  }
+
+  for (auto& Reader : Readers) {
+    Reader.join();
+  }
+  CHECK_FALSE(Failed);
+}
@@ -0,0 +1,81 @@
+// SPDX-License-Identifier: MIT
+#include <catch2/catch_test_macros.hpp>
+#include <Interface/Core/JITBudget.h>
+
+#include <chrono>
+
+using FEXCore::Frontend::JITBudget;
+
+namespace {
+constexpr uint64_t MS = std::chrono::nanoseconds(std::chrono::milliseconds(1)).count();
+
+// Spends more than the whole window compiling, which keeps the budget under pressure for this window and the next.
+void Overrun(JITBudget& Budget) {
+  const auto Now = JITBudget::Now();
+  Budget.Accumulate(Now - 20 * MS, Now);
+}
+} // namespace
+
+TEST_CASE("JITBudget - disabled") {
+  JITBudget Budget;
+  Budget.Initialize(0);
+  CHECK(!Budget.IsEnabled());
+
+  Overrun(Budget);
+  CHECK(!Budget.UnderPressure());
+}
+
+TEST_CASE("JITBudget - pressure") {
+  JITBudget Budget;
+  Budget.Initialize(50);
+  CHECK(Budget.IsEnabled());
+  CHECK(!Budget.UnderPressure());
+
+  Overrun(Budget);
+  CHECK(Budget.UnderPressure());
+}
+
+TEST_CASE("JITBudget - promotion") {
+  JITBudget Budget;
+  Budget.Initialize(50);
+  CHECK(!Budget.PopPromotableBlock());
+
+  Budget.RecordReducedBlock(0x10000);
+  Budget.RecordReducedBlock(0x10ff0);
+  Budget.RecordReducedBlock(0x20010);
+  Budget.RecordReducedBlock(0x11000);
+
+  SECTION("Blocks aren't promoted while under pressure") {
+    Overrun(Budget);
+    CHECK(!Budget.PopPromotableBlock());
+  }
+
+  SECTION("Reduced blocks are promoted one at a time") {
+    // Most recently reduced first, blocks on the same page are handed out separately.
+    CHECK(Budget.PopPromotableBlock() == 0x11000);
+    CHECK(Budget.PopPromotableBlock() == 0x20010);
+    CHECK(Budget.PopPromotableBlock() == 0x10ff0);
+    CHECK(Budget.PopPromotableBlock() == 0x10000);
+    CHECK(!Budget.PopPromotableBlock());
+  }
+}
+
+TEST_CASE("JITBudget - reduced blocks are bounded") {
+  JITBudget Budget;
+  Budget.Initialize(50);
+
+  for (uint64_t i = 0; i < 5000; ++i) {
+    Budget.RecordReducedBlock(i << 12);
+  }
+
+  // Only the first 4096 are remembered.
+  uint64_t Promoted {};
+  uint64_t Last {};
+  while (auto Entry = Budget.PopPromotableBlock()) {
+    Last = *Entry;
+    ++Promoted;
+  }
+
+  CHECK(Promoted == 4096);
+  CHECK(Last == 0);
+}
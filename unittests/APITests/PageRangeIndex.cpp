@@ -0,0 +1,180 @@
+// SPDX-License-Identifier: MIT
+#include <catch2/catch_all.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <Common/PageRangeIndex.h>
+
+#include <FEXCore/fextl/vector.h>
+
+#include <random>
+
+namespace {
+// Straightforward page scans to check the index against.
+struct ReferencePages {
+  fextl::vector<bool> Used = fextl::vector<bool>(FEX::PageRangeIndex::NumPages);
+
+  void Set(uint64_t Page, uint64_t Pages, bool Value) {
+    for (uint64_t i = Page; i < std::min(Page + Pages, FEX::PageRangeIndex::NumPages); ++i) {
+      Used[i] = Value;
+    }
+  }
+
+  uint64_t FindFirstFit(uint64_t Start, uint64_t Pages) const {
+    uint64_t Run = 0;
+    for (uint64_t Page = Start; Page < Used.size(); ++Page) {
+      Run = Used[Page] ? 0 : Run + 1;
+      if (Run == Pages) {
+        return Page + 1 - Pages;
+      }
+    }
+    return FEX::PageRangeIndex::NoRange;
+  }
+
+  uint64_t FindLastFit(uint64_t Start, uint64_t Pages) const {
+    uint64_t Run = 0;
+    for (uint64_t Page = std::min<uint64_t>(Start + 1, Used.size()); Page-- > 0;) {
+      Run = Used[Page] ? 0 : Run + 1;
+      if (Run == Pages) {
+        return Page;
+      }
+    }
+    return FEX::PageRangeIndex::NoRange;
+  }
+};
+
+struct TraceOp {
+  bool Map;
+  uint32_t Id;
+  uint32_t Pages;
+};
+
+// Mimics a 32-bit process churning through a mix of small allocations and large mappings.
+fextl::vector<TraceOp> GenerateTrace(size_t NumOps) {
+  std::mt19937 Rand {0x32b17};
+  fextl::vector<TraceOp> Trace;
+  fextl::vector<uint32_t> Live;
+  uint32_t NextId = 0;
+
+  for (size_t i = 0; i < NumOps; ++i) {
+    if (!Live.empty() && Rand() % 20 < 9) {
+      const size_t Index = Rand() % Live.size();
+      Trace.push_back({false, Live[Index], 0});
+      Live[Index] = Live.back();
+      Live.pop_back();
+    } else {
+      const uint32_t Pages = Rand() % 16 == 0 ? 32 + Rand() % 256 : 1 + Rand() % 16;
+      Trace.push_back({true, NextId, Pages});
+      Live.push_back(NextId++);
+    }
+  }
+  return Trace;
+}
+
+// Replays the trace with top-down allocation like the 32-bit allocator, returns the number of failed maps.
+size_t ReplayTrace(const fextl::vector<TraceOp>& Trace) {
+  FEX::PageRangeIndex Index;
+  Index.SetUsed(0, 16);
+  Index.SetUsed(FEX::PageRangeIndex::NumPages - 1, 1);
+
+  struct Mapping {
+    uint64_t Page;
+    uint64_t Pages;
+  };
+  fextl::vector<Mapping> Mappings(Trace.size());
+  uint64_t LastScanLocation = FEX::PageRangeIndex::NumPages - 1;
+  size_t Failed = 0;
+
+  for (const auto& Op : Trace) {
+    if (!Op.Map) {
+      const auto& Map = Mappings[Op.Id];
+      Index.SetFree(Map.Page, Map.Pages);
+      continue;
+    }
+
+    uint64_t Page = Index.FindLastFit(LastScanLocation, Op.Pages);
+    if (Page == FEX::PageRangeIndex::NoRange) {
+      Page = Index.FindLastFit(FEX::PageRangeIndex::NumPages - 1, Op.Pages);
+    }
+
+    if (Page == FEX::PageRangeIndex::NoRange) {
+      Mappings[Op.Id] = {};
+      ++Failed;
+      continue;
+    }
+
+    Index.SetUsed(Page, Op.Pages);
+    Mappings[Op.Id] = {Page, Op.Pages};
+    LastScanLocation = Page;
+  }
+
+  return Failed;
+}
+} // anonymous namespace
+
+TEST_CASE("PageRangeIndex - empty") {
+  FEX::PageRangeIndex Index;
+  CHECK(Index.FindFirstFit(0, 1) == 0);
+  CHECK(Index.FindFirstFit(0, FEX::PageRangeIndex::NumPages) == 0);
+  CHECK(Index.FindFirstFit(1, FEX::PageRangeIndex::NumPages) == FEX::PageRangeIndex::NoRange);
+  CHECK(Index.FindLastFit(FEX::PageRangeIndex::NumPages - 1, 16) == FEX::PageRangeIndex::NumPages - 16);
+  CHECK(Index.IsRangeFree(0, FEX::PageRangeIndex::NumPages));
+  CHECK_FALSE(Index.IsRangeFree(1, FEX::PageRangeIndex::NumPages));
+}
+
+TEST_CASE("PageRangeIndex - fragmented") {
+  FEX::PageRangeIndex Index;
+  // Every other page is used up to 0x1000, leaving only single page holes.
+  for (uint64_t Page = 0; Page < 0x1000; Page += 2) {
+    Index.SetUsed(Page, 1);
+  }
+
+  CHECK(Index.FindFirstFit(0, 1) == 1);
+  CHECK(Index.FindFirstFit(0, 2) == 0x1000 - 1);
+  CHECK(Index.FindLastFit(0x800, 1) == 0x7FF);
+  CHECK(Index.FindLastFit(0x800, 2) == FEX::PageRangeIndex::NoRange);
+
+  // Joins up with the free page at 0xFF.
+  Index.SetFree(0x100, 0x10);
+  CHECK(Index.FindFirstFit(0, 0x10) == 0xFF);
+  CHECK(Index.FindLastFit(0x800, 0x10) == 0x100);
+  CHECK(Index.FindLastFit(0x800, 0x11) == 0xFF);
+  CHECK(Index.IsRangeFree(0xFF, 0x11));
+  CHECK_FALSE(Index.IsRangeFree(0xFF, 0x12));
+}
+
+TEST_CASE("PageRangeIndex - matches page scan") {
+  FEX::PageRangeIndex Index;
+  ReferencePages Reference;
+  std::mt19937_64 Rand {0x1234};
+
+  for (size_t i = 0; i < 4000; ++i) {
+    const uint64_t Page = Rand() % FEX::PageRangeIndex::NumPages;
+    const uint64_t Pages = 1 + Rand() % (Rand() % 4 == 0 ? 5000 : 100);
+    const bool Used = Rand() % 3 != 0;
+    if (Used) {
+      Index.SetUsed(Page, Pages);
+    } else {
+      Index.SetFree(Page, Pages);
+    }
+    Reference.Set(Page, Pages, Used);
+
+    if (i % 16 == 0) {
+      const uint64_t Start = Rand() % FEX::PageRangeIndex::NumPages;
+      const uint64_t Length = 1 + Rand() % (Rand() % 2 ? 300 : 40000);
+      REQUIRE(Index.FindFirstFit(Start, Length) == Reference.FindFirstFit(Start, Length));
+      REQUIRE(Index.FindLastFit(Start, Length) == Reference.FindLastFit(Start, Length));
+    }
+  }
+}
+
+TEST_CASE("PageRangeIndex - trace replay") {
+  const auto Trace = GenerateTrace(20'000);
+  CHECK(ReplayTrace(Trace) == 0);
+}
+
+TEST_CASE("PageRangeIndex - trace replay benchmark", "[.][benchmark]") {
+  const auto Trace = GenerateTrace(200'000);
+
+  BENCHMARK("top-down mmap/munmap trace") {
+    return ReplayTrace(Trace);
+  };
+}
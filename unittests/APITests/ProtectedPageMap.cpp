@@ -0,0 +1,112 @@
+// SPDX-License-Identifier: MIT
+#include <catch2/catch_test_macros.hpp>
+#include <Common/ProtectedPageMap.h>
+
+#include <FEXCore/Utils/TypeDefines.h>
+
+namespace {
+constexpr uint64_t PageSize = FEXCore::Utils::FEX_PAGE_SIZE;
+constexpr uint64_t FourGiB = 1ULL << 32;
+} // namespace
+
+TEST_CASE("ProtectedPageMap - empty") {
+  FEX::ProtectedPageMap Map;
+  CHECK(!Map.IsMarked(0));
+  CHECK(!Map.IsMarked(0x1'0000));
+  CHECK(!Map.IsMarked((1ULL << 47) - PageSize));
+  CHECK(!Map.IsAnyMarked(0, 1ULL << 40));
+  CHECK(!Map.MightBeProtected(0x1'0000));
+}
+
+TEST_CASE("ProtectedPageMap - mark and clear") {
+  FEX::ProtectedPageMap Map;
+  const uint64_t Base = 0x40'0000;
+
+  Map.Mark(Base, 3 * PageSize);
+  CHECK(!Map.IsMarked(Base - 1));
+  CHECK(Map.IsMarked(Base));
+  CHECK(Map.IsMarked(Base + PageSize + 123));
+  CHECK(Map.IsMarked(Base + 3 * PageSize - 1));
+  CHECK(!Map.IsMarked(Base + 3 * PageSize));
+  CHECK(Map.MightBeProtected(Base + PageSize));
+
+  CHECK(Map.IsAnyMarked(Base - PageSize, 2 * PageSize));
+  CHECK(!Map.IsAnyMarked(Base - 4 * PageSize, 4 * PageSize));
+  CHECK(!Map.IsAnyMarked(Base + 3 * PageSize, PageSize));
+
+  // Partial lengths cover the whole page.
+  Map.Clear(Base + PageSize, 1);
+  CHECK(Map.IsMarked(Base));
+  CHECK(!Map.IsMarked(Base + PageSize));
+  CHECK(Map.IsMarked(Base + 2 * PageSize));
+
+  Map.Clear(Base, 3 * PageSize);
+  CHECK(!Map.IsAnyMarked(Base, 3 * PageSize));
+}
+
+TEST_CASE("ProtectedPageMap - word and leaf boundaries") {
+  FEX::ProtectedPageMap Map;
+
+  // Crosses a 64 page bitmap word.
+  const uint64_t WordBase = 60 * PageSize;
+  Map.Mark(WordBase, 8 * PageSize);
+  for (uint64_t i = 0; i < 8; ++i) {
+    CHECK(Map.IsMarked(WordBase + i * PageSize));
+  }
+  CHECK(!Map.IsMarked(WordBase - PageSize));
+  CHECK(!Map.IsMarked(WordBase + 8 * PageSize));
+
+  // Crosses a 4GiB leaf.
+  const uint64_t LeafBase = FourGiB - 2 * PageSize;
+  Map.Mark(LeafBase, 4 * PageSize);
+  CHECK(Map.IsMarked(FourGiB - PageSize));
+  CHECK(Map.IsMarked(FourGiB));
+  CHECK(Map.IsMarked(FourGiB + PageSize));
+  CHECK(!Map.IsMarked(FourGiB + 2 * PageSize));
+  CHECK(Map.IsAnyMarked(FourGiB + PageSize, PageSize));
+
+  Map.Clear(FourGiB, 2 * PageSize);
+  CHECK(Map.IsMarked(FourGiB - PageSize));
+  CHECK(!Map.IsAnyMarked(FourGiB, 2 * PageSize));
+
+  // Addresses past the guest address space are never marked.
+  Map.Mark((1ULL << 47) - PageSize, 2 * PageSize);
+  CHECK(Map.IsMarked((1ULL << 47) - PageSize));
+  CHECK(!Map.IsMarked(1ULL << 47));
+}
+
+TEST_CASE("ProtectedPageMap - mremap carry-over") {
+  FEX::ProtectedPageMap Map;
+  const uint64_t OldBase = 0x7000'0000;
+  const uint64_t NewBase = 0x1'2000'0000;
+
+  // Same sequence as TrackMremap: the old range is checked, then replaced, then the new range inherits the mark.
+  Map.Mark(OldBase + PageSize, PageSize);
+
+  bool WasProtected {};
+  {
+    FEX::ProtectedPageMap::RemapGuard Guard {Map};
+    // Faults take the locked path while the remap is in flight, even on unmarked pages.
+    CHECK(Map.MightBeProtected(NewBase));
+    CHECK(!Map.IsMarked(NewBase));
+
+    WasProtected = Map.IsAnyMarked(OldBase, 4 * PageSize);
+    Map.Clear(OldBase, 4 * PageSize);
+    if (WasProtected) {
+      Map.Mark(NewBase, 8 * PageSize);
+    }
+  }
+
+  CHECK(WasProtected);
+  CHECK(!Map.IsAnyMarked(OldBase, 4 * PageSize));
+  CHECK(Map.IsMarked(NewBase));
+  CHECK(Map.IsMarked(NewBase + 8 * PageSize - 1));
+  CHECK(!Map.IsMarked(NewBase + 8 * PageSize));
+
+  // Once the guard is gone only marked pages might be protected.
+  CHECK(!Map.MightBeProtected(OldBase + PageSize));
+  CHECK(Map.MightBeProtected(NewBase));
+
+  // An unprotected range doesn't carry anything over.
+  CHECK(!Map.IsAnyMarked(0x9000'0000, 4 * PageSize));
+}
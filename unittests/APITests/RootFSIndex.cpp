@@ -0,0 +1,159 @@
+// SPDX-License-Identifier: MIT
+#include <catch2/catch_test_macros.hpp>
+#include <Common/RootFSIndex.h>
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace {
+struct TestEntry {
+  std::string Path;
+  uint32_t Mode;
+  std::string Target {};
+};
+
+// Serializes the entries the same way FEXServer does, they need to be sorted by path.
+std::vector<std::byte> BuildIndex(const std::vector<TestEntry>& Entries) {
+  std::vector<FEX::RootFSIndex::Entry> Out;
+  std::string Strings;
+  for (const auto& Entry : Entries) {
+    auto& New = Out.emplace_back(FEX::RootFSIndex::Entry {
+      .PathOffset = static_cast<uint32_t>(Strings.size()),
+      .PathLength = static_cast<uint32_t>(Entry.Path.size()),
+      .Mode = Entry.Mode,
+    });
+    Strings += Entry.Path;
+    New.TargetOffset = Strings.size();
+    New.TargetLength = Entry.Target.size();
+    Strings += Entry.Target;
+  }
+
+  const FEX::RootFSIndex::Header Head {
+    .Magic = FEX::RootFSIndex::MAGIC,
+    .Version = FEX::RootFSIndex::VERSION,
+    .NumEntries = static_cast<uint32_t>(Out.size()),
+    .StringTableSize = Strings.size(),
+  };
+
+  std::vector<std::byte> Data(sizeof(Head) + Out.size() * sizeof(FEX::RootFSIndex::Entry) + Strings.size());
+  auto Ptr = Data.data();
+  memcpy(Ptr, &Head, sizeof(Head));
+  Ptr += sizeof(Head);
+  memcpy(Ptr, Out.data(), Out.size() * sizeof(FEX::RootFSIndex::Entry));
+  Ptr += Out.size() * sizeof(FEX::RootFSIndex::Entry);
+  memcpy(Ptr, Strings.data(), Strings.size());
+  return Data;
+}
+
+const std::vector<TestEntry> Image = {
+  {"bin", S_IFLNK | 0777, "/usr/bin"},
+  {"etc", S_IFDIR | 0755},
+  {"etc/dangling", S_IFLNK | 0777, "/etc/missing"},
+  {"etc/passwd", S_IFREG | 0644},
+  {"lib", S_IFLNK | 0777, "usr/lib"},
+  {"usr", S_IFDIR | 0755},
+  {"usr/bin", S_IFDIR | 0755},
+  {"usr/bin/ls", S_IFREG | 0755},
+};
+
+using LookupResult = FEX::RootFSIndex::LookupResult;
+} // namespace
+
+TEST_CASE("RootFSIndex - Find") {
+  const auto Data = BuildIndex(Image);
+  FEX::RootFSIndex::View View;
+  REQUIRE(View.Init(Data));
+
+  const FEX::RootFSIndex::Entry* Entry {};
+
+  SECTION("Hit") {
+    REQUIRE(View.Find("etc/passwd", &Entry) == LookupResult::Found);
+    CHECK(View.GetPath(*Entry) == "etc/passwd");
+    CHECK(S_ISREG(Entry->Mode));
+
+    REQUIRE(View.Find("bin", &Entry) == LookupResult::Found);
+    CHECK(View.GetTarget(*Entry) == "/usr/bin");
+  }
+
+  SECTION("Miss") {
+    CHECK(View.Find("etc/shadow", &Entry) == LookupResult::Missing);
+    CHECK(View.Find("opt", &Entry) == LookupResult::Missing);
+    CHECK(View.Find("opt/file", &Entry) == LookupResult::Missing);
+  }
+
+  SECTION("Path longer than the stored entry") {
+    // Stored entries that are a prefix of the lookup must not match.
+    CHECK(View.Find("etc/passwd-", &Entry) == LookupResult::Missing);
+    CHECK(View.Find("usr/bin/lsof", &Entry) == LookupResult::Missing);
+    // A regular file can't have children.
+    CHECK(View.Find("etc/passwd/child", &Entry) == LookupResult::Missing);
+    // Going through a symlinked directory is left to the kernel.
+    CHECK(View.Find("bin/ls", &Entry) == LookupResult::Unknown);
+  }
+
+  SECTION("Non-canonical paths") {
+    CHECK(View.Find("", &Entry) == LookupResult::Unknown);
+    CHECK(View.Find("usr/", &Entry) == LookupResult::Unknown);
+    CHECK(View.Find("usr//bin", &Entry) == LookupResult::Unknown);
+    CHECK(View.Find("usr/./bin", &Entry) == LookupResult::Unknown);
+    CHECK(View.Find("usr/bin/../bin", &Entry) == LookupResult::Unknown);
+  }
+}
+
+TEST_CASE("RootFSIndex - no index") {
+  FEX::RootFSIndex::View View;
+  const FEX::RootFSIndex::Entry* Entry {};
+  CHECK(View.Find("etc/passwd", &Entry) == LookupResult::Unknown);
+
+  std::array<char[PATH_MAX], 2> TmpPaths;
+  const char* Path {};
+  CHECK(View.Resolve("/etc/passwd", true, TmpPaths, &Path) == LookupResult::Unknown);
+
+  // A malformed index isn't used either.
+  auto Data = BuildIndex(Image);
+  Data.pop_back();
+  CHECK_FALSE(View.Init(Data));
+  CHECK(View.Find("etc/passwd", &Entry) == LookupResult::Unknown);
+}
+
+TEST_CASE("RootFSIndex - Resolve") {
+  const auto Data = BuildIndex(Image);
+  FEX::RootFSIndex::View View;
+  REQUIRE(View.Init(Data));
+
+  std::array<char[PATH_MAX], 2> TmpPaths;
+  const char* Path {};
+
+  SECTION("Hit") {
+    REQUIRE(View.Resolve("/etc/passwd", true, TmpPaths, &Path) == LookupResult::Found);
+    CHECK(std::string_view {Path} == "etc/passwd");
+  }
+
+  SECTION("Miss") {
+    CHECK(View.Resolve("/etc/shadow", true, TmpPaths, &Path) == LookupResult::Missing);
+  }
+
+  SECTION("Absolute symlinks") {
+    REQUIRE(View.Resolve("/bin", true, TmpPaths, &Path) == LookupResult::Found);
+    CHECK(std::string_view {Path} == "usr/bin");
+
+    REQUIRE(View.Resolve("/bin", false, TmpPaths, &Path) == LookupResult::Found);
+    CHECK(std::string_view {Path} == "bin");
+
+    // Dangling symlinks resolve to their target.
+    REQUIRE(View.Resolve("/etc/dangling", true, TmpPaths, &Path) == LookupResult::Found);
+    CHECK(std::string_view {Path} == "etc/missing");
+  }
+
+  SECTION("Relative symlinks") {
+    // Left for the kernel to resolve.
+    REQUIRE(View.Resolve("/lib", true, TmpPaths, &Path) == LookupResult::Found);
+    CHECK(std::string_view {Path} == "lib");
+  }
+
+  SECTION("Path longer than the stored entry") {
+    CHECK(View.Resolve("/usr/bin/lsof", true, TmpPaths, &Path) == LookupResult::Missing);
+    CHECK(View.Resolve("/bin/ls", true, TmpPaths, &Path) == LookupResult::Unknown);
+  }
+}
@@ -0,0 +1,104 @@
+// SPDX-License-Identifier: MIT
+#include <catch2/catch_test_macros.hpp>
+#include <Common/RootFSPathCache.h>
+
+#include <array>
+#include <fcntl.h>
+#include <filesystem>
+#include <fstream>
+#include <stdlib.h>
+#include <unistd.h>
+
+namespace {
+// Temporary directory standing in for the rootfs.
+struct TemporaryRootFS {
+  TemporaryRootFS() {
+    REQUIRE(mkdtemp(Path) != nullptr);
+    FD = open(Path, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    REQUIRE(FD != -1);
+  }
+
+  ~TemporaryRootFS() {
+    close(FD);
+    std::filesystem::remove_all(Path);
+  }
+
+  void CreateFile(const char* Name) {
+    std::ofstream {std::filesystem::path(Path) / Name};
+  }
+
+  char Path[32] = "/tmp/fex_rootfs_cache_XXXXXX";
+  int FD {-1};
+};
+
+using LookupResult = FEX::RootFSPathCache::LookupResult;
+} // namespace
+
+TEST_CASE("RootFSPathCache - negative entries skip the rootfs") {
+  TemporaryRootFS RootFS;
+  FEX::RootFSPathCache Cache;
+  std::array<char, PATH_MAX> Resolved {};
+
+  CHECK(Cache.FindOrProbeNoFollow(RootFS.FD, "/missing", Resolved.data()) == LookupResult::NotInRootFS);
+  CHECK(Cache.GetMisses() == 1);
+  CHECK(Cache.GetNegativeHits() == 0);
+
+  // Once cached the path stays missing, the rootfs isn't probed again.
+  RootFS.CreateFile("missing");
+  CHECK(Cache.FindOrProbeNoFollow(RootFS.FD, "/missing", Resolved.data()) == LookupResult::NotInRootFS);
+  CHECK(Cache.FindOrProbeNoFollow(RootFS.FD, "/missing", Resolved.data()) == LookupResult::NotInRootFS);
+  CHECK(Cache.GetMisses() == 1);
+  CHECK(Cache.GetNegativeHits() == 2);
+
+  // Missing parent directories are negative as well.
+  CHECK(Cache.FindOrProbeNoFollow(RootFS.FD, "/missing_dir/file", Resolved.data()) == LookupResult::NotInRootFS);
+  CHECK(Cache.Find("/missing_dir/file", false, Resolved.data()) == LookupResult::NotInRootFS);
+}
+
+TEST_CASE("RootFSPathCache - positive entries") {
+  TemporaryRootFS RootFS;
+  FEX::RootFSPathCache Cache;
+  std::array<char, PATH_MAX> Resolved {};
+
+  RootFS.CreateFile("exists");
+  CHECK(Cache.FindOrProbeNoFollow(RootFS.FD, "/exists", Resolved.data()) == LookupResult::Resolved);
+  CHECK(std::string_view(Resolved.data()) == "exists");
+
+  Resolved.fill(0);
+  CHECK(Cache.FindOrProbeNoFollow(RootFS.FD, "/exists", Resolved.data()) == LookupResult::Resolved);
+  CHECK(std::string_view(Resolved.data()) == "exists");
+  CHECK(Cache.GetHits() == 1);
+  CHECK(Cache.GetMisses() == 1);
+}
+
+TEST_CASE("RootFSPathCache - symlink modes are separate") {
+  FEX::RootFSPathCache Cache;
+  std::array<char, PATH_MAX> Resolved {};
+
+  Cache.InsertResolved("/usr/lib/libfoo.so", true, "usr/lib/libfoo.so.1");
+  Cache.InsertNotInRootFS("/usr/lib/libbar.so", true);
+
+  CHECK(Cache.Find("/usr/lib/libfoo.so", false, Resolved.data()) == LookupResult::Miss);
+  CHECK(Cache.Find("/usr/lib/libbar.so", false, Resolved.data()) == LookupResult::Miss);
+
+  CHECK(Cache.Find("/usr/lib/libfoo.so", true, Resolved.data()) == LookupResult::Resolved);
+  CHECK(std::string_view(Resolved.data()) == "usr/lib/libfoo.so.1");
+  CHECK(Cache.Find("/usr/lib/libbar.so", true, Resolved.data()) == LookupResult::NotInRootFS);
+}
+
+TEST_CASE("RootFSPathCache - fork hooks") {
+  FEX::RootFSPathCache Cache;
+  std::array<char, PATH_MAX> Resolved {};
+
+  Cache.LockBeforeFork();
+  Cache.UnlockAfterFork(false);
+  Cache.InsertNotInRootFS("/parent", false);
+
+  // The child drops the lock without unlocking it.
+  Cache.LockBeforeFork();
+  Cache.UnlockAfterFork(true);
+  Cache.InsertNotInRootFS("/child", false);
+
+  CHECK(Cache.Find("/parent", false, Resolved.data()) == LookupResult::NotInRootFS);
+  CHECK(Cache.Find("/child", false, Resolved.data()) == LookupResult::NotInRootFS);
+}
@@ -0,0 +1,80 @@
+%ifdef CONFIG
+{
+  "RegData": {
+    "RAX": "0xbd",
+    "RCX": "0x0",
+    "RDX": "0x7e",
+    "RSI": "0x0000000040000000",
+    "RDI": "0x8000000000000000",
+    "R8":  "0xc000000000000000",
+    "R9":  "0x0012345678000000",
+    "R10": "0x0000000000000020",
+    "R11": "0x0000000000002000"
+  },
+  "Env": { "FEX_UNALIGNEDATOMICRECOMPILETHRESHOLD": "4" }
+}
+%endif
+
+; Unaligned locked RMW ops executed in a loop. The first few iterations are handled
+; by the SIGBUS emulation, which queues the block to be recompiled with an inline
+; alignment check the next time the thread compiles code. The indirect jump between
+; the two passes forces that, so the second pass runs the guarded atomics.
+; The results must be the same on both paths.
+mov r15, 0xe0000000
+
+xor eax, eax
+mov [r15 + 8 * 0], rax
+mov [r15 + 8 * 1], rax
+mov [r15 + 8 * 2], rax
+mov [r15 + 8 * 3], rax
+mov [r15 + 8 * 4], rax
+mov [r15 + 8 * 5], rax
+mov [r15 + 8 * 6], rax
+mov [r15 + 8 * 7], rax
+mov dword [r15 + 35], 0x12345678
+
+mov r14d, 2
+
+.outer:
+mov ecx, 32
+
+.loop:
+; Across a 4 byte boundary
+lock add dword [r15 + 3], 1
+
+; Across a 16 byte boundary
+mov edx, 2
+lock xadd qword [r15 + 15], rdx
+
+; Across an 8 byte boundary, always succeeds
+mov eax, dword [r15 + 23]
+lea r9d, [rax + 3]
+lock cmpxchg dword [r15 + 23], r9d
+
+; An even number of negations leaves the value untouched
+lock neg dword [r15 + 35]
+
+; Alternates between aligned and unaligned addresses on the same instruction
+mov ebx, ecx
+and ebx, 1
+imul ebx, ebx, 9
+lock add dword [r15 + rbx + 48], 1
+
+dec ecx
+jnz .loop
+
+lea r12, [rel .next]
+jmp r12
+
+.next:
+dec r14d
+jnz .outer
+
+mov rsi, qword [r15 + 8 * 0]
+mov rdi, qword [r15 + 8 * 1]
+mov r8, qword [r15 + 8 * 2]
+mov r9, qword [r15 + 8 * 4]
+mov r10, qword [r15 + 8 * 6]
+mov r11, qword [r15 + 8 * 7]
+
+hlt
@@ -0,0 +1,185 @@
+%ifdef CONFIG
+{
+  "RegData": {
+      "XMM0": ["0x010F0000100F0E0E", "0x000000060010100F"],
+      "XMM1": ["0x1119392118391111", "0x0000311931101011"],
+      "XMM4": ["0x0000000000000000", "0x00FF000000000000"],
+      "XMM5": ["0xFFFF00000000FFFF", "0xFFFFFFFFFFFF0000"]
+  },
+  "HostFeatures": ["SSE4.2"]
+}
+%endif
+
+; Covers the string length and validity edge cases of the string compare
+; instructions that the other tests don't reach, like partial matches at the
+; end of the vector, empty strings, negative and saturated explicit lengths
+; and ranges with an odd number of elements.
+
+; Adjusts the result from LAHF and SETO so that we have a set of flags organized
+; like [OF, SF, ZF, AF, PF, CF] for storing into the .flags region
+; of memory.
+;
+; The first parameter is the byte offset to store the flag result
+; at in the .flags region of memory.
+;
+%macro ArrangeAndStoreFLAGS 1
+  lahf
+  seto bl
+  movzx bx, bl
+
+  shr ax, 8
+  shl bx, 5
+
+  mov di, ax
+  mov si, ax
+
+  ; Mask and shift
+  and di, 0b0000_0000_0000_0100 ; PF
+  and si, 0b0000_0000_0001_0000 ; AF
+  shr di, 1
+  shr si, 2
+
+  ; OR all of them together
+  or bx, di
+  or bx, si
+
+  ; Reclaim DI for getting ZF/SF and shift into place
+  mov di, ax
+  and di, 0b0000_0000_1100_0000 ; ZF and SF
+  shr di, 3
+
+  ; Finally mask and OR all of the bits together
+  and ax, 0b0000_0000_0000_0001 ; CF
+  or bx, ax
+  or bx, di
+
+  ; Store result to .flags memory
+  mov [rel .flags + %1], bl
+%endmacro
+
+; Loads both strings, sets the explicit lengths, performs the string
+; comparison and moves the result from RCX to a region of memory in
+; the .indices section specified by a byte offset.
+;
+; The first parameter is the byte offset to store the RCX result to.
+; The second and third parameters are the strings to compare.
+; The fourth and fifth parameters are the lengths to place in RAX and RDX.
+; The sixth parameter is the control values to pass to pcmpestri
+;
+%macro CompareAndStore 6
+  movaps xmm2, [rel %2]
+  movaps xmm3, [rel %3]
+  mov rax, %4
+  mov rdx, %5
+  pcmpestri xmm2, xmm3, %6
+  mov [rel .indices + %1], cl
+
+  ArrangeAndStoreFLAGS %1
+%endmacro
+
+; Equal ordered bytes, partial match at the end of the vector
+CompareAndStore 0, .needle, .tail, 4, 16, 0b00001100
+
+; Equal ordered bytes, negative lengths
+CompareAndStore 1, .needle, .tail, -4, -16, 0b00001100
+
+; Equal ordered bytes, empty needle (msb)
+CompareAndStore 2, .needle, .tail, 0, 5, 0b01001100
+
+; Equal ordered bytes, needle longer than the string
+CompareAndStore 3, .needle, .short, 4, 2, 0b00001100
+
+; Equal each bytes, lengths saturated from INT32_MIN and above 16
+CompareAndStore 4, .each1, .each2, 0x80000000, 100, 0b00001000
+
+; Equal each bytes, differing lengths
+CompareAndStore 5, .each1, .each2, 3, 6, 0b00001000
+
+; Equal each bytes, differing lengths (msb, negative masked)
+CompareAndStore 6, .each1, .each2, 3, 6, 0b01111000
+
+; Signed byte ranges, odd length ignores the last element
+CompareAndStore 7, .ranges, .text, 5, 16, 0b00000110
+
+; Unsigned byte ranges, odd length ignores the last element (msb)
+CompareAndStore 8, .ranges, .text, 5, 16, 0b01000100
+
+; Unsigned byte ranges, no complete range
+CompareAndStore 9, .ranges, .text, 1, 16, 0b00000100
+
+; Equal any bytes, empty set
+CompareAndStore 10, .needle, .text, 0, 16, 0b00000000
+
+; Signed word ranges
+CompareAndStore 11, .wranges, .wtext, 4, 8, 0b00000111
+
+; Unsigned word ranges (msb)
+CompareAndStore 12, .wranges, .wtext, 4, 7, 0b01000101
+
+; Equal any words, empty set (negative polarity)
+CompareAndStore 13, .needle, .tail, 0, 8, 0b00010001
+
+; Load all our stored indices and flags for result comparing
+movaps xmm0, [rel .indices]
+movaps xmm1, [rel .flags]
+
+; Expanded masks for implicit lengths
+; Equal ordered bytes, partial match at the end of the vector
+movaps xmm2, [rel .needle]
+pcmpistrm xmm2, [rel .tail], 0b01001100
+movaps xmm4, xmm0
+
+; Signed word ranges
+movaps xmm2, [rel .wranges]
+pcmpistrm xmm2, [rel .wtext], 0b01000111
+movaps xmm5, xmm0
+
+; Restore the indices
+movaps xmm0, [rel .indices]
+
+hlt
+
+align 4096
+.needle:
+dq 0x0000000064636261 ; "abcd"
+dq 0x0000000000000000
+
+.tail:
+dq 0x7978797879787978 ; "xyxyxyxy"
+dq 0x6261797879787978 ; "xyxyxyab"
+
+.short:
+dq 0x0000000000006261 ; "ab"
+dq 0x0000000000000000
+
+.ranges:
+dq 0x000000417A610AF6 ; [-10, 10], "az", "A"
+dq 0x0000000000000000
+
+.text:
+dq 0x61F60A007F80FB41
+dq 0x626001FF097B5A7A
+
+.each1:
+dq 0x6867666564636261 ; "abcdefgh"
+dq 0x0000000000000000
+
+.each2:
+dq 0x6867666564586261 ; "abXdefgh"
+dq 0x0000000000000000
+
+.wranges:
+dq 0x005A004103E8FC18 ; [-1000, 1000], "AZ"
+dq 0x0000000000000000
+
+.wtext:
+dq 0x03E88000FC17FC18
+dq 0x005B005A004103E9
+
+.indices:
+dq 0x0000000000000000
+dq 0x0000000000000000
+
+.flags:
+dq 0x0000000000000000
+dq 0x0000000000000000
@@ -0,0 +1,61 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Absolute path lookups go through the rootfs first and fall back to the host.
+// With a read-only rootfs image these results are cached, make sure repeated lookups stay consistent.
+
+constexpr const char* MissingPath = "/usr/lib/fex-rootfs-path-lookup-does-not-exist.so";
+
+TEST_CASE("rootfs path lookup - missing path") {
+  for (int i = 0; i < 3; ++i) {
+    struct stat Buffer {};
+    errno = 0;
+    CHECK(stat(MissingPath, &Buffer) == -1);
+    CHECK(errno == ENOENT);
+
+    errno = 0;
+    CHECK(lstat(MissingPath, &Buffer) == -1);
+    CHECK(errno == ENOENT);
+
+    errno = 0;
+    CHECK(access(MissingPath, F_OK) == -1);
+    CHECK(errno == ENOENT);
+  }
+}
+
+TEST_CASE("rootfs path lookup - existing path") {
+  struct stat First {};
+  REQUIRE(stat("/proc/self/exe", &First) == 0);
+
+  for (int i = 0; i < 3; ++i) {
+    struct stat Buffer {};
+    REQUIRE(stat("/proc/self/exe", &Buffer) == 0);
+    CHECK(Buffer.st_ino == First.st_ino);
+    CHECK(Buffer.st_dev == First.st_dev);
+
+    int FD = open("/proc/self/exe", O_RDONLY | O_CLOEXEC);
+    CHECK(FD != -1);
+    close(FD);
+  }
+}
+
+TEST_CASE("rootfs path lookup - benchmark", "[.][benchmark]") {
+  BENCHMARK("stat missing") {
+    struct stat Buffer {};
+    return stat(MissingPath, &Buffer);
+  };
+
+  BENCHMARK("access missing") {
+    return access(MissingPath, F_OK);
+  };
+
+  BENCHMARK("lstat existing") {
+    struct stat Buffer {};
+    return lstat("/usr", &Buffer);
+  };
+}
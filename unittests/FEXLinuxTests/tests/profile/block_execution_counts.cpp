@@ -0,0 +1,111 @@
+// Runs a known loop in a child with FEX_BLOCKEXECUTIONCOUNTS enabled and checks the dumped count for the loop block.
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <dlfcn.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+extern "C" char block_counts_loop_begin[];
+
+constexpr uint32_t LoopIterations = 1000;
+
+// The loop header is only ever entered through a branch, so with multiblock disabled it is its own block that gets
+// entered exactly once per iteration.
+__attribute__((noinline)) static void CountedLoop(uint32_t Iterations) {
+  asm volatile(R"(
+  jmp block_counts_loop_begin
+  .global block_counts_loop_begin
+  .hidden block_counts_loop_begin
+  block_counts_loop_begin:
+  dec %0
+  jnz block_counts_loop_begin
+  )"
+               : "+r"(Iterations)
+               :
+               : "cc");
+}
+
+// The re-executed child runs the loop and exits before Catch2 runs, which writes out the counts.
+__attribute__((constructor)) static void CountedChild() {
+  if (!getenv("BLOCK_COUNTS_CHILD")) {
+    return;
+  }
+
+  CountedLoop(LoopIterations);
+  exit(0);
+}
+
+TEST_CASE("Block execution counts for known loop") {
+  char Dir[] = "/tmp/fex_block_counts_XXXXXX";
+  REQUIRE(mkdtemp(Dir) != nullptr);
+
+  std::string CountsEnv = std::string("FEX_BLOCKEXECUTIONCOUNTS=") + Dir;
+  char MultiblockEnv[] = "FEX_MULTIBLOCK=0";
+  char ChildEnv[] = "BLOCK_COUNTS_CHILD=1";
+  char* const Argv[] = {const_cast<char*>("block_execution_counts"), nullptr};
+  std::vector<char*> Envp {CountsEnv.data(), MultiblockEnv, ChildEnv};
+  for (char** Env = environ; *Env; ++Env) {
+    if (strncmp(*Env, "FEX_MULTIBLOCK=", 15) != 0 && strncmp(*Env, "FEX_BLOCKEXECUTIONCOUNTS=", 25) != 0) {
+      Envp.push_back(*Env);
+    }
+  }
+  Envp.push_back(nullptr);
+
+  const pid_t Child = fork();
+  if (Child == 0) {
+    execve("/proc/self/exe", Argv, Envp.data());
+    _exit(1);
+  }
+
+  int Status {};
+  REQUIRE(waitpid(Child, &Status, 0) == Child);
+  REQUIRE(WIFEXITED(Status));
+  REQUIRE(WEXITSTATUS(Status) == 0);
+
+  Dl_info Info {};
+  REQUIRE(dladdr(reinterpret_cast<void*>(&CountedLoop), &Info) != 0);
+  const auto LoopOffset = reinterpret_cast<uintptr_t>(block_counts_loop_begin) - reinterpret_cast<uintptr_t>(Info.dli_fbase);
+  const auto Module = std::filesystem::read_symlink("/proc/self/exe").filename();
+
+  // Counts are written as <Dir>/<Application>-<pid>.counts
+  const auto Suffix = "-" + std::to_string(Child) + ".counts";
+  std::filesystem::path CountsPath;
+  for (const auto& Entry : std::filesystem::directory_iterator(Dir)) {
+    const auto Name = Entry.path().filename().string();
+    if (Name.size() > Suffix.size() && Name.ends_with(Suffix)) {
+      CountsPath = Entry.path();
+    }
+  }
+  REQUIRE(!CountsPath.empty());
+
+  // <FileId> <Offset> <Count> <HostSize> <RIP> <Filename>
+  std::optional<uint64_t> LoopCount;
+  std::ifstream Counts(CountsPath);
+  std::string Line;
+  while (std::getline(Counts, Line)) {
+    std::istringstream Fields(Line);
+    std::string FileId, Filename;
+    uint64_t Offset {}, Count {}, HostSize {}, RIP {};
+    Fields >> FileId >> std::hex >> Offset >> std::dec >> Count >> HostSize >> std::hex >> RIP >> Filename;
+
+    if (Offset == LoopOffset && std::filesystem::path(Filename).filename() == Module) {
+      LoopCount = Count;
+    }
+  }
+
+  std::filesystem::remove_all(Dir);
+
+  REQUIRE(LoopCount.has_value());
+  CHECK(*LoopCount == LoopIterations);
+}
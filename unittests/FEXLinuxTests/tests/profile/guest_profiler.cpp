@@ -0,0 +1,121 @@
+// Runs a hot loop in a child with FEX_GUESTPROFILE enabled and checks that the loop shows up in the folded profile.
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <dirent.h>
+#include <dlfcn.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+extern "C" char guest_profiler_loop_begin[];
+extern "C" char guest_profiler_loop_end[];
+
+__attribute__((noinline)) static void HotLoop(uint32_t Iterations) {
+  asm volatile(R"(
+  .global guest_profiler_loop_begin
+  .hidden guest_profiler_loop_begin
+  guest_profiler_loop_begin:
+  1:
+  dec %0
+  jnz 1b
+  .global guest_profiler_loop_end
+  .hidden guest_profiler_loop_end
+  guest_profiler_loop_end:
+  )"
+               : "+r"(Iterations)
+               :
+               : "cc");
+}
+
+static uint64_t CPUTimeNS() {
+  timespec ts {};
+  clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+  return ts.tv_sec * 1'000'000'000ULL + ts.tv_nsec;
+}
+
+// The re-executed child burns CPU time in the loop and exits before Catch2 runs, which writes out the profile.
+__attribute__((constructor)) static void ProfiledChild() {
+  if (!getenv("GUEST_PROFILER_CHILD")) {
+    return;
+  }
+
+  const auto Start = CPUTimeNS();
+  while (CPUTimeNS() - Start < 250'000'000ULL) {
+    HotLoop(1U << 20);
+  }
+
+  exit(0);
+}
+
+TEST_CASE("Guest profiler samples hot loop") {
+  char Dir[] = "/tmp/fex_guest_profile_XXXXXX";
+  REQUIRE(mkdtemp(Dir) != nullptr);
+
+  std::string ProfileEnv = std::string("FEX_GUESTPROFILE=") + Dir;
+  char ChildEnv[] = "GUEST_PROFILER_CHILD=1";
+  char* const Argv[] = {const_cast<char*>("guest_profiler"), nullptr};
+  std::vector<char*> Envp {ProfileEnv.data(), ChildEnv};
+  for (char** Env = environ; *Env; ++Env) {
+    Envp.push_back(*Env);
+  }
+  Envp.push_back(nullptr);
+
+  const pid_t Child = fork();
+  if (Child == 0) {
+    execve("/proc/self/exe", Argv, Envp.data());
+    _exit(1);
+  }
+
+  int Status {};
+  REQUIRE(waitpid(Child, &Status, 0) == Child);
+  REQUIRE(WIFEXITED(Status));
+  REQUIRE(WEXITSTATUS(Status) == 0);
+
+  Dl_info Info {};
+  REQUIRE(dladdr(reinterpret_cast<void*>(&HotLoop), &Info) != 0);
+  const auto Base = reinterpret_cast<uintptr_t>(Info.dli_fbase);
+  const auto LoopBegin = reinterpret_cast<uintptr_t>(guest_profiler_loop_begin) - Base;
+  const auto LoopEnd = reinterpret_cast<uintptr_t>(guest_profiler_loop_end) - Base;
+  const auto Module = std::filesystem::read_symlink("/proc/self/exe").filename().string() + ";+0x";
+
+  // Profile is written as <Dir>/<Application>-<pid>.folded
+  const auto Suffix = "-" + std::to_string(Child) + ".folded";
+  std::filesystem::path ProfilePath;
+  for (const auto& Entry : std::filesystem::directory_iterator(Dir)) {
+    const auto Name = Entry.path().filename().string();
+    if (Name.size() > Suffix.size() && Name.ends_with(Suffix)) {
+      ProfilePath = Entry.path();
+    }
+  }
+  REQUIRE(!ProfilePath.empty());
+
+  uint64_t LoopSamples {};
+  std::ifstream Profile(ProfilePath);
+  std::string Line;
+  while (std::getline(Profile, Line)) {
+    INFO(Line);
+    if (!Line.starts_with(Module)) {
+      continue;
+    }
+
+    const auto Offset = strtoull(Line.c_str() + Module.size(), nullptr, 16);
+    const auto Count = strtoull(Line.c_str() + Line.find_last_of(' ') + 1, nullptr, 10);
+    if (Offset >= LoopBegin && Offset < LoopEnd) {
+      LoopSamples += Count;
+    }
+  }
+
+  std::filesystem::remove_all(Dir);
+
+  CHECK(LoopSamples > 0);
+}
@@ -0,0 +1,107 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <atomic>
+#include <cerrno>
+#include <signal.h>
+#include <sys/syscall.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+// The syscall number is a constant in the same block as the `syscall` instruction, so FEX can issue it inline.
+static long InlineRead(int fd, void* buf, size_t count) {
+  long Result;
+  __asm volatile(R"(
+    mov eax, %c[Num];
+    syscall;
+  )"
+                 : "=a"(Result)
+                 : [Num] "i"(SYS_read), "D"(fd), "S"(buf), "d"(count)
+                 : "rcx", "r11", "memory");
+  return Result;
+}
+
+static int Pipe[2];
+static std::atomic<int> HandlerCount {};
+
+static void WritingHandler(int) {
+  HandlerCount++;
+  char Data = 'a';
+  write(Pipe[1], &Data, 1);
+}
+
+static void CountingHandler(int) {
+  HandlerCount++;
+}
+
+static void ArmTimer() {
+  itimerval Timer {};
+  Timer.it_value.tv_usec = 50'000;
+  setitimer(ITIMER_REAL, &Timer, nullptr);
+}
+
+static void InstallHandler(void (*Handler)(int), int Flags) {
+  struct sigaction Action {};
+  Action.sa_handler = Handler;
+  Action.sa_flags = Flags;
+  sigemptyset(&Action.sa_mask);
+  sigaction(SIGALRM, &Action, nullptr);
+}
+
+TEST_CASE("Inline syscall - interrupted without SA_RESTART") {
+  REQUIRE(pipe(Pipe) == 0);
+  HandlerCount = 0;
+  InstallHandler(CountingHandler, 0);
+  ArmTimer();
+
+  // Nothing is ever written, so the blocking read must come back with EINTR exactly once.
+  char Data {};
+  CHECK(InlineRead(Pipe[0], &Data, 1) == -EINTR);
+  CHECK(HandlerCount == 1);
+
+  close(Pipe[0]);
+  close(Pipe[1]);
+}
+
+TEST_CASE("Inline syscall - interrupted with SA_RESTART") {
+  REQUIRE(pipe(Pipe) == 0);
+  HandlerCount = 0;
+  InstallHandler(WritingHandler, SA_RESTART);
+  ArmTimer();
+
+  // The handler provides the data, the restarted read must consume it rather than returning early.
+  char Data {};
+  CHECK(InlineRead(Pipe[0], &Data, 1) == 1);
+  CHECK(Data == 'a');
+  CHECK(HandlerCount == 1);
+
+  close(Pipe[0]);
+  close(Pipe[1]);
+}
+
+TEST_CASE("Inline syscall - preserves registers") {
+  REQUIRE(pipe(Pipe) == 0);
+  char Data = 'b';
+  REQUIRE(write(Pipe[1], &Data, 1) == 1);
+
+  // RDX, RSI and RDI are arguments and must survive the syscall, RSP must too.
+  uint64_t RDX, RSI, RDI, RSPBefore, RSPAfter;
+  long Result;
+  __asm volatile(R"(
+    mov %[RSPBefore], rsp;
+    mov eax, %c[Num];
+    syscall;
+    mov %[RSPAfter], rsp;
+  )"
+                 : "=a"(Result), "=d"(RDX), "=S"(RSI), "=D"(RDI), [RSPBefore] "=&r"(RSPBefore), [RSPAfter] "=&r"(RSPAfter)
+                 : [Num] "i"(SYS_read), "D"(Pipe[0]), "S"(&Data), "d"(1)
+                 : "rcx", "r11", "memory");
+
+  CHECK(Result == 1);
+  CHECK(RDX == 1);
+  CHECK(RSI == reinterpret_cast<uint64_t>(&Data));
+  CHECK(RDI == static_cast<uint64_t>(Pipe[0]));
+  CHECK(RSPBefore == RSPAfter);
+
+  close(Pipe[0]);
+  close(Pipe[1]);
+}
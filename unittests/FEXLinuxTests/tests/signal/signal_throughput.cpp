@@ -0,0 +1,181 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <signal.h>
+#include <stdlib.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+// Back to back guest signal delivery, covering both the fast delivery path and the cases that have to fall back to the
+// full path. The throughput benchmark is hidden, run it with the [benchmark] tag natively and under FEX to compare the
+// emulation overhead of a signal round trip.
+
+constexpr int Iterations = 1000;
+constexpr int BenchmarkIterations = 100'000;
+
+static volatile int HandlerCount {};
+static volatile int MaskedInHandler {};
+static volatile int SigInfoMatches {};
+static volatile int OnAltStack {};
+static char* AltStackBase {};
+static size_t AltStackSize {};
+
+static void CountingHandler(int) {
+  HandlerCount = HandlerCount + 1;
+}
+
+static void SigInfoHandler(int Signal, siginfo_t* Info, void* UContext) {
+  HandlerCount = HandlerCount + 1;
+
+  if (Info->si_signo == Signal && Info->si_code == SI_TKILL && Info->si_pid == getpid()) {
+    SigInfoMatches = SigInfoMatches + 1;
+  }
+
+  // The delivered signal must be masked for the duration of the handler.
+  auto Context = static_cast<ucontext_t*>(UContext);
+  sigset_t Current;
+  sigprocmask(SIG_SETMASK, nullptr, &Current);
+  if (sigismember(&Current, Signal) && !sigismember(&Context->uc_sigmask, Signal)) {
+    MaskedInHandler = MaskedInHandler + 1;
+  }
+}
+
+static void AltStackHandler(int) {
+  HandlerCount = HandlerCount + 1;
+
+  char Local {};
+  if (&Local >= AltStackBase && &Local < AltStackBase + AltStackSize) {
+    OnAltStack = OnAltStack + 1;
+  }
+}
+
+static void SendSelf(int Signal) {
+  ::syscall(SYS_tgkill, getpid(), ::syscall(SYS_gettid), Signal);
+}
+
+static void Install(int Signal, void (*Handler)(int), int Flags = 0) {
+  struct sigaction Action {};
+  Action.sa_handler = Handler;
+  Action.sa_flags = Flags;
+  sigemptyset(&Action.sa_mask);
+  REQUIRE(sigaction(Signal, &Action, nullptr) == 0);
+}
+
+static void InstallSigInfo(int Signal) {
+  struct sigaction Action {};
+  Action.sa_sigaction = SigInfoHandler;
+  Action.sa_flags = SA_SIGINFO;
+  sigemptyset(&Action.sa_mask);
+  REQUIRE(sigaction(Signal, &Action, nullptr) == 0);
+}
+
+TEST_CASE("Signal delivery - sa_handler") {
+  Install(SIGUSR1, CountingHandler);
+
+  HandlerCount = 0;
+  for (int i = 0; i < Iterations; ++i) {
+    SendSelf(SIGUSR1);
+  }
+  CHECK(HandlerCount == Iterations);
+
+  signal(SIGUSR1, SIG_DFL);
+}
+
+TEST_CASE("Signal delivery - sa_sigaction") {
+  InstallSigInfo(SIGUSR2);
+
+  HandlerCount = 0;
+  MaskedInHandler = 0;
+  SigInfoMatches = 0;
+  for (int i = 0; i < Iterations; ++i) {
+    SendSelf(SIGUSR2);
+  }
+  CHECK(HandlerCount == Iterations);
+  CHECK(SigInfoMatches == Iterations);
+  CHECK(MaskedInHandler == Iterations);
+
+  // The mask must be fully restored after every sigreturn.
+  sigset_t Current;
+  sigprocmask(SIG_SETMASK, nullptr, &Current);
+  CHECK(!sigismember(&Current, SIGUSR2));
+
+  signal(SIGUSR2, SIG_DFL);
+}
+
+TEST_CASE("Signal delivery - masked signals stay pending") {
+  Install(SIGUSR1, CountingHandler);
+
+  sigset_t Mask;
+  sigemptyset(&Mask);
+  sigaddset(&Mask, SIGUSR1);
+
+  HandlerCount = 0;
+  REQUIRE(sigprocmask(SIG_BLOCK, &Mask, nullptr) == 0);
+  SendSelf(SIGUSR1);
+  SendSelf(SIGUSR1);
+  CHECK(HandlerCount == 0);
+
+  // Non-realtime signals coalesce while pending.
+  REQUIRE(sigprocmask(SIG_UNBLOCK, &Mask, nullptr) == 0);
+  CHECK(HandlerCount == 1);
+
+  signal(SIGUSR1, SIG_DFL);
+}
+
+TEST_CASE("Signal delivery - SA_ONSTACK uses the altstack") {
+  AltStackSize = SIGSTKSZ * 4;
+  AltStackBase = static_cast<char*>(malloc(AltStackSize));
+  REQUIRE(AltStackBase != nullptr);
+
+  stack_t AltStack {};
+  AltStack.ss_sp = AltStackBase;
+  AltStack.ss_size = AltStackSize;
+  stack_t OldAltStack {};
+  REQUIRE(sigaltstack(&AltStack, &OldAltStack) == 0);
+
+  Install(SIGUSR1, AltStackHandler, SA_ONSTACK);
+
+  HandlerCount = 0;
+  OnAltStack = 0;
+  for (int i = 0; i < Iterations; ++i) {
+    SendSelf(SIGUSR1);
+  }
+  CHECK(HandlerCount == Iterations);
+  CHECK(OnAltStack == Iterations);
+
+  signal(SIGUSR1, SIG_DFL);
+  REQUIRE(sigaltstack(&OldAltStack, nullptr) == 0);
+  free(AltStackBase);
+}
+
+TEST_CASE("Signal delivery - SIG_IGN") {
+  signal(SIGUSR1, SIG_IGN);
+  for (int i = 0; i < Iterations; ++i) {
+    SendSelf(SIGUSR1);
+  }
+  signal(SIGUSR1, SIG_DFL);
+  SUCCEED();
+}
+
+static void Benchmark(const char* Name, int Signal) {
+  HandlerCount = 0;
+  const auto Begin = std::chrono::steady_clock::now();
+  for (int i = 0; i < BenchmarkIterations; ++i) {
+    SendSelf(Signal);
+  }
+  const auto Seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - Begin).count();
+
+  printf("%s: %.0f signals/s (%.2f us per signal)\n", Name, BenchmarkIterations / Seconds, Seconds * 1'000'000.0 / BenchmarkIterations);
+  CHECK(HandlerCount == BenchmarkIterations);
+}
+
+TEST_CASE("Signal delivery - throughput", "[.][benchmark]") {
+  Install(SIGUSR1, CountingHandler);
+  Benchmark("sa_handler", SIGUSR1);
+  signal(SIGUSR1, SIG_DFL);
+
+  InstallSigInfo(SIGUSR2);
+  Benchmark("sa_sigaction", SIGUSR2);
+  signal(SIGUSR2, SIG_DFL);
+}
@@ -0,0 +1,77 @@
+/*
+  tests for smc on code pages that are mprotected and then moved with mremap
+*/
+
+#include "smc-common.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+static void write_code(char* code, uint32_t value) {
+  // mov eax, imm32
+  code[0] = 0xB8;
+  memcpy(&code[1], &value, sizeof(value));
+  // ret
+  code[5] = 0xC3;
+}
+
+static uint32_t call(char* code) {
+  return ((uint32_t(*)())code)();
+}
+
+TEST_CASE("SMC: mprotect then mremap") {
+  auto code = (char*)mmap(0, 8192, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANON, -1, 0);
+  REQUIRE(code != MAP_FAILED);
+
+  write_code(code + 4096, 0x11111111);
+  REQUIRE(mprotect(code, 8192, PROT_READ | PROT_EXEC) == 0);
+  CHECK(call(code + 4096) == 0x11111111);
+
+  // Reserve a destination so the remap has to move the pages.
+  auto dest = (char*)mmap(0, 16384, PROT_NONE, MAP_PRIVATE | MAP_ANON, -1, 0);
+  REQUIRE(dest != MAP_FAILED);
+
+  auto moved = (char*)mremap(code, 8192, 16384, MREMAP_MAYMOVE | MREMAP_FIXED, dest);
+  REQUIRE(moved == dest);
+  CHECK(call(moved + 4096) == 0x11111111);
+
+  // The moved code pages are still tracked, writes must invalidate the code compiled from them.
+  REQUIRE(mprotect(moved, 16384, PROT_READ | PROT_WRITE | PROT_EXEC) == 0);
+  write_code(moved + 4096, 0x22222222);
+  CHECK(call(moved + 4096) == 0x22222222);
+
+  write_code(moved + 4096, 0x33333333);
+  REQUIRE(mprotect(moved, 16384, PROT_READ | PROT_EXEC) == 0);
+  CHECK(call(moved + 4096) == 0x33333333);
+
+  // The grown tail wasn't code before the remap.
+  REQUIRE(mprotect(moved, 16384, PROT_READ | PROT_WRITE | PROT_EXEC) == 0);
+  write_code(moved + 8192, 0x44444444);
+  CHECK(call(moved + 8192) == 0x44444444);
+  write_code(moved + 8192, 0x55555555);
+  CHECK(call(moved + 8192) == 0x55555555);
+
+  munmap(moved, 16384);
+}
+
+TEST_CASE("SMC: mremap over previously executed code") {
+  auto target = (char*)mmap(0, 4096, PROT_READ | PROT_WRITE | PROT_EXEC, MAP_PRIVATE | MAP_ANON, -1, 0);
+  REQUIRE(target != MAP_FAILED);
+  write_code(target, 0x66666666);
+  CHECK(call(target) == 0x66666666);
+
+  auto code = (char*)mmap(0, 4096, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANON, -1, 0);
+  REQUIRE(code != MAP_FAILED);
+  write_code(code, 0x77777777);
+  REQUIRE(mprotect(code, 4096, PROT_READ | PROT_EXEC) == 0);
+
+  // Replaces the mapping the old code was compiled from.
+  auto moved = (char*)mremap(code, 4096, 4096, MREMAP_MAYMOVE | MREMAP_FIXED, target);
+  REQUIRE(moved == target);
+  CHECK(call(moved) == 0x77777777);
+
+  REQUIRE(mprotect(moved, 4096, PROT_READ | PROT_WRITE | PROT_EXEC) == 0);
+  write_code(moved, 0x88888888);
+  CHECK(call(moved) == 0x88888888);
+
+  munmap(moved, 4096);
+}
@@ -0,0 +1,145 @@
+#define GUEST_THUNK_LIBRARY
+
+#include <dlfcn.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "../../../../ThunkLibs/libfex_thunk_test/api.h"
+
+// Microbenchmark for thunk transitions using libfex_thunk_test.
+// Only the per-function counter check runs by default. The latency cases are hidden, run them with the [benchmark] tag to
+// print the average latency of guest->host calls with different argument shapes and of host->guest callback round trips.
+
+constexpr int Iterations = 200'000;
+
+struct Fixture {
+  void* lib = []() {
+    auto ret = dlopen("libfex_thunk_test.so", RTLD_LAZY);
+    if (!ret) {
+      throw std::runtime_error("Failed to open lib\n");
+    }
+    return ret;
+  }();
+
+#define GET_SYMBOL(name) decltype(&::name) name = (decltype(name))dlsym(lib, #name)
+  GET_SYMBOL(DoNothing);
+  GET_SYMBOL(GetDoubledValue);
+  GET_SYMBOL(GetDoubledValueRegisterABI);
+  GET_SYMBOL(FunctionWithDivergentSignature);
+  GET_SYMBOL(MakeReorderingType);
+  GET_SYMBOL(GetReorderingTypeMember);
+  GET_SYMBOL(InvokeCallback);
+  GET_SYMBOL(InvokeCallbackRepeatedly);
+};
+
+template<typename F>
+static uint64_t Measure(const char* Name, F&& Call) {
+  uint64_t Accumulator = 0;
+  const auto Begin = std::chrono::steady_clock::now();
+  for (int i = 0; i < Iterations; ++i) {
+    Accumulator += Call(i);
+  }
+  const auto Seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - Begin).count();
+  printf("%s: %.1f ns per call\n", Name, Seconds * 1'000'000'000.0 / Iterations);
+  return Accumulator;
+}
+
+static uint32_t GuestCallback(uint32_t Value) {
+  return Value + 1;
+}
+
+TEST_CASE_METHOD(Fixture, "Guest to host", "[.][benchmark]") {
+  CHECK(Measure("No arguments", [&](uint32_t) {
+          DoNothing();
+          return 1;
+        }) == Iterations);
+
+  const auto Expected = Measure("Native", [](uint32_t i) { return 2 * i; });
+  CHECK(Measure("Scalar argument", [&](uint32_t i) { return GetDoubledValue(i); }) == Expected);
+  CHECK(Measure("Scalar argument, register ABI", [&](uint32_t i) { return GetDoubledValueRegisterABI(i); }) == Expected);
+
+  CHECK(Measure("Four repacked integer arguments", [&](uint32_t i) {
+          return FunctionWithDivergentSignature(DivType(i & 0xff), DivType(1), DivType(2), DivType(3));
+        }) == Measure("Native", [](uint32_t i) { return static_cast<int>(((i & 0xff) << 24) | 0x10203); }));
+
+  const auto Struct = MakeReorderingType(0x1234, 0x5678);
+  CHECK(Measure("Repacked struct pointer", [&](uint32_t) { return GetReorderingTypeMember(&Struct, 1); }) == uint64_t {0x5678} * Iterations);
+}
+
+TEST_CASE_METHOD(Fixture, "Host to guest", "[.][benchmark]") {
+  const auto Expected = Measure("Native", [](uint32_t i) { return GuestCallback(i); });
+  CHECK(Measure("Callback round trip", [&](uint32_t i) { return InvokeCallback(GuestCallback, i); }) == Expected);
+
+  // Host code calling back in to the guest in a loop, like allocation or audio callbacks do
+  const auto Begin = std::chrono::steady_clock::now();
+  const auto Result = InvokeCallbackRepeatedly(GuestCallback, Iterations);
+  const auto Seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - Begin).count();
+  printf("Repeated callbacks: %.1f ns per callback\n", Seconds * 1'000'000'000.0 / Iterations);
+  CHECK(Result == static_cast<uint32_t>(Expected));
+}
+
+// Per-thunk counters are only published with ProfileStats enabled
+TEST_CASE_METHOD(Fixture, "Per-function counters") {
+  const auto Name = "/fex-" + std::to_string(getpid()) + "-thunks";
+  const int fd = shm_open(Name.c_str(), O_RDONLY, 0);
+  if (fd == -1) {
+    SKIP("Thunk stats are disabled");
+  }
+
+  struct stat buf {};
+  REQUIRE(fstat(fd, &buf) == 0);
+  auto Base = reinterpret_cast<const uint8_t*>(mmap(nullptr, buf.st_size, PROT_READ, MAP_SHARED, fd, 0));
+  close(fd);
+  REQUIRE(Base != MAP_FAILED);
+
+  // Layout of FEXCore::SHMStats::ThunkStatsHeader and ThunkStats
+  struct Header {
+    uint8_t Version;
+    uint8_t app_type;
+    uint16_t ThunkStatsSize;
+    uint32_t NumThunks;
+    uint64_t CycleCounterFrequency;
+  };
+  struct Entry {
+    uint8_t Sum[32];
+    char Library[32];
+    uint64_t Count;
+    uint64_t AccumulatedHostTime;
+  };
+
+  auto Head = reinterpret_cast<const volatile Header*>(Base);
+  REQUIRE(Head->Version == 1);
+  REQUIRE(Head->ThunkStatsSize >= sizeof(Entry));
+
+  // Sums up the calls to all functions of this library
+  auto CountCalls = [&]() {
+    uint64_t Count = 0;
+    for (uint32_t i = 0; i < Head->NumThunks; ++i) {
+      auto Stats = reinterpret_cast<const volatile Entry*>(Base + sizeof(Header) + i * Head->ThunkStatsSize);
+      if (Stats->Count && strstr(const_cast<const char*>(Stats->Library), "fex_thunk_test")) {
+        Count += Stats->Count;
+      }
+    }
+    return Count;
+  };
+
+  DoNothing();
+  const auto Before = CountCalls();
+  for (int i = 0; i < 1000; ++i) {
+    DoNothing();
+  }
+  CHECK(CountCalls() - Before == 1000);
+
+  munmap(const_cast<uint8_t*>(Base), buf.st_size);
+}
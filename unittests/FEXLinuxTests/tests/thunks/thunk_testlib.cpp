@@ -2,9 +2,13 @@
 
 #include <dlfcn.h>
 
+#include <chrono>
+#include <cstdio>
 #include <stdexcept>
+#include <vector>
 
 #include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
 
 #include "../../../../ThunkLibs/libfex_thunk_test/api.h"
 
@@ -31,12 +35,24 @@ struct Fixture {
   GET_SYMBOL(GetReorderingTypeMember);
   GET_SYMBOL(GetReorderingTypeMemberWithoutRepacking);
   GET_SYMBOL(ModifyReorderingTypeMembers);
+  GET_SYMBOL(ModifyReorderingTypeArray);
+  GET_SYMBOL(SumReorderingTypeArray);
   GET_SYMBOL(QueryOffsetOf);
 
   GET_SYMBOL(RanCustomRepack);
 
   GET_SYMBOL(FunctionWithDivergentSignature);
 
+  GET_SYMBOL(GetDoubledValueRegisterABI);
+  GET_SYMBOL(SumRegisterABIArgs);
+  GET_SYMBOL(StoreRegisterABIValue);
+
+  GET_SYMBOL(AppendBatchedValue);
+  GET_SYMBOL(SetOpaqueTypeDataBatched);
+  GET_SYMBOL(GetBatchedValueCount);
+  GET_SYMBOL(GetBatchedValueChecksum);
+  GET_SYMBOL(ResetBatchedValues);
+
   GET_SYMBOL(ReadData1);
 };
 
@@ -83,6 +99,32 @@ TEST_CASE_METHOD(Fixture, "Automatic struct repacking") {
   };
 }
 
+TEST_CASE_METHOD(Fixture, "Automatic array repacking") {
+  // Small arrays are repacked into the scratch arena, anything past its 64 KiB goes through the heap
+  const int count = GENERATE(0, 1, 16, 10000);
+  INFO(count);
+
+  std::vector<ReorderingType> data(count);
+  uint64_t expected_sum = 0;
+  for (int i = 0; i < count; ++i) {
+    data[i] = MakeReorderingType(i, 3 * i);
+    expected_sum += i + 2 * (3 * i);
+  }
+
+  // Test repacking of input arrays
+  CHECK(SumReorderingTypeArray(data.data(), count) == expected_sum);
+
+  // Test repacking of output arrays, every element must be written back
+  ModifyReorderingTypeArray(data.data(), count);
+  int mismatches = 0;
+  for (int i = 0; i < count; ++i) {
+    if (data[i].a != uint32_t(i + 1) || data[i].b != uint32_t(3 * i + 2)) {
+      ++mismatches;
+    }
+  }
+  CHECK(mismatches == 0);
+}
+
 TEST_CASE_METHOD(Fixture, "Assisted struct repacking") {
   CustomRepackedType data {};
   CHECK(RanCustomRepack(&data) == 1);
@@ -92,6 +134,67 @@ TEST_CASE_METHOD(Fixture, "Function signature with differing parameter sizes") {
   CHECK(FunctionWithDivergentSignature(DivType {1}, DivType {2}, DivType {3}, DivType {4}) == 0x01020304);
 }
 
+TEST_CASE_METHOD(Fixture, "Register ABI") {
+  CHECK(GetDoubledValueRegisterABI(10) == 20);
+  CHECK(GetDoubledValueRegisterABI(0x8000'0001) == 2);
+
+  const uint32_t value = 100;
+  CHECK(SumRegisterABIArgs(-1, 0xffff, -3, 1LL << 40, &value, true) == -1 + 0xffff - 3 + (1LL << 40) + 100 + 1);
+
+  uint32_t dst = 0;
+  StoreRegisterABIValue(&dst, 0x1234);
+  CHECK(dst == 0x1234);
+}
+
+// Compares the per-call cost of a packed-argument thunk against the same function using the register ABI.
+// The timings are informational only, run it with the [benchmark] tag.
+TEST_CASE_METHOD(Fixture, "Call overhead", "[.][benchmark]") {
+  constexpr int Iterations = 1'000'000;
+
+  auto Measure = [](const char* Name, auto&& Call) {
+    uint32_t Accumulator = 0;
+    const auto Begin = std::chrono::steady_clock::now();
+    for (int i = 0; i < Iterations; ++i) {
+      Accumulator += Call(i);
+    }
+    const auto Seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - Begin).count();
+    printf("%s: %.1f ns per call\n", Name, Seconds * 1'000'000'000.0 / Iterations);
+    return Accumulator;
+  };
+
+  const auto Packed = Measure("Packed arguments", [&](uint32_t i) { return GetDoubledValue(i); });
+  const auto Register = Measure("Register ABI", [&](uint32_t i) { return GetDoubledValueRegisterABI(i); });
+  CHECK(Packed == Register);
+}
+
+TEST_CASE_METHOD(Fixture, "Batched calls") {
+  ResetBatchedValues();
+
+  SECTION("Ordering") {
+    // Enough calls to overflow the guest-side buffer several times
+    constexpr uint32_t Count = 10'000;
+    uint64_t Checksum = 0;
+    for (uint32_t i = 0; i < Count; ++i) {
+      AppendBatchedValue(i);
+      Checksum = Checksum * 31 + i;
+    }
+
+    CHECK(GetBatchedValueCount() == Count);
+    CHECK(GetBatchedValueChecksum() == Checksum);
+  }
+
+  SECTION("Flush on non-batchable call") {
+    auto data = MakeOpaqueType(0x1234);
+    SetOpaqueTypeDataBatched(data, 0x5678);
+    CHECK(ReadOpaqueTypeData(data) == 0x5678);
+
+    SetOpaqueTypeDataBatched(data, 1);
+    SetOpaqueTypeDataBatched(data, 2);
+    CHECK(ReadOpaqueTypeData(data) == 2);
+    DestroyOpaqueType(data);
+  }
+}
+
 // Test Vulkan-like linked lists
 TEST_CASE_METHOD(Fixture, "Assisted repacking of linked lists") {
   const int s2_data = 0xcddeeff;
@@ -233,7 +233,11 @@ SourceWithAST Fixture::run_thunkgen_guest(std::string_view prelude, std::string_
                        "template<typename Target>\n"
                        "Target *MakeHostTrampolineForGuestFunction(uint8_t HostPacker[32], void (*)(uintptr_t, void*), Target*);\n"
                        "template<typename Target>\n"
-                       "Target *AllocateHostTrampolineForGuestFunction(Target*);\n";
+                       "Target *AllocateHostTrampolineForGuestFunction(Target*);\n"
+                       "struct FEXBatchBuffer { void (*Flush)(); uint32_t Begin; uint32_t Used; uint8_t Data[16]; };\n"
+                       "struct FEXBatchFlushArgs { uint64_t Data; uint64_t Size; };\n"
+                       "void FEXBatchFlush();\n"
+                       "template<typename T> bool FEXBatchAppend(FEXBatchBuffer&, uint32_t, const T&);\n";
   const auto& filename = output_filenames.guest;
   {
     std::ifstream file(filename);
@@ -290,7 +294,9 @@ SourceWithAST Fixture::run_thunkgen_host(std::string_view prelude, std::string_v
     "struct GuestWrapperForHostFunction {\n"
     "  template<ParameterAnnotations...> static void Call(void*);\n"
     "};\n"
-    "struct ExportEntry { uint8_t* sha256; void(*fn)(void *); };\n"
+    "constexpr uint32_t EXPORT_FLAG_REGISTER_ABI = 1;\n"
+    "struct ExportEntry { uint8_t* sha256; void(*fn)(void *); uint32_t flags; };\n"
+    "template<std::size_t N> void fexfn_run_batched_calls(void*, void (*const (&)[N])(void*));\n"
     "void *dlsym_default(void* handle, const char* symbol);\n"
     "template<typename T> inline constexpr bool has_compatible_data_layout = std::is_integral_v<T> || std::is_enum_v<T>;\n"
     "template<typename T>\n"
@@ -362,11 +368,16 @@ SourceWithAST Fixture::run_thunkgen_host(std::string_view prelude, std::string_v
     "struct repack_wrapper {};\n"
     "template<typename T, typename GuestT>\n"
     "repack_wrapper<T, GuestT> make_repack_wrapper(guest_layout<GuestT>& orig_arg);\n"
+    "template<typename T, typename GuestT>\n"
+    "struct repack_array_wrapper {};\n"
+    "template<typename T, typename GuestT, typename CountT>\n"
+    "repack_array_wrapper<T, GuestT> make_repack_array_wrapper(guest_layout<GuestT>& orig_arg, CountT count, size_t guest_stride);\n"
     "template<typename T> host_to_guest_convertible<T> to_guest(const host_layout<T>& from);\n"
     "template<typename F> void FinalizeHostTrampolineForGuestFunction(F*);\n"
     "template<typename F> void FinalizeHostTrampolineForGuestFunction(guest_layout<F*>);\n"
     "template<typename T> T& unwrap_host(host_layout<T>&);\n"
     "template<typename T, typename GuestT> T* unwrap_host(repack_wrapper<T*, GuestT>&);\n"
+    "template<typename T, typename GuestT> T* unwrap_host(repack_array_wrapper<T*, GuestT>&);\n"
     "template<typename T> const host_layout<T>& to_host_layout(const T& t);\n";
 
   auto& filename = output_filenames.host;
@@ -833,6 +844,38 @@ TEST_CASE_METHOD(Fixture, "StructRepacking") {
   }
 }
 
+TEST_CASE_METHOD(Fixture, "ArrayParameter") {
+  auto guest_abi = GENERATE(GuestABI::X86_32, GuestABI::X86_64);
+  INFO(guest_abi);
+
+  // "long" has different size on 32-bit guests, so A is repackable there
+  const std::string prelude = "struct A { int a; long b; };\n";
+  const std::string code = "#include <thunks_common.h>\n"
+                           "void func(A*, int);\n"
+                           "template<> struct fex_gen_config<func> {};\n";
+
+  SECTION("Annotated") {
+    const auto output =
+      run_thunkgen_host(prelude, code + "template<> struct fex_gen_param<func, 0, A*> : fexgen::array_size_param<1> {};\n", guest_abi);
+    if (guest_abi == GuestABI::X86_32) {
+      CHECK_THAT(output, matches(callExpr(callee(functionDecl(hasName("make_repack_array_wrapper"))), hasArgument(2, integerLiteral(equals(8))))));
+    } else {
+      // Compatible data layout: No repacking needed
+      CHECK_THAT(output, !matches(callExpr(callee(functionDecl(hasName("make_repack_array_wrapper"))))));
+    }
+    CHECK_THAT(output, !matches(callExpr(callee(functionDecl(hasName("make_repack_wrapper"))))));
+  }
+
+  SECTION("Invalid annotations") {
+    // Count parameter index out of range
+    CHECK_THROWS(run_thunkgen_host(prelude, code + "template<> struct fex_gen_param<func, 0, A*> : fexgen::array_size_param<2> {};\n", guest_abi, true));
+    // Count parameter must be an integer
+    CHECK_THROWS(run_thunkgen_host(prelude, code + "template<> struct fex_gen_param<func, 0, A*> : fexgen::array_size_param<0> {};\n", guest_abi, true));
+    // Annotated parameter must be a pointer
+    CHECK_THROWS(run_thunkgen_host(prelude, code + "template<> struct fex_gen_param<func, 1, int> : fexgen::array_size_param<1> {};\n", guest_abi, true));
+  }
+}
+
 TEST_CASE_METHOD(Fixture, "VoidPointerParameter") {
   auto guest_abi = GENERATE(GuestABI::X86_32, GuestABI::X86_64);
   INFO(guest_abi);
@@ -888,3 +931,124 @@ TEST_CASE_METHOD(Fixture, "VoidPointerParameter") {
     CHECK_NOTHROW(run_thunkgen_host(prelude, code, guest_abi));
   }
 }
+
+TEST_CASE_METHOD(Fixture, "RegisterABI") {
+  auto guest_abi = GENERATE(GuestABI::X86_32, GuestABI::X86_64);
+  INFO(guest_abi);
+
+  const std::string code = "#include <thunks_common.h>\n"
+                           "int func(int, const char*, bool);\n"
+                           "template<> struct fex_gen_config<func> : fexgen::register_abi {};\n";
+
+  SECTION("Guest") {
+    // Arguments are forwarded to the thunk as-is without a packed argument struct
+    const auto output = run_thunkgen_guest("", code);
+    CHECK_THAT(output, matches(functionDecl(hasName("fexfn_pack_func"), returns(asString("int")), parameterCountIs(3),
+                                            unless(hasDescendant(varDecl(hasName("args")))))));
+  }
+
+  SECTION("Host") {
+    const auto output = run_thunkgen_host("", code, guest_abi);
+    if (guest_abi == GuestABI::X86_32) {
+      // 32-bit guests keep using the packed ABI
+      CHECK_THAT(output, matches(functionDecl(hasName("fexfn_unpack_libtest_func"))));
+      CHECK_THAT(output, !matches(functionDecl(hasName("fexfn_regabi_libtest_func"))));
+    } else {
+      CHECK_THAT(output, matches(functionDecl(hasName("fexfn_regabi_libtest_func"), returns(asString("uint64_t")), parameterCountIs(3))));
+      CHECK_THAT(output, !matches(functionDecl(hasName("fexfn_unpack_libtest_func"))));
+      CHECK_THAT(output, matches(varDecl(hasName("exports"), hasInitializer(hasDescendant(initListExpr(hasInit(
+                                                                2, ignoringImpCasts(declRefExpr(to(varDecl(hasName("EXPORT_FLAG_REGISTER_ABI"))))))))))));
+    }
+  }
+
+  SECTION("Unsupported signatures") {
+    CHECK_THROWS(run_thunkgen_host("",
+                                   "#include <thunks_common.h>\n"
+                                   "void func(double);\n"
+                                   "template<> struct fex_gen_config<func> : fexgen::register_abi {};\n",
+                                   guest_abi, true));
+    CHECK_THROWS(run_thunkgen_host("",
+                                   "#include <thunks_common.h>\n"
+                                   "void func(int, int, int, int, int, int, int);\n"
+                                   "template<> struct fex_gen_config<func> : fexgen::register_abi {};\n",
+                                   guest_abi, true));
+    CHECK_THROWS(run_thunkgen_host("struct A { int a; };\n",
+                                   "#include <thunks_common.h>\n"
+                                   "void func(A*);\n"
+                                   "template<> struct fex_gen_config<func> : fexgen::register_abi {};\n",
+                                   guest_abi, true));
+  }
+
+  SECTION("Return types") {
+    CHECK_NOTHROW(run_thunkgen_host("",
+                                    "#include <thunks_common.h>\n"
+                                    "const char* func(int);\n"
+                                    "template<> struct fex_gen_config<func> : fexgen::register_abi {};\n",
+                                    guest_abi));
+    CHECK_NOTHROW(run_thunkgen_host("",
+                                    "#include <thunks_common.h>\n"
+                                    "void* func();\n"
+                                    "template<> struct fex_gen_config<func> : fexgen::register_abi {};\n",
+                                    guest_abi));
+    CHECK_THROWS(run_thunkgen_host("",
+                                   "#include <thunks_common.h>\n"
+                                   "double func();\n"
+                                   "template<> struct fex_gen_config<func> : fexgen::register_abi {};\n",
+                                   guest_abi, true));
+    CHECK_THROWS(run_thunkgen_host("struct A { int a; };\n",
+                                   "#include <thunks_common.h>\n"
+                                   "A* func();\n"
+                                   "template<> struct fex_gen_config<func> : fexgen::register_abi {};\n",
+                                   guest_abi, true));
+    CHECK_THROWS(run_thunkgen_host("struct A { int a; };\n",
+                                   "#include <thunks_common.h>\n"
+                                   "A func();\n"
+                                   "template<> struct fex_gen_config<func> : fexgen::register_abi {};\n",
+                                   guest_abi, true));
+  }
+}
+
+TEST_CASE_METHOD(Fixture, "Batchable") {
+  const std::string prelude = "struct Handle;\n";
+  const std::string code = "#include <thunks_common.h>\n"
+                           "void func(Handle*, int);\n"
+                           "int sync();\n"
+                           "template<> struct fex_gen_type<Handle> : fexgen::opaque_type {};\n"
+                           "template<> struct fex_gen_config<func> : fexgen::batchable {};\n"
+                           "template<> struct fex_gen_config<sync> {};\n";
+
+  SECTION("Guest") {
+    const auto output = run_thunkgen_guest(prelude, code);
+
+    // Batchable calls are appended to the buffer instead of transitioning to the host, unless the buffer can't take them
+    const auto append_call = callExpr(callee(functionDecl(hasName("FEXBatchAppend"))));
+    const auto direct_call = callExpr(callee(functionDecl(hasName("fexthunks_libtest_func"))));
+    CHECK_THAT(output, matches(functionDecl(hasName("fexfn_pack_func"),
+                                            hasDescendant(ifStmt(hasCondition(hasDescendant(append_call)), hasThen(hasDescendant(direct_call)))))));
+
+    // Non-batchable calls flush the buffer first
+    CHECK_THAT(output, matches(functionDecl(hasName("fexfn_pack_sync"), hasDescendant(callExpr(callee(functionDecl(hasName("FEXBatchFlush"))))))));
+  }
+
+  SECTION("Host") {
+    auto guest_abi = GENERATE(GuestABI::X86_32, GuestABI::X86_64);
+    INFO(guest_abi);
+
+    const auto output = run_thunkgen_host(prelude, code, guest_abi);
+    CHECK_THAT(output, matches(varDecl(hasName("fexbatch_unpackers"), hasType(constantArrayType(hasSize(1))))));
+    CHECK_THAT(output, matches(varDecl(hasName("exports"), hasType(constantArrayType(hasElementType(asStructString("ExportEntry")), hasSize(4))))));
+  }
+
+  SECTION("Unsupported signatures") {
+    CHECK_THROWS(run_thunkgen_guest("",
+                                    "#include <thunks_common.h>\n"
+                                    "int func();\n"
+                                    "template<> struct fex_gen_config<func> : fexgen::batchable {};\n",
+                                    true));
+    CHECK_THROWS(run_thunkgen_guest("",
+                                    "#include <thunks_common.h>\n"
+                                    "void func(const int*);\n"
+                                    "template<> struct fex_gen_config<func> : fexgen::batchable {};\n",
+                                    true));
+  }
+}